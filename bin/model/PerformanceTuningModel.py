@@ -255,7 +255,7 @@ class PerformanceTuningModel(Model):
         """
         Set block IO read method if applicable
         """
-        self.isInList(m, ('default', 'stdio serial', 'stdio parallel',
+        self.isInList(m, ('default', 'stdio serial', 'stdio parallel', 'mmap',
                           'mpi independent', 'mpi noncollective',
                           'mpi collective'))
         if m == 'default':
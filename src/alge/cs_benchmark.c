@@ -86,6 +86,7 @@
 #include "cs_matrix_assembler.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_tuning.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -534,6 +535,100 @@ _sub_matrix_vector_test(double               t_measure,
   _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure global dot product performance for each BLAS reduction mode,
+ * and overhead relative to the default (superblock) mode.
+ *
+ * parameters:
+ *   t_measure   <-- minimum time for each measure (< 0 for single pass)
+ *   n_cells     <-- number of cells
+ *   x           <-- vector
+ *   y           <-- vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_product_test(double            t_measure,
+                  cs_lnum_t         n_cells,
+                  const cs_real_t  *x,
+                  const cs_real_t  *y)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob;
+
+  double t_ref = -1;
+
+  const int n_modes = 3;
+  const cs_blas_reduce_t modes[] = {CS_BLAS_REDUCE_SUPERBLOCK,
+                                    CS_BLAS_REDUCE_KAHAN,
+                                    CS_BLAS_REDUCE_REPRODUCIBLE};
+  const char *mode_name[] = {N_("superblock"),
+                             N_("Kahan"),
+                             N_("reproducible")};
+
+  const cs_blas_reduce_t mode_ini = cs_blas_get_reduce_algorithm();
+
+  /* n_cells multiplications + n_cells additions */
+
+  n_ops = n_cells*2;
+
+  if (cs_glob_n_ranks == 1)
+    n_ops_glob = n_ops;
+  else
+    n_ops_glob = cs_glob_mesh->n_g_cells*2;
+
+  for (int m_id = 0; m_id < n_modes; m_id++) {
+
+    cs_blas_set_reduce_algorithm(modes[m_id]);
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        test_sum += cs_gdot(n_cells, x, y)*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (wt1 - wt0 < t_measure)
+        n_runs *= 2;
+    }
+
+    /* Use maximum time over ranks, so that the overhead is global */
+
+    double t_run = (wt1 - wt0) / n_runs;
+    cs_parall_max(1, CS_DOUBLE, &t_run);
+
+    if (m_id == 0)
+      t_ref = t_run;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "\n"
+                  "Global dot product, %s reduction\n"
+                  "------------------\n",
+                  _(mode_name[m_id]));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  (calls: %d;  test sum: %12.5f)\n",
+                  n_runs, test_sum);
+
+    _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+
+    if (m_id > 0 && t_ref > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  Overhead relative to %s: %8.3f\n",
+                    _(mode_name[0]), t_run/t_ref);
+
+  }
+
+  cs_blas_set_reduce_algorithm(mode_ini);
+}
+
 /*----------------------------------------------------------------------------
  * Copy array to reference for matrix computation check.
  *
@@ -1069,6 +1164,8 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  _dot_product_test(t_measure, n_cells, x, da);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
@@ -30,6 +30,7 @@
  * External library headers
  *----------------------------------------------------------------------------*/
 
+#include <assert.h>
 #include <math.h>
 #include <stdio.h>
 
@@ -37,6 +38,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_mem.h"
+
 #include "cs_base.h"
 #include "cs_parall.h"
 
@@ -69,6 +72,11 @@ BEGIN_C_DECLS
   \var CS_BLAS_REDUCE_KAHAN
        Reduction based on Kahan's compensated summation, described in
        \cite Kahan:1965
+
+  \var CS_BLAS_REDUCE_REPRODUCIBLE
+       Reduction based on exact binned (fixed-point) accumulation, whose
+       result is independent of the number of threads and of the
+       partitioning across ranks
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -1207,10 +1215,251 @@ _cs_gres_kahan(cs_lnum_t         n,
   return dot;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of 2 vectors: x.y
+ *        using reproducible accumulation.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ * \param[in]  y  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_reproducible(cs_lnum_t         n,
+                     const cs_real_t  *x,
+                     const cs_real_t  *y)
+{
+  const cs_real_t *_x[1] = {x};
+  const cs_real_t *_y[1] = {y};
+  cs_blas_rsum_t acc[1];
+
+  cs_dot_rsum(n, 1, _x, _y, acc);
+
+  return cs_blas_rsum_value(acc);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return dot products of a vector with itself: x.x
+ *        using reproducible accumulation.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_xx_reproducible(cs_lnum_t         n,
+                        const cs_real_t  *x)
+{
+  return _cs_dot_reproducible(n, x, x);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 2 vectors: x.x, and x.y
+ *        using reproducible accumulation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_reproducible(cs_lnum_t                    n,
+                           const cs_real_t  *restrict   x,
+                           const cs_real_t  *restrict   y,
+                           double                      *xx,
+                           double                      *xy)
+{
+  const cs_real_t *_x[2] = {x, x};
+  const cs_real_t *_y[2] = {x, y};
+  cs_blas_rsum_t acc[2];
+
+  cs_dot_rsum(n, 2, _x, _y, acc);
+
+  *xx = cs_blas_rsum_value(acc);
+  *xy = cs_blas_rsum_value(acc + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 3 vectors: x.y, and y.z
+ *        using reproducible accumulation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_reproducible(cs_lnum_t                    n,
+                           const cs_real_t  *restrict   x,
+                           const cs_real_t  *restrict   y,
+                           const cs_real_t  *restrict   z,
+                           double                      *xy,
+                           double                      *yz)
+{
+  const cs_real_t *_x[2] = {x, y};
+  const cs_real_t *_y[2] = {y, z};
+  cs_blas_rsum_t acc[2];
+
+  cs_dot_rsum(n, 2, _x, _y, acc);
+
+  *xy = cs_blas_rsum_value(acc);
+  *yz = cs_blas_rsum_value(acc + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.x, x.y, and y.z
+ *        using reproducible accumulation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_yz_reproducible(cs_lnum_t                    n,
+                              const cs_real_t  *restrict   x,
+                              const cs_real_t  *restrict   y,
+                              const cs_real_t  *restrict   z,
+                              double                      *xx,
+                              double                      *xy,
+                              double                      *yz)
+{
+  const cs_real_t *_x[3] = {x, x, y};
+  const cs_real_t *_y[3] = {x, y, z};
+  cs_blas_rsum_t acc[3];
+
+  cs_dot_rsum(n, 3, _x, _y, acc);
+
+  *xx = cs_blas_rsum_value(acc);
+  *xy = cs_blas_rsum_value(acc + 1);
+  *yz = cs_blas_rsum_value(acc + 2);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
+ *        using reproducible accumulation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  yy  y.y dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_yy_xy_xz_yz_reproducible(cs_lnum_t                    n,
+                                    const cs_real_t  *restrict   x,
+                                    const cs_real_t  *restrict   y,
+                                    const cs_real_t  *restrict   z,
+                                    double                      *xx,
+                                    double                      *yy,
+                                    double                      *xy,
+                                    double                      *xz,
+                                    double                      *yz)
+{
+  const cs_real_t *_x[5] = {x, y, x, x, y};
+  const cs_real_t *_y[5] = {x, y, y, z, z};
+  cs_blas_rsum_t acc[5];
+
+  cs_dot_rsum(n, 5, _x, _y, acc);
+
+  *xx = cs_blas_rsum_value(acc);
+  *yy = cs_blas_rsum_value(acc + 1);
+  *xy = cs_blas_rsum_value(acc + 2);
+  *xz = cs_blas_rsum_value(acc + 3);
+  *yz = cs_blas_rsum_value(acc + 4);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global residual of 2 extensive vectors:
+ *        1/sum(vol) . sum(X.Y.vol) using reproducible accumulation.
+ *
+ * Both sums are accumulated exactly before the parallel reduction,
+ * so the result is independent of the partitioning.
+ *
+ * \param[in]  n    size of arrays x and y
+ * \param[in]  vol  array of floating-point values
+ * \param[in]  x    array of floating-point values
+ * \param[in]  y    array of floating-point values
+ *
+ * \return  global residual
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_gres_reproducible(cs_lnum_t         n,
+                      const cs_real_t  *vol,
+                      const cs_real_t  *x,
+                      const cs_real_t  *y)
+{
+  cs_blas_rsum_t acc[2];
+
+  cs_blas_rsum_init(acc);
+  cs_blas_rsum_init(acc + 1);
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    cs_blas_rsum_t t_acc[2];
+
+    cs_blas_rsum_init(t_acc);
+    cs_blas_rsum_init(t_acc + 1);
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_blas_rsum_add(t_acc, x[i]*y[i]*vol[i]);
+      cs_blas_rsum_add(t_acc + 1, vol[i]);
+    }
+
+#   pragma omp critical
+    {
+      cs_blas_rsum_merge(acc, t_acc);
+      cs_blas_rsum_merge(acc + 1, t_acc + 1);
+    }
+  }
+
+  cs_blas_rsum_parall_sum(2, acc);
+
+  return cs_blas_rsum_value(acc) / cs_blas_rsum_value(acc + 1);
+}
+
 /*============================================================================
  * Static global function pointers
  *============================================================================*/
 
+static cs_blas_reduce_t  _cs_glob_reduce_mode = CS_BLAS_REDUCE_SUPERBLOCK;
+
 static cs_dot_t       *_cs_glob_dot       = _cs_dot_superblock;
 static cs_dot_xx_t    *_cs_glob_dot_xx    = _cs_dot_xx_superblock;
 static cs_dot_xx_xy_t *_cs_glob_dot_xx_xy = _cs_dot_xx_xy_superblock;
@@ -1233,6 +1482,12 @@ static cs_gres_t      *_cs_glob_gres      = _cs_gres_superblock;
  * This may not be enforced for all algorithms, though it should at least
  * be enforced for the most general functions such as \ref cs_dot.
  *
+ * The CS_BLAS_REDUCE_REPRODUCIBLE mode applies to the dot product and sum
+ * functions of this module (and the iterative solver and multigrid dot
+ * products based on them), and to the 1-d case of cs_array_reduce_sum_l.
+ * Other cs_array_reduce statistics (norms, means, and weighted or indexed
+ * sums) are not covered, and may still depend on the number of threads.
+ *
  * \param[in]  mode   BLAS mode to use
  */
 /*----------------------------------------------------------------------------*/
@@ -1263,6 +1518,271 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_gres = _cs_gres_kahan;
       }
       break;
+    case CS_BLAS_REDUCE_REPRODUCIBLE:
+      {
+        _cs_glob_dot = _cs_dot_reproducible;
+        _cs_glob_dot_xx = _cs_dot_xx_reproducible;
+        _cs_glob_dot_xx_xy = _cs_dot_xx_xy_reproducible;
+        _cs_glob_dot_xy_yz = _cs_dot_xy_yz_reproducible;
+        _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_reproducible;
+        _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_reproducible;
+        _cs_glob_gres = _cs_gres_reproducible;
+      }
+      break;
+  }
+
+  _cs_glob_reduce_mode = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current BLAS reduction algorithm family.
+ *
+ * \return  BLAS reduction mode in use
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_blas_reduce_t
+cs_blas_get_reduce_algorithm(void)
+{
+  return _cs_glob_reduce_mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Propagate carries in a reproducible sum accumulator, so that all
+ *        bins except the highest one are in the [0, 2^32[ range.
+ *
+ * \param[in, out]  acc  pointer to accumulator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_normalize(cs_blas_rsum_t  *acc)
+{
+  const int64_t base = (int64_t)1 << 32;
+
+  for (int i = 0; i < CS_BLAS_RSUM_N_BINS - 1; i++) {
+    int64_t low = (int64_t)((uint64_t)(acc->b[i]) & 0xffffffffULL);
+    int64_t carry = (acc->b[i] - low) / base; /* exact (floor) division */
+    acc->b[i] = low;
+    acc->b[i+1] += carry;
+  }
+
+  acc->n_adds = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the contents of a reproducible sum accumulator to another.
+ *
+ * Both accumulators are normalized first; as integer additions are
+ * associative, the result does not depend on the merge order.
+ *
+ * \param[in, out]  acc  pointer to accumulator to add to
+ * \param[in, out]  src  pointer to accumulator to add (normalized on output)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_merge(cs_blas_rsum_t  *acc,
+                   cs_blas_rsum_t  *src)
+{
+  cs_blas_rsum_normalize(acc);
+  cs_blas_rsum_normalize(src);
+
+  for (int i = 0; i < CS_BLAS_RSUM_SIZE; i++)
+    acc->b[i] += src->b[i];
+
+  acc->n_adds = 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the value of a reproducible sum accumulator.
+ *
+ * The accumulator is normalized, so its representation is unique, and
+ * the conversion to double precision is thus deterministic.
+ *
+ * \param[in, out]  acc  pointer to accumulator
+ *
+ * \return  the accumulated sum
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_blas_rsum_value(cs_blas_rsum_t  *acc)
+{
+  const int64_t *n_special = acc->b + CS_BLAS_RSUM_N_BINS;
+
+  if (n_special[2] > 0 || (n_special[0] > 0 && n_special[1] > 0))
+    return nan("");
+  else if (n_special[0] > 0)
+    return HUGE_VAL;
+  else if (n_special[1] > 0)
+    return -HUGE_VAL;
+
+  cs_blas_rsum_normalize(acc);
+
+  /* Negative sums have all upper bins set (2's complement-like), so
+     convert the absolute value to avoid overflows */
+
+  cs_blas_rsum_t _acc;
+  const cs_blas_rsum_t *a = acc;
+  double sgn = 1.;
+
+  if (acc->b[CS_BLAS_RSUM_N_BINS - 1] < 0) {
+    for (int i = 0; i < CS_BLAS_RSUM_N_BINS; i++)
+      _acc.b[i] = - acc->b[i];
+    cs_blas_rsum_normalize(&_acc);
+    a = &_acc;
+    sgn = -1.;
+  }
+
+  /* Bin i has weight 2^(32.i - 1074), 2^-1074 being the smallest denormal */
+
+  double v = 0.;
+
+  for (int i = CS_BLAS_RSUM_N_BINS - 1; i >= 0; i--) {
+    if (a->b[i] != 0)
+      v += ldexp((double)(a->b[i]), 32*i - 1074);
+  }
+
+  return sgn*v;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum reproducible sum accumulators over all ranks of a communicator.
+ *
+ * Accumulators are normalized before the exchange, so the sums of
+ * bins may not overflow for less than 2^31 ranks.
+ *
+ * \param[in]       n     number of accumulators
+ * \param[in, out]  acc   accumulators (local on input, global on output)
+ * \param[in]       comm  associated MPI communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_allreduce(int              n,
+                       cs_blas_rsum_t   acc[],
+                       MPI_Comm         comm)
+{
+  const int s = CS_BLAS_RSUM_SIZE;
+
+  int64_t  _buf[2*CS_BLAS_RSUM_MAX_DOTS*CS_BLAS_RSUM_SIZE] = {0};
+  int64_t  *buf = _buf;
+
+  if (n > CS_BLAS_RSUM_MAX_DOTS)
+    BFT_MALLOC(buf, 2*n*s, int64_t);
+
+  int64_t *r_buf = buf + n*s;
+
+  for (int j = 0; j < n; j++) {
+    cs_blas_rsum_normalize(acc + j);
+    for (int i = 0; i < s; i++)
+      buf[j*s + i] = acc[j].b[i];
+  }
+
+  MPI_Allreduce(buf, r_buf, n*s, MPI_INT64_T, MPI_SUM, comm);
+
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < s; i++)
+      acc[j].b[i] = r_buf[j*s + i];
+    acc[j].n_adds = 1;
+  }
+
+  if (buf != _buf)
+    BFT_FREE(buf);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum reproducible sum accumulators over all ranks of the main
+ *        communicator (no-op in serial mode).
+ *
+ * \param[in]       n    number of accumulators
+ * \param[in, out]  acc  accumulators (local on input, global on output)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_parall_sum(int              n,
+                        cs_blas_rsum_t   acc[])
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    cs_blas_rsum_allreduce(n, acc, cs_glob_mpi_comm);
+#else
+  CS_UNUSED(n);
+  CS_UNUSED(acc);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute several local dot products x[i].y[i] using reproducible
+ *        sum accumulators, independently of the current reduction mode.
+ *
+ * If y[i] is NULL, the sum of x[i] is computed instead.
+ *
+ * Each product is rounded once, then accumulated exactly, so the result
+ * does not depend on the thread count, and accumulators may be summed
+ * across ranks with \ref cs_blas_rsum_allreduce with the same property.
+ *
+ * \param[in]   n       size of arrays
+ * \param[in]   n_dots  number of dot products
+ *                      (max: \ref CS_BLAS_RSUM_MAX_DOTS)
+ * \param[in]   x       first vectors of each dot product
+ * \param[in]   y       second vectors of each dot product, or NULL
+ * \param[out]  acc     resulting accumulators (size: n_dots)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_dot_rsum(cs_lnum_t          n,
+            int                n_dots,
+            const cs_real_t   *x[],
+            const cs_real_t   *y[],
+            cs_blas_rsum_t     acc[])
+{
+  assert(n_dots <= CS_BLAS_RSUM_MAX_DOTS);
+
+  for (int j = 0; j < n_dots; j++)
+    cs_blas_rsum_init(acc + j);
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    cs_blas_rsum_t t_acc;
+
+    for (int j = 0; j < n_dots; j++) {
+
+      const cs_real_t *_x = x[j];
+      const cs_real_t *_y = y[j];
+
+      cs_blas_rsum_init(&t_acc);
+
+      if (_y != NULL) {
+        for (cs_lnum_t i = s_id; i < e_id; i++)
+          cs_blas_rsum_add(&t_acc, _x[i]*_y[i]);
+      }
+      else {
+        for (cs_lnum_t i = s_id; i < e_id; i++)
+          cs_blas_rsum_add(&t_acc, _x[i]);
+      }
+
+#     pragma omp critical
+      cs_blas_rsum_merge(acc + j, &t_acc);
+
+    }
   }
 }
 
@@ -1313,6 +1833,14 @@ double
 cs_sum(cs_lnum_t         n,
        const cs_real_t  *x)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[1] = {x};
+    const cs_real_t *_y[1] = {NULL};
+    cs_blas_rsum_t acc[1];
+    cs_dot_rsum(n, 1, _x, _y, acc);
+    return cs_blas_rsum_value(acc);
+  }
+
   double sum = 0.0;
 
 # pragma omp parallel reduction(+:sum) if (n > CS_THR_MIN)
@@ -1368,6 +1896,9 @@ cs_weighted_sum(cs_lnum_t         n,
                 const cs_real_t  *w,
                 const cs_real_t  *x)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE)
+    return _cs_dot_reproducible(n, w, x);
+
   double wsum = 0.0;
 
 # pragma omp parallel reduction(+:wsum) if (n > CS_THR_MIN)
@@ -1623,6 +2154,326 @@ cs_dot_xx_yy_xy_xz_yz(cs_lnum_t                    n,
   _cs_glob_dot_xx_yy_xy_xz_yz(n, x, y, z, xx, yy, xy, xz, yz);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Constant times a vector plus a vector, followed by the dot product
+ *        of the result with another vector: y <-- ax + y; return y.z
+ *
+ * Both operations are fused in a single pass over the data, and the dot
+ * product uses a superblock algorithm for better precision.
+ *
+ * \param[in]       n  size of arrays x, y, and z
+ * \param[in]       a  multiplier for x
+ * \param[in]       x  array of floating-point values
+ * \param[in, out]  y  array of floating-point values
+ * \param[in]       z  array of floating-point values
+ *
+ * \return  local y.z dot product (after update of y)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_axpy_dot(cs_lnum_t                    n,
+            double                       a,
+            const cs_real_t  *restrict   x,
+            cs_real_t        *restrict   y,
+            const cs_real_t  *restrict   z)
+{
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_axpy(n, a, x, y);
+    return _cs_dot_reproducible(n, y, z);
+  }
+
+  double dot_yz = 0.0;
+
+# pragma omp parallel reduction(+:dot_yz) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *restrict _x = x + s_id;
+    cs_real_t *restrict _y = y + s_id;
+    const cs_real_t *restrict _z = z + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_yz = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_yz = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          _y[i] += a*_x[i];
+          cdot_yz += _y[i]*_z[i];
+        }
+        sdot_yz += cdot_yz;
+      }
+
+      dot_yz += sdot_yz;
+
+    }
+
+  }
+
+  return dot_yz;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Constant times a vector plus a vector, followed by the dot product
+ *        of the result with itself: y <-- ax + y; return y.y
+ *
+ * Both operations are fused in a single pass over the data, and the dot
+ * product uses a superblock algorithm for better precision.
+ *
+ * \param[in]       n  size of arrays x and y
+ * \param[in]       a  multiplier for x
+ * \param[in]       x  array of floating-point values
+ * \param[in, out]  y  array of floating-point values
+ *
+ * \return  local y.y dot product (after update of y)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_axpy_dot_xx(cs_lnum_t                    n,
+               double                       a,
+               const cs_real_t  *restrict   x,
+               cs_real_t        *restrict   y)
+{
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_axpy(n, a, x, y);
+    return _cs_dot_reproducible(n, y, y);
+  }
+
+  double dot_yy = 0.0;
+
+# pragma omp parallel reduction(+:dot_yy) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *restrict _x = x + s_id;
+    cs_real_t *restrict _y = y + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_yy = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_yy = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          _y[i] += a*_x[i];
+          cdot_yy += _y[i]*_y[i];
+        }
+        sdot_yy += cdot_yy;
+      }
+
+      dot_yy += sdot_yy;
+
+    }
+
+  }
+
+  return dot_yy;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Two constant times a vector plus a vector operations, followed by
+ *        the dot product of the second result with itself:
+ *        y <-- ax + y; w <-- bz + w; return w.w
+ *
+ * This is the typical solution and residual update of Krylov solvers,
+ * fused in a single pass over the data. The dot product uses a superblock
+ * algorithm for better precision.
+ *
+ * \param[in]       n  size of arrays x, y, z, and w
+ * \param[in]       a  multiplier for x
+ * \param[in]       x  array of floating-point values
+ * \param[in, out]  y  array of floating-point values
+ * \param[in]       b  multiplier for z
+ * \param[in]       z  array of floating-point values
+ * \param[in, out]  w  array of floating-point values
+ *
+ * \return  local w.w dot product (after update of w)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_axpy2_dot_xx(cs_lnum_t                    n,
+                double                       a,
+                const cs_real_t  *restrict   x,
+                cs_real_t        *restrict   y,
+                double                       b,
+                const cs_real_t  *restrict   z,
+                cs_real_t        *restrict   w)
+{
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_axpy(n, a, x, y);
+    cs_axpy(n, b, z, w);
+    return _cs_dot_reproducible(n, w, w);
+  }
+
+  double dot_ww = 0.0;
+
+# pragma omp parallel reduction(+:dot_ww) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *restrict _x = x + s_id;
+    cs_real_t *restrict _y = y + s_id;
+    const cs_real_t *restrict _z = z + s_id;
+    cs_real_t *restrict _w = w + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_ww = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_ww = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          _y[i] += a*_x[i];
+          _w[i] += b*_z[i];
+          cdot_ww += _w[i]*_w[i];
+        }
+        sdot_ww += cdot_ww;
+      }
+
+      dot_ww += sdot_ww;
+
+    }
+
+  }
+
+  return dot_ww;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Two constant times a vector plus a vector operations, followed by
+ *        2 dot products of the second result:
+ *        y <-- ax + y; w <-- bz + w; ww = w.w; wv = w.v
+ *
+ * This is the typical solution and residual update of Krylov solvers,
+ * fused in a single pass over the data with the dot products required
+ * by the next iteration. The dot products use a superblock algorithm for
+ * better precision.
+ *
+ * \param[in]       n   size of arrays x, y, z, w, and v
+ * \param[in]       a   multiplier for x
+ * \param[in]       x   array of floating-point values
+ * \param[in, out]  y   array of floating-point values
+ * \param[in]       b   multiplier for z
+ * \param[in]       z   array of floating-point values
+ * \param[in, out]  w   array of floating-point values
+ * \param[in]       v   array of floating-point values
+ * \param[out]      ww  local w.w dot product (after update of w)
+ * \param[out]      wv  local w.v dot product (after update of w)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_axpy2_dot_xx_xy(cs_lnum_t                    n,
+                   double                       a,
+                   const cs_real_t  *restrict   x,
+                   cs_real_t        *restrict   y,
+                   double                       b,
+                   const cs_real_t  *restrict   z,
+                   cs_real_t        *restrict   w,
+                   const cs_real_t  *restrict   v,
+                   double                      *ww,
+                   double                      *wv)
+{
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_axpy(n, a, x, y);
+    cs_axpy(n, b, z, w);
+    _cs_dot_xx_xy_reproducible(n, w, v, ww, wv);
+    return;
+  }
+
+  double dot_ww = 0.0, dot_wv = 0.0;
+
+# pragma omp parallel reduction(+:dot_ww, dot_wv) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(n, &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *restrict _x = x + s_id;
+    cs_real_t *restrict _y = y + s_id;
+    const cs_real_t *restrict _z = z + s_id;
+    cs_real_t *restrict _w = w + s_id;
+    const cs_real_t *restrict _v = v + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_ww = 0.0;
+      double sdot_wv = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_ww = 0.0;
+        double cdot_wv = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          _y[i] += a*_x[i];
+          _w[i] += b*_z[i];
+          cdot_ww += _w[i]*_w[i];
+          cdot_wv += _w[i]*_v[i];
+        }
+        sdot_ww += cdot_ww;
+        sdot_wv += cdot_wv;
+      }
+
+      dot_ww += sdot_ww;
+      dot_wv += sdot_wv;
+
+    }
+
+  }
+
+  *ww = dot_ww;
+  *wv = dot_wv;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the global dot product of 2 vectors: x.y
@@ -1645,6 +2496,15 @@ cs_gdot(cs_lnum_t         n,
         const cs_real_t  *x,
         const cs_real_t  *y)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[1] = {x};
+    const cs_real_t *_y[1] = {y};
+    cs_blas_rsum_t acc[1];
+    cs_dot_rsum(n, 1, _x, _y, acc);
+    cs_blas_rsum_parall_sum(1, acc);
+    return cs_blas_rsum_value(acc);
+  }
+
   double retval = cs_dot(n, x, y);
 
   cs_parall_sum(1, CS_DOUBLE, &retval);
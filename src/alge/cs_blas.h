@@ -47,6 +47,23 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of 32-bit bins covering the double precision exponent range
+   (with headroom for carries) in a reproducible sum accumulator */
+
+#define CS_BLAS_RSUM_N_BINS  68
+
+/* Accumulator size, including counters for +inf, -inf, and NaN values */
+
+#define CS_BLAS_RSUM_SIZE  (CS_BLAS_RSUM_N_BINS + 3)
+
+/* Maximum number of additions to an accumulator between normalizations */
+
+#define CS_BLAS_RSUM_MAX_ADDS  (1 << 28)
+
+/* Maximum number of simultaneous dot products in cs_dot_rsum */
+
+#define CS_BLAS_RSUM_MAX_DOTS  5
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -56,10 +73,114 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_BLAS_REDUCE_SUPERBLOCK,
-  CS_BLAS_REDUCE_KAHAN
+  CS_BLAS_REDUCE_KAHAN,
+  CS_BLAS_REDUCE_REPRODUCIBLE
 
 } cs_blas_reduce_t;
 
+/* Reproducible sum accumulator.
+
+   Values are accumulated exactly as a fixed-point integer, split in
+   32-bit chunks stored in 64-bit bins, so the result does not depend
+   on the order of summation (hence on the number of threads or ranks). */
+
+typedef struct {
+
+  int64_t  b[CS_BLAS_RSUM_SIZE];   /* bins (CS_BLAS_RSUM_N_BINS values,
+                                      then +inf, -inf and NaN counts) */
+  int      n_adds;                 /* number of additions since last
+                                      normalization */
+
+} cs_blas_rsum_t;
+
+/*============================================================================
+ * Public inline function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Propagate carries in a reproducible sum accumulator, so that all bins
+ * except the highest one are in the [0, 2^32[ range.
+ *
+ * parameters:
+ *   acc <-> pointer to accumulator
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_normalize(cs_blas_rsum_t  *acc);
+
+/*============================================================================
+ * Inline public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize a reproducible sum accumulator.
+ *
+ * parameters:
+ *   acc --> pointer to accumulator
+ *----------------------------------------------------------------------------*/
+
+inline static void
+cs_blas_rsum_init(cs_blas_rsum_t  *acc)
+{
+  for (int i = 0; i < CS_BLAS_RSUM_SIZE; i++)
+    acc->b[i] = 0;
+  acc->n_adds = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a value to a reproducible sum accumulator.
+ *
+ * The 53-bit mantissa of the value is shifted to its position relative
+ * to the smallest denormal, and split over 3 consecutive 32-bit bins.
+ *
+ * parameters:
+ *   acc <-> pointer to accumulator
+ *   v   <-- value to add
+ *----------------------------------------------------------------------------*/
+
+inline static void
+cs_blas_rsum_add(cs_blas_rsum_t  *acc,
+                 double           v)
+{
+  union {
+    double    d;
+    uint64_t  u;
+  } _v;
+
+  _v.d = v;
+
+  uint64_t m = _v.u & 0xfffffffffffffULL;
+  int e = (int)((_v.u >> 52) & 0x7ff);
+  int64_t sgn = (_v.u >> 63) ? -1 : 1;
+
+  if (e == 0x7ff) { /* inf or NaN */
+    if (m != 0)
+      acc->b[CS_BLAS_RSUM_N_BINS + 2] += 1;
+    else
+      acc->b[CS_BLAS_RSUM_N_BINS + ((sgn < 0) ? 1 : 0)] += 1;
+    return;
+  }
+
+  if (e > 0) { /* normal value (implicit leading bit) */
+    m |= (1ULL << 52);
+    e -= 1;
+  }
+
+  int b_id = e >> 5;
+  int shift = e & 31;
+
+  uint64_t t0 = (m & 0xffffffffULL) << shift;
+  uint64_t t1 = (m >> 32) << shift;
+
+  acc->b[b_id]     += sgn * (int64_t)(t0 & 0xffffffffULL);
+  acc->b[b_id + 1] += sgn * (int64_t)((t0 >> 32) + (t1 & 0xffffffffULL));
+  acc->b[b_id + 2] += sgn * (int64_t)(t1 >> 32);
+
+  acc->n_adds += 1;
+  if (acc->n_adds >= CS_BLAS_RSUM_MAX_ADDS)
+    cs_blas_rsum_normalize(acc);
+}
+
 /*============================================================================
  *  Public function prototypes
  *============================================================================*/
@@ -71,6 +192,12 @@ typedef enum {
  * This may not be enforced for all algorithms, though it should at least
  * be enforced for the most general functions such as \ref cs_dot.
  *
+ * The CS_BLAS_REDUCE_REPRODUCIBLE mode applies to the dot product and sum
+ * functions of this module (and the iterative solver and multigrid dot
+ * products based on them), and to the 1-d case of cs_array_reduce_sum_l.
+ * Other cs_array_reduce statistics (norms, means, and weighted or indexed
+ * sums) are not covered, and may still depend on the number of threads.
+ *
  * \param[in]  mode   BLAS mode to use
  */
 /*----------------------------------------------------------------------------*/
@@ -78,6 +205,99 @@ typedef enum {
 void
 cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode);
 
+/*----------------------------------------------------------------------------
+ * Return the current BLAS reduction algorithm family.
+ *
+ * returns:
+ *   BLAS reduction mode in use
+ *----------------------------------------------------------------------------*/
+
+cs_blas_reduce_t
+cs_blas_get_reduce_algorithm(void);
+
+/*----------------------------------------------------------------------------
+ * Add the contents of a reproducible sum accumulator to another.
+ *
+ * Both accumulators are normalized first; as integer additions are
+ * associative, the result does not depend on the merge order.
+ *
+ * parameters:
+ *   acc <-> pointer to accumulator to add to
+ *   src <-> pointer to accumulator to add (normalized on output)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_merge(cs_blas_rsum_t  *acc,
+                   cs_blas_rsum_t  *src);
+
+/*----------------------------------------------------------------------------
+ * Return the value of a reproducible sum accumulator.
+ *
+ * The accumulator is normalized, so its representation is unique, and
+ * the conversion to double precision is thus deterministic.
+ *
+ * parameters:
+ *   acc <-> pointer to accumulator
+ *
+ * returns:
+ *   the accumulated sum
+ *----------------------------------------------------------------------------*/
+
+double
+cs_blas_rsum_value(cs_blas_rsum_t  *acc);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Sum reproducible sum accumulators over all ranks of a communicator.
+ *
+ * parameters:
+ *   n    <-- number of accumulators
+ *   acc  <-> accumulators (local on input, global on output)
+ *   comm <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_allreduce(int              n,
+                       cs_blas_rsum_t   acc[],
+                       MPI_Comm         comm);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Sum reproducible sum accumulators over all ranks of the main
+ * communicator (no-op in serial mode).
+ *
+ * parameters:
+ *   n   <-- number of accumulators
+ *   acc <-> accumulators (local on input, global on output)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_rsum_parall_sum(int              n,
+                        cs_blas_rsum_t   acc[]);
+
+/*----------------------------------------------------------------------------
+ * Compute several local dot products x[i].y[i] using reproducible
+ * sum accumulators, independently of the current reduction mode.
+ *
+ * If y[i] is NULL, the sum of x[i] is computed instead.
+ *
+ * parameters:
+ *   n      <-- size of arrays
+ *   n_dots <-- number of dot products (max: CS_BLAS_RSUM_MAX_DOTS)
+ *   x      <-- first vectors of each dot product
+ *   y      <-- second vectors of each dot product, or NULL
+ *   acc    --> resulting accumulators (size: n_dots)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_dot_rsum(cs_lnum_t          n,
+            int                n_dots,
+            const cs_real_t   *x[],
+            const cs_real_t   *y[],
+            cs_blas_rsum_t     acc[]);
+
 /*----------------------------------------------------------------------------
  * Constant times a vector plus a vector: y <-- ax + y
  *
@@ -279,6 +499,113 @@ cs_dot_xx_yy_xy_xz_yz(cs_lnum_t                    n,
                       double                      *xz,
                       double                      *yz);
 
+/*----------------------------------------------------------------------------
+ * Constant times a vector plus a vector, followed by the dot product
+ * of the result with another vector: y <-- ax + y; return y.z
+ *
+ * Both operations are fused in a single pass over the data.
+ *
+ * parameters:
+ *   n <-- size of arrays x, y, and z
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values
+ *   y <-> array of floating-point values
+ *   z <-- array of floating-point values
+ *
+ * returns:
+ *   local y.z dot product (after update of y)
+ *----------------------------------------------------------------------------*/
+
+double
+cs_axpy_dot(cs_lnum_t                    n,
+            double                       a,
+            const cs_real_t  *restrict   x,
+            cs_real_t        *restrict   y,
+            const cs_real_t  *restrict   z);
+
+/*----------------------------------------------------------------------------
+ * Constant times a vector plus a vector, followed by the dot product
+ * of the result with itself: y <-- ax + y; return y.y
+ *
+ * Both operations are fused in a single pass over the data.
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values
+ *   y <-> array of floating-point values
+ *
+ * returns:
+ *   local y.y dot product (after update of y)
+ *----------------------------------------------------------------------------*/
+
+double
+cs_axpy_dot_xx(cs_lnum_t                    n,
+               double                       a,
+               const cs_real_t  *restrict   x,
+               cs_real_t        *restrict   y);
+
+/*----------------------------------------------------------------------------
+ * Two constant times a vector plus a vector operations, followed by
+ * the dot product of the second result with itself:
+ * y <-- ax + y; w <-- bz + w; return w.w
+ *
+ * All operations are fused in a single pass over the data.
+ *
+ * parameters:
+ *   n <-- size of arrays x, y, z, and w
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values
+ *   y <-> array of floating-point values
+ *   b <-- multiplier for z
+ *   z <-- array of floating-point values
+ *   w <-> array of floating-point values
+ *
+ * returns:
+ *   local w.w dot product (after update of w)
+ *----------------------------------------------------------------------------*/
+
+double
+cs_axpy2_dot_xx(cs_lnum_t                    n,
+                double                       a,
+                const cs_real_t  *restrict   x,
+                cs_real_t        *restrict   y,
+                double                       b,
+                const cs_real_t  *restrict   z,
+                cs_real_t        *restrict   w);
+
+/*----------------------------------------------------------------------------
+ * Two constant times a vector plus a vector operations, followed by
+ * 2 dot products of the second result:
+ * y <-- ax + y; w <-- bz + w; ww = w.w; wv = w.v
+ *
+ * All operations are fused in a single pass over the data.
+ *
+ * parameters:
+ *   n  <-- size of arrays x, y, z, w, and v
+ *   a  <-- multiplier for x
+ *   x  <-- array of floating-point values
+ *   y  <-> array of floating-point values
+ *   b  <-- multiplier for z
+ *   z  <-- array of floating-point values
+ *   w  <-> array of floating-point values
+ *   v  <-- array of floating-point values
+ *   ww --> local w.w dot product (after update of w)
+ *   wv --> local w.v dot product (after update of w)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_axpy2_dot_xx_xy(cs_lnum_t                    n,
+                   double                       a,
+                   const cs_real_t  *restrict   x,
+                   cs_real_t        *restrict   y,
+                   double                       b,
+                   const cs_real_t  *restrict   z,
+                   cs_real_t        *restrict   w,
+                   const cs_real_t  *restrict   v,
+                   double                      *ww,
+                   double                      *wv);
+
 /*----------------------------------------------------------------------------
  * Return the global dot product of 2 vectors: x.y
  *
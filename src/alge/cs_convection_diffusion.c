@@ -61,6 +61,7 @@
 #include "cs_gradient.h"
 #include "cs_gradient_perio.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_matrix_building.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
@@ -103,6 +104,37 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/* Arguments for fused interior face convection/diffusion kernels */
+
+typedef struct {
+
+  int                 iconvp;        /* convection flag */
+  int                 idiffp;        /* diffusion flag */
+  int                 imasac;        /* take mass accumulation into account? */
+  cs_real_t           thetap;        /* theta-scheme weight for the balance */
+  cs_real_t           blencp;        /* proportion of 2nd order scheme */
+  cs_real_t           blend_st;      /* upwind proportion after slope test */
+  cs_real_t           thetam;        /* theta-scheme weight for the matrix */
+
+  const cs_real_t    *pvar;          /* variable values */
+  const cs_real_3_t  *grad;          /* variable gradient */
+  const cs_real_3_t  *gradst;        /* slope test gradient, or NULL */
+  const cs_real_t    *i_massflux;    /* interior face mass flux */
+  const cs_real_t    *i_visc;        /* interior face viscosity (balance) */
+  const cs_real_t    *i_viscm;       /* interior face viscosity (matrix) */
+
+  cs_real_t          *v_slope_test;  /* slope test tracking field, or NULL */
+  cs_real_t          *rhs;           /* right hand side (balance) */
+  cs_real_t          *da;            /* matrix diagonal, or NULL */
+  cs_real_2_t        *xa;            /* matrix extra-diagonal, or NULL */
+
+} _i_cd_scalar_args_t;
+
+/* Fused interior face convection/diffusion kernel function pointer type */
+
+typedef cs_gnum_t
+(_i_cd_scalar_fused_t) (const _i_cd_scalar_args_t  *a);
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -653,6 +685,354 @@ _max_limiter_num(const int           f_id,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Fused interior face kernel for the convection/diffusion balance of a
+ * scalar with the unsteady algorithm, also building the matrix coefficients
+ * (upwind convection, non-reconstructed diffusion) in the same face
+ * traversal when a->da is non-NULL.
+ *
+ * This function is always inlined in the _i_cd_scalar_fused_* variants
+ * below, with constant scheme arguments, so that each supported combination
+ * of options is compiled as a specialized loop, with no per-face branching
+ * on scheme options.
+ *
+ * The matrix extra-diagonal coefficients are assigned, and their
+ * contributions added to the diagonal.
+ *
+ * parameters:
+ *   ischcp      <-- convection scheme: -1 for pure upwind,
+ *                   0 for legacy SOLU, 1 for centered
+ *   reconstruct <-- reconstruct values at I' and J' ?
+ *   slope_test  <-- apply slope test ?
+ *   a           <-> kernel arguments
+ *
+ * returns:
+ *   number of local faces switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_i_cd_scalar_fused(const int                    ischcp,
+                   const bool                   reconstruct,
+                   const bool                   slope_test,
+                   const _i_cd_scalar_args_t   *a)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  const int iconvp = a->iconvp;
+  const int idiffp = a->idiffp;
+  const int imasac = a->imasac;
+  const cs_real_t thetap = a->thetap;
+  const cs_real_t blencp = a->blencp;
+  const cs_real_t blend_st = a->blend_st;
+  const cs_real_t thetam = a->thetam;
+
+  const cs_real_t *restrict pvar = a->pvar;
+  const cs_real_3_t *restrict grad = a->grad;
+  const cs_real_3_t *restrict gradst = a->gradst;
+  const cs_real_t *restrict i_massflux = a->i_massflux;
+  const cs_real_t *restrict i_visc = a->i_visc;
+  const cs_real_t *restrict i_viscm = a->i_viscm;
+
+  cs_real_t *restrict v_slope_test = a->v_slope_test;
+  cs_real_t *restrict rhs = a->rhs;
+  cs_real_t *restrict da = a->da;
+  cs_real_2_t *restrict xa = a->xa;
+
+  cs_gnum_t n_upwind = 0;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for reduction(+:n_upwind)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        const cs_real_t pi = pvar[ii];
+        const cs_real_t pj = pvar[jj];
+        const cs_real_t i_mf = i_massflux[face_id];
+
+        /* Values at I' and J' */
+
+        cs_real_t pip = pi, pjp = pj;
+
+        if (reconstruct) {
+          cs_real_t recoi, recoj;
+          cs_i_compute_quantities(1.,
+                                  diipf[face_id],
+                                  djjpf[face_id],
+                                  grad[ii],
+                                  grad[jj],
+                                  pi,
+                                  pj,
+                                  &recoi,
+                                  &recoj,
+                                  &pip,
+                                  &pjp);
+        }
+
+        /* Convected face values */
+
+        cs_real_t pif = pi, pjf = pj;
+
+        if (ischcp < 0) {
+          /* in parallel, face will be counted by one and only one rank */
+          if (ii < n_cells)
+            n_upwind++;
+        }
+        else if (iconvp > 0) {
+
+          if (ischcp == 1) {
+            cs_centered_f_val(weight[face_id], pip, pjp, &pif);
+            cs_centered_f_val(weight[face_id], pip, pjp, &pjf);
+          }
+          else {
+            cs_solu_f_val(cell_cen[ii], i_face_cog[face_id], grad[ii],
+                          pi, &pif);
+            cs_solu_f_val(cell_cen[jj], i_face_cog[face_id], grad[jj],
+                          pj, &pjf);
+          }
+
+          if (slope_test) {
+
+            cs_real_t testij, tesqck;
+
+            cs_slope_test(pi,
+                          pj,
+                          i_dist[face_id],
+                          i_face_surf[face_id],
+                          i_face_normal[face_id],
+                          grad[ii],
+                          grad[jj],
+                          gradst[ii],
+                          gradst[jj],
+                          i_mf,
+                          &testij,
+                          &tesqck);
+
+            if (tesqck <= 0. || testij <= 0.) {
+
+              cs_blend_f_val(blend_st, pi, &pif);
+              cs_blend_f_val(blend_st, pj, &pjf);
+
+              /* in parallel, face will be counted by one and only one rank */
+              if (ii < n_cells)
+                n_upwind++;
+
+              if (v_slope_test != NULL) {
+                v_slope_test[ii] += fabs(i_mf) / cell_vol[ii];
+                v_slope_test[jj] += fabs(i_mf) / cell_vol[jj];
+              }
+
+            }
+
+          }
+
+          cs_blend_f_val(blencp, pi, &pif);
+          cs_blend_f_val(blencp, pj, &pjf);
+
+        }
+
+        /* Fluxes */
+
+        cs_real_2_t fluxij = {0., 0.};
+
+        cs_i_conv_flux(iconvp,
+                       thetap,
+                       imasac,
+                       pi,
+                       pj,
+                       pif,
+                       pif, /* no relaxation */
+                       pjf,
+                       pjf, /* no relaxation */
+                       i_mf,
+                       1., /* xcpp */
+                       1., /* xcpp */
+                       fluxij);
+
+        cs_i_diff_flux(idiffp,
+                       thetap,
+                       pip,
+                       pjp,
+                       pip, /* no relaxation */
+                       pjp, /* no relaxation */
+                       i_visc[face_id],
+                       fluxij);
+
+        rhs[ii] -= fluxij[0];
+        rhs[jj] += fluxij[1];
+
+        /* Matrix coefficients (see cs_matrix_scalar) */
+
+        if (da != NULL) {
+
+          cs_real_t flui = 0.5*(i_mf - fabs(i_mf));
+          cs_real_t fluj =-0.5*(i_mf + fabs(i_mf));
+
+          xa[face_id][0] = thetam*(iconvp*flui - idiffp*i_viscm[face_id]);
+          xa[face_id][1] = thetam*(iconvp*fluj - idiffp*i_viscm[face_id]);
+
+          da[ii] -= xa[face_id][0] + iconvp*(1. - thetam)*i_mf;
+          da[jj] -= xa[face_id][1] - iconvp*(1. - thetam)*i_mf;
+
+        }
+
+      }
+    }
+  }
+
+  return n_upwind;
+}
+
+/*----------------------------------------------------------------------------
+ * Specialized variants of _i_cd_scalar_fused.
+ *
+ * Variant names indicate the convection scheme, and whether
+ * values are reconstructed (_r) and the slope test is used (_st).
+ *
+ * parameters:
+ *   a <-> kernel arguments
+ *
+ * returns:
+ *   number of local faces switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_i_cd_scalar_fused_upwind(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(-1, false, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_upwind_r(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(-1, true, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_solu(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(0, false, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_solu_r(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(0, true, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_solu_st(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(0, false, true, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_solu_r_st(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(0, true, true, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_centered(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(1, false, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_centered_r(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(1, true, false, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_centered_st(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(1, false, true, a);
+}
+
+static cs_gnum_t
+_i_cd_scalar_fused_centered_r_st(const _i_cd_scalar_args_t  *a)
+{
+  return _i_cd_scalar_fused(1, true, true, a);
+}
+
+/*----------------------------------------------------------------------------
+ * Select a fused interior face convection/diffusion kernel for a scalar.
+ *
+ * Fused kernels are available for the unsteady algorithm, with pure upwind,
+ * centered, or legacy SOLU convection, with or without reconstruction and
+ * slope test, and no local limiters.
+ *
+ * parameters:
+ *   idtvar     <-- indicator of the temporal scheme
+ *   iupwin     <-- 1 for pure upwind convection, 0 otherwise
+ *   ischcp     <-- convection scheme
+ *   isstpp     <-- slope test or limiter type
+ *   ircflp     <-- flux reconstruction indicator
+ *   df_limiter <-- diffusion limiter values, or NULL
+ *
+ * returns:
+ *   pointer to matching kernel, or NULL if not available
+ *----------------------------------------------------------------------------*/
+
+static _i_cd_scalar_fused_t *
+_i_cd_scalar_fused_kernel(int               idtvar,
+                          int               iupwin,
+                          int               ischcp,
+                          int               isstpp,
+                          int               ircflp,
+                          const cs_real_t  *df_limiter)
+{
+  /* Kernels indexed by scheme (upwind, SOLU, centered),
+     reconstruction, and slope test */
+
+  static _i_cd_scalar_fused_t *kernels[3][2][2]
+    = {{{_i_cd_scalar_fused_upwind, _i_cd_scalar_fused_upwind},
+        {_i_cd_scalar_fused_upwind_r, _i_cd_scalar_fused_upwind_r}},
+       {{_i_cd_scalar_fused_solu, _i_cd_scalar_fused_solu_st},
+        {_i_cd_scalar_fused_solu_r, _i_cd_scalar_fused_solu_r_st}},
+       {{_i_cd_scalar_fused_centered, _i_cd_scalar_fused_centered_st},
+        {_i_cd_scalar_fused_centered_r, _i_cd_scalar_fused_centered_r_st}}};
+
+  if (idtvar < 0 || df_limiter != NULL || ircflp < 0 || ircflp > 1)
+    return NULL;
+
+  if (iupwin == 1)
+    return kernels[0][ircflp][0];
+
+  if ((ischcp != 0 && ischcp != 1) || (isstpp != 0 && isstpp != 1))
+    return NULL;
+
+  return kernels[ischcp + 1][ircflp][(isstpp == 0) ? 1 : 0];
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1688,6 +2068,123 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                const cs_real_t           i_visc[],
                                const cs_real_t           b_visc[],
                                cs_real_t       *restrict rhs)
+{
+  cs_convection_diffusion_scalar_matrix(idtvar,
+                                        f_id,
+                                        var_cal_opt,
+                                        icvflb,
+                                        inc,
+                                        iccocg,
+                                        imasac,
+                                        pvar,
+                                        pvara,
+                                        icvfli,
+                                        coefap,
+                                        coefbp,
+                                        cofafp,
+                                        cofbfp,
+                                        i_massflux,
+                                        b_massflux,
+                                        i_visc,
+                                        b_visc,
+                                        rhs,
+                                        0., /* thetam */
+                                        NULL, /* rovsdt */
+                                        NULL, /* i_viscm */
+                                        NULL, /* b_viscm */
+                                        NULL, /* da */
+                                        NULL); /* xa */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the explicit part of the convection/diffusion terms of a
+ * standard transport equation of a scalar field \f$ \varia \f$, and
+ * optionally build the associated matrix.
+ *
+ * The right hand side is updated as in \ref cs_convection_diffusion_scalar.
+ *
+ * If \p da is non-NULL, the matrix of \ref cs_matrix_scalar (upwind
+ * convection, non-reconstructed diffusion, no Cp multiplier) is also built.
+ * For the unsteady algorithm with pure upwind, centered, or legacy SOLU
+ * schemes (with or without reconstruction and slope test) and no local
+ * limiters, a specialized kernel is used, which computes both the balance
+ * and the matrix coefficients in a single interior face traversal.
+ * Otherwise, the matrix is built separately.
+ *
+ * \param[in]     idtvar        indicator of the temporal scheme
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     var_cal_opt   variable calculation options
+ * \param[in]     icvflb        global indicator of boundary convection flux
+ *                               - 0 upwind scheme at all boundary faces
+ *                               - 1 imposed flux at some boundary faces
+ * \param[in]     inc           indicator
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     iccocg        indicator
+ *                               - 1 re-compute cocg matrix
+ *                                   (for iterative gradients)
+ *                               - 0 otherwise
+ * \param[in]     imasac        take mass accumulation into account?
+ * \param[in]     pvar          solved variable (current time step)
+ * \param[in]     pvara         solved variable (previous time step)
+ * \param[in]     icvfli        boundary face indicator array of convection flux
+ *                               - 0 upwind scheme
+ *                               - 1 imposed flux
+ * \param[in]     coefap        boundary condition array for the variable
+ *                               (explicit part)
+ * \param[in]     coefbp        boundary condition array for the variable
+ *                               (implicit part)
+ * \param[in]     cofafp        boundary condition array for the diffusion
+ *                               of the variable (explicit part)
+ * \param[in]     cofbfp        boundary condition array for the diffusion
+ *                               of the variable (implicit part)
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at boundary faces
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
+ * \param[in]     thetam        weighting coefficient for the theta-scheme
+ *                               for the matrix
+ * \param[in]     rovsdt        working array (matrix diagonal source)
+ * \param[in]     i_viscm       \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the matrix
+ * \param[in]     b_viscm       \f$ S_\fib \f$
+ *                               at border faces for the matrix
+ * \param[out]    da            diagonal part of the matrix, or NULL
+ * \param[out]    xa            extra interleaved diagonal part of the matrix,
+ *                               or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_scalar_matrix(int                       idtvar,
+                                      int                       f_id,
+                                      const cs_var_cal_opt_t    var_cal_opt,
+                                      int                       icvflb,
+                                      int                       inc,
+                                      int                       iccocg,
+                                      int                       imasac,
+                                      cs_real_t       *restrict pvar,
+                                      const cs_real_t *restrict pvara,
+                                      const cs_int_t            icvfli[],
+                                      const cs_real_t           coefap[],
+                                      const cs_real_t           coefbp[],
+                                      const cs_real_t           cofafp[],
+                                      const cs_real_t           cofbfp[],
+                                      const cs_real_t           i_massflux[],
+                                      const cs_real_t           b_massflux[],
+                                      const cs_real_t           i_visc[],
+                                      const cs_real_t           b_visc[],
+                                      cs_real_t       *restrict rhs,
+                                      double                    thetam,
+                                      const cs_real_t           rovsdt[],
+                                      const cs_real_t           i_viscm[],
+                                      const cs_real_t           b_viscm[],
+                                      cs_real_t       *restrict da,
+                                      cs_real_2_t     *restrict xa)
 {
   const int iconvp = var_cal_opt.iconv;
   const int idiffp = var_cal_opt.idiff;
@@ -2011,10 +2508,52 @@ cs_convection_diffusion_scalar(int                       idtvar,
     }
   }
 
+  /* --> Fused kernels for common option combinations
+    ==================================================*/
+
+  _i_cd_scalar_fused_t *i_cd_fused
+    = _i_cd_scalar_fused_kernel(idtvar, iupwin, ischcp, isstpp, ircflp,
+                                df_limiter);
+
+  /* Matrix built with the balance only when using fused kernels */
+
+  cs_real_t *_da = (i_cd_fused != NULL) ? da : NULL;
+
+  if (_da != NULL) {
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      _da[cell_id] = rovsdt[cell_id];
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++)
+      _da[cell_id] = 0.;
+  }
+
+  if (i_cd_fused != NULL) {
+
+    const _i_cd_scalar_args_t i_cd_args = {
+      .iconvp = iconvp,
+      .idiffp = idiffp,
+      .imasac = imasac,
+      .thetap = thetap,
+      .blencp = blencp,
+      .blend_st = blend_st,
+      .thetam = thetam,
+      .pvar = _pvar,
+      .grad = (const cs_real_3_t *)grad,
+      .gradst = (const cs_real_3_t *)gradst,
+      .i_massflux = i_massflux,
+      .i_visc = i_visc,
+      .i_viscm = i_viscm,
+      .v_slope_test = v_slope_test,
+      .rhs = rhs,
+      .da = _da,
+      .xa = xa};
+
+    n_upwind = i_cd_fused(&i_cd_args);
+
   /* --> Pure upwind flux
     =====================*/
 
-  if (iupwin == 1) {
+  } else if (iupwin == 1) {
 
     /* Steady */
     if (idtvar < 0) {
@@ -2750,6 +3289,15 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
             rhs[ii] -= fluxi;
 
+            /* Matrix diagonal (see cs_matrix_scalar) */
+            if (_da != NULL) {
+              cs_real_t flui = 0.5*(  b_massflux[face_id]
+                                    - fabs(b_massflux[face_id]));
+              _da[ii] +=   iconvp*(  flui*thetam*(coefbp[face_id]-1.)
+                                   - (1.-thetam)*b_massflux[face_id])
+                         + idiffp*thetam*b_viscm[face_id]*cofbfp[face_id];
+            }
+
           }
         }
       }
@@ -2966,6 +3514,15 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
             rhs[ii] -= fluxi;
 
+            /* Matrix diagonal (see cs_matrix_scalar) */
+            if (_da != NULL) {
+              cs_real_t flui = 0.5*(  b_massflux[face_id]
+                                    - fabs(b_massflux[face_id]));
+              _da[ii] +=   iconvp*(  flui*thetam*(coefbp[face_id]-1.)
+                                   - (1.-thetam)*b_massflux[face_id])
+                         + idiffp*thetam*b_viscm[face_id]*cofbfp[face_id];
+            }
+
           }
         }
       }
@@ -2973,6 +3530,25 @@ cs_convection_diffusion_scalar(int                       idtvar,
     }
   }
 
+  /* Matrix, if not built with the balance */
+
+  if (da != NULL && _da == NULL)
+    cs_matrix_scalar(m,
+                     iconvp,
+                     idiffp,
+                     thetam,
+                     0, /* imucpp */
+                     coefbp,
+                     cofbfp,
+                     rovsdt,
+                     i_massflux,
+                     b_massflux,
+                     i_viscm,
+                     b_viscm,
+                     NULL, /* xcpp */
+                     da,
+                     xa);
+
   /* Free memory */
   BFT_FREE(grad);
   BFT_FREE(gradup);
@@ -5717,6 +5717,96 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                const cs_real_t           b_visc[],
                                cs_real_t       *restrict rhs);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the explicit part of the convection/diffusion terms of a
+ * standard transport equation of a scalar field \f$ \varia \f$, and
+ * optionally build the associated matrix.
+ *
+ * The right hand side is updated as in \ref cs_convection_diffusion_scalar.
+ *
+ * If \p da is non-NULL, the matrix of \ref cs_matrix_scalar (upwind
+ * convection, non-reconstructed diffusion, no Cp multiplier) is also built.
+ * For the unsteady algorithm with pure upwind, centered, or legacy SOLU
+ * schemes (with or without reconstruction and slope test) and no local
+ * limiters, a specialized kernel is used, which computes both the balance
+ * and the matrix coefficients in a single interior face traversal.
+ * Otherwise, the matrix is built separately.
+ *
+ * \param[in]     idtvar        indicator of the temporal scheme
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     var_cal_opt   variable calculation options
+ * \param[in]     icvflb        global indicator of boundary convection flux
+ *                               - 0 upwind scheme at all boundary faces
+ *                               - 1 imposed flux at some boundary faces
+ * \param[in]     inc           indicator
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     iccocg        indicator
+ *                               - 1 re-compute cocg matrix
+ *                                   (for iterative gradients)
+ *                               - 0 otherwise
+ * \param[in]     imasac        take mass accumulation into account?
+ * \param[in]     pvar          solved variable (current time step)
+ * \param[in]     pvara         solved variable (previous time step)
+ * \param[in]     icvfli        boundary face indicator array of convection flux
+ *                               - 0 upwind scheme
+ *                               - 1 imposed flux
+ * \param[in]     coefap        boundary condition array for the variable
+ *                               (explicit part)
+ * \param[in]     coefbp        boundary condition array for the variable
+ *                               (implicit part)
+ * \param[in]     cofafp        boundary condition array for the diffusion
+ *                               of the variable (explicit part)
+ * \param[in]     cofbfp        boundary condition array for the diffusion
+ *                               of the variable (implicit part)
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at boundary faces
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
+ * \param[in]     thetam        weighting coefficient for the theta-scheme
+ *                               for the matrix
+ * \param[in]     rovsdt        working array (matrix diagonal source)
+ * \param[in]     i_viscm       \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the matrix
+ * \param[in]     b_viscm       \f$ S_\fib \f$
+ *                               at border faces for the matrix
+ * \param[out]    da            diagonal part of the matrix, or NULL
+ * \param[out]    xa            extra interleaved diagonal part of the matrix,
+ *                               or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_scalar_matrix(int                       idtvar,
+                                      int                       f_id,
+                                      const cs_var_cal_opt_t    var_cal_opt,
+                                      int                       icvflb,
+                                      int                       inc,
+                                      int                       iccocg,
+                                      int                       imasac,
+                                      cs_real_t       *restrict pvar,
+                                      const cs_real_t *restrict pvara,
+                                      const cs_int_t            icvfli[],
+                                      const cs_real_t           coefap[],
+                                      const cs_real_t           coefbp[],
+                                      const cs_real_t           cofafp[],
+                                      const cs_real_t           cofbfp[],
+                                      const cs_real_t           i_massflux[],
+                                      const cs_real_t           b_massflux[],
+                                      const cs_real_t           i_visc[],
+                                      const cs_real_t           b_visc[],
+                                      cs_real_t       *restrict rhs,
+                                      double                    thetam,
+                                      const cs_real_t           rovsdt[],
+                                      const cs_real_t           i_viscm[],
+                                      const cs_real_t           b_viscm[],
+                                      cs_real_t       *restrict da,
+                                      cs_real_2_t     *restrict xa);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * <a name="cs_face_convection_scalar"></a>
@@ -171,6 +171,11 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+/* Use cell-based (gather) rather than face-based (scatter) kernels
+   for each gradient type, when available */
+
+static bool _gradient_cell_gather[] = {false, false, false, false};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -2929,6 +2934,248 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   BFT_FREE(rhsv);
 }
 
+/*----------------------------------------------------------------------------
+ * Return mesh adjacencies with cell -> interior faces connectivity,
+ * building the latter if needed.
+ *
+ * returns:
+ *   pointer to global mesh adjacencies structure
+ *----------------------------------------------------------------------------*/
+
+static const cs_mesh_adjacencies_t *
+_gather_adjacencies(void)
+{
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  if (ma->cell_i_faces_idx == NULL)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  return ma;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradient using least-squares reconstruction for non-orthogonal
+ * meshes (nswrgp > 1), using a cell-based (gather) formulation.
+ *
+ * This variant is equivalent to the standard case (without hydrostatic
+ * pressure or internal coupling) of _lsq_scalar_gradient, but loops on
+ * cells and their adjacent faces, so that each cell's gradient is computed
+ * and written by a single thread, with no intermediate right-hand side
+ * array nor face numbering thread groups.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   idimtr         <-- 0 if ivar does not match a vector or tensor
+ *                        or there is no periodicity of rotation
+ *                      1 for velocity, 2 for Reynolds stress
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   extrap         <-- gradient extrapolation coefficient
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   c_weight       <-- weighted gradient coefficient variable,
+ *                      or NULL
+ *   grad           <-> gradient of pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_gather(const cs_mesh_t             *m,
+                            const cs_mesh_quantities_t  *fvq,
+                            cs_halo_type_t               halo_type,
+                            bool                         recompute_cocg,
+                            int                          idimtr,
+                            cs_real_t                    inc,
+                            cs_real_t                    extrap,
+                            const cs_real_t              coefap[],
+                            const cs_real_t              coefbp[],
+                            const cs_real_t              pvar[],
+                            const cs_real_t    *restrict c_weight,
+                            cs_real_3_t        *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+
+  const cs_mesh_adjacencies_t *ma = _gather_adjacencies();
+
+  const cs_lnum_t *restrict c2f_idx = ma->cell_i_faces_idx;
+  const cs_lnum_t *restrict c2f = ma->cell_i_faces;
+  const cs_lnum_t *restrict c2b_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict c2b = ma->cell_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_cells
+    = (const cs_lnum_t *restrict)m->b_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  /* Recompute cocg at boundaries, using saved cocgb */
+
+  if (recompute_cocg) {
+
+#   pragma omp parallel for if(n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+
+      cs_lnum_t c_id = b_cells[ii];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++) {
+        for (cs_lnum_t mm = 0; mm < 3; mm++)
+          cocg[c_id][ll][mm] = cocgb[ii][ll][mm];
+      }
+
+      for (cs_lnum_t i = c2b_idx[c_id]; i < c2b_idx[c_id+1]; i++) {
+
+        cs_lnum_t f_id = c2b[i];
+        cs_real_3_t dddij;
+
+        cs_real_t extrab = 1. - isympa[f_id]*extrap*coefbp[f_id];
+        cs_real_t umcbdd = extrab * (1. - coefbp[f_id]) / b_dist[f_id];
+        cs_real_t udbfs = extrab / b_face_surf[f_id];
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                      + umcbdd * diipb[f_id][ll];
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            cocg[c_id][ll][mm] += dddij[ll]*dddij[mm];
+        }
+
+      }
+
+      cs_math_33_inv_cramer_sym_in_place(cocg[c_id]);
+
+    }
+
+  } /* End of recompute_cocg */
+
+  /* Compute right-hand side and gradient for each cell */
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_real_t rhs[3] = {0., 0., 0.};
+    const cs_real_t p_c = pvar[c_id];
+
+    /* Contribution from interior faces */
+
+    for (cs_lnum_t i = c2f_idx[c_id]; i < c2f_idx[c_id+1]; i++) {
+
+      cs_lnum_t f_id = c2f[i];
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      cs_lnum_t d_id = c_id1 + c_id2 - c_id;
+
+      cs_real_t dc[3];
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dc[ll] = cell_cen[d_id][ll] - cell_cen[c_id][ll];
+
+      /* (P_j - P_i) / ||d||^2 */
+      cs_real_t pfac =   (pvar[d_id] - p_c)
+                       / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      if (c_weight != NULL) {
+        cs_real_t pond = weight[f_id];
+        pfac *= c_weight[d_id] / (  pond       *c_weight[c_id1]
+                                  + (1. - pond)*c_weight[c_id2]);
+      }
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] += dc[ll] * pfac;
+
+    }
+
+    /* Contribution from extended neighborhood */
+
+    if (halo_type == CS_HALO_EXTENDED) {
+
+      for (cs_lnum_t cidx = cell_cells_idx[c_id];
+           cidx < cell_cells_idx[c_id+1];
+           cidx++) {
+
+        cs_lnum_t d_id = cell_cells_lst[cidx];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[d_id][ll] - cell_cen[c_id][ll];
+
+        cs_real_t pfac =   (pvar[d_id] - p_c)
+                         / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs[ll] += dc[ll] * pfac;
+
+      }
+
+    }
+
+    /* Contribution from boundary faces */
+
+    for (cs_lnum_t i = c2b_idx[c_id]; i < c2b_idx[c_id+1]; i++) {
+
+      cs_lnum_t f_id = c2b[i];
+      cs_real_3_t dsij;
+
+      cs_real_t extrab = pow((1. - isympa[f_id]*extrap*coefbp[f_id]), 2.0);
+      cs_real_t unddij = 1. / b_dist[f_id];
+      cs_real_t udbfs = 1. / b_face_surf[f_id];
+      cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                   + umcbdd*diipb[f_id][ll];
+
+      cs_real_t pfac =   (coefap[f_id]*inc + (coefbp[f_id] -1.)*p_c)
+                       * unddij * extrab;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] += dsij[ll] * pfac;
+
+    }
+
+    /* Compute gradient */
+
+    for (cs_lnum_t ll = 0; ll < 3; ll++)
+      grad[c_id][ll] =   cocg[c_id][ll][0] * rhs[0]
+                       + cocg[c_id][ll][1] * rhs[1]
+                       + cocg[c_id][ll][2] * rhs[2];
+
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1) in the anisotropic case.
@@ -3183,45 +3430,34 @@ _lsq_scalar_gradient_ani(const cs_mesh_t               *m,
 }
 
 /*----------------------------------------------------------------------------
- * Reconstruct the gradient of a scalar using a given gradient of
- * this scalar (typically lsq).
+ * Compute non-reconstructed cell gradients of multiple scalars using
+ * the Green-Gauss formula, with a single traversal of the mesh.
  *
- * Optionally, a volume force generating a hydrostatic pressure component
- * may be accounted for.
+ * Values and gradients are interleaved by field: the value of field k
+ * for cell c is pvar[c*n_fields + k].
  *
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   fvq            <-- pointer to associated finite volume quantities
- *   cpl            <-> structure associated with internal coupling, or NULL
- *   idimtr         <-- 0 if ivar does not match a vector or tensor
- *                        or there is no periodicity of rotation
- *                      1 for velocity, 2 for Reynolds stress
- *   hyd_p_flag     <-- flag for hydrostatic pressure
+ *   n_fields       <-- number of fields
  *   inc            <-- if 0, solve on increment; 1 otherwise
- *   f_ext          <-- exterior force generating pressure
- *   coefap         <-- B.C. coefficients for boundary face normals
- *   coefbp         <-- B.C. coefficients for boundary face normals
- *   c_weight       <-- weighted gradient coefficient variable
- *   c_var          <-- variable
- *   r_grad         <-- gradient used for reconstruction
- *   grad           <-> gradient of c_var (halo prepared for periodicity
- *                      of rotation)
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   pvar           <-- interleaved variables
+ *   grad           --> interleaved gradients
  *----------------------------------------------------------------------------*/
 
 static void
-_reconstruct_scalar_gradient(const cs_mesh_t                 *m,
-                             const cs_mesh_quantities_t      *fvq,
-                             const cs_internal_coupling_t    *cpl,
-                             int                              idimtr,
-                             int                              hyd_p_flag,
-                             cs_real_t                        inc,
-                             const cs_real_t                  f_ext[][3],
-                             const cs_real_t                  coefap[],
-                             const cs_real_t                  coefbp[],
-                             const cs_real_t                  c_weight[],
-                             const cs_real_t                  c_var[],
-                             cs_real_3_t            *restrict r_grad,
-                             cs_real_3_t            *restrict grad)
+_initialize_scalar_gradient_multi(const cs_mesh_t             *m,
+                                  const cs_mesh_quantities_t  *fvq,
+                                  int                          n_fields,
+                                  cs_real_t                    inc,
+                                  const cs_real_t       *const coefap[],
+                                  const cs_real_t       *const coefbp[],
+                                  const cs_real_t              pvar[],
+                                  cs_real_3_t        *restrict grad)
 {
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_cells = m->n_cells;
@@ -3244,82 +3480,562 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
   const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
   if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
     cell_f_vol = fvq->cell_vol;
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)fvq->cell_cen;
   const cs_real_3_t *restrict i_f_face_normal
     = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
   const cs_real_3_t *restrict b_f_face_normal
     = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict b_face_cog
-    = (const cs_real_3_t *restrict)fvq->b_face_cog;
-
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *restrict)fvq->diipb;
-
-  const cs_real_33_t *restrict corr_grad_lin
-    = (const cs_real_33_t *restrict)fvq->corr_grad_lin;
-
-  bool  *coupled_faces = (cpl == NULL) ?
-    NULL : (bool *)cpl->coupled_faces;
-
-  /*Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
-
-  cs_real_t *i_poro_duq_0;
-  cs_real_t *i_poro_duq_1;
-  cs_real_t *b_poro_duq;
-  cs_real_t _f_ext = 0.;
 
-  cs_lnum_t is_porous = 0;
-  if (f_i_poro_duq_0 != NULL) {
-    is_porous = 1;
-    i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
-  } else {
-    i_poro_duq_0 = &_f_ext;
-    i_poro_duq_1 = &_f_ext;
-    b_poro_duq = &_f_ext;
-  }
+  const cs_lnum_t nf = n_fields;
 
   /* Initialize gradient */
   /*---------------------*/
 
 # pragma omp parallel for
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+  for (cs_lnum_t i = 0; i < n_cells_ext*nf; i++) {
     for (int j = 0; j < 3; j++)
-      grad[cell_id][j] = 0.0;
+      grad[i][j] = 0.0;
   }
 
-  /* Case with hydrostatic pressure */
-  /*--------------------------------*/
+  /* Contribution from interior faces */
 
-  if (hyd_p_flag == 1) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* Contribution from interior faces */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
 
-        cs_real_t  fexd[3];
+        cs_real_t ktpond = weight[f_id];
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+        for (cs_lnum_t k = 0; k < nf; k++) {
 
-          cs_lnum_t c_id1 = i_face_cells[f_id][0];
-          cs_lnum_t c_id2 = i_face_cells[f_id][1];
+          cs_real_t dp = pvar[jj*nf + k] - pvar[ii*nf + k];
+          cs_real_t pfaci = (1.0-ktpond) * dp;
+          cs_real_t pfacj =     -ktpond  * dp;
 
-          cs_real_t ktpond = (c_weight == NULL) ?
-             weight[f_id] :              /* no cell weighting */
-             weight[f_id] * c_weight[c_id1] /* cell weighting active */
-               / (      weight[f_id] * c_weight[c_id1]
+          for (int j = 0; j < 3; j++) {
+            grad[ii*nf + k][j] += pfaci * i_f_face_normal[f_id][j];
+            grad[jj*nf + k][j] -= pfacj * i_f_face_normal[f_id][j];
+          }
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        for (cs_lnum_t k = 0; k < nf; k++) {
+
+          cs_real_t pfac =   inc*coefap[k][f_id]
+                           + (coefbp[k][f_id]-1.0)*pvar[ii*nf + k];
+
+          for (int j = 0; j < 3; j++)
+            grad[ii*nf + k][j] += pfac * b_f_face_normal[f_id][j];
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    cs_real_t dvol;
+    /* Is the cell disabled (for solid or porous)? */
+    if (has_dc * c_disable_flag[has_dc * cell_id] == 0)
+      dvol = 1. / cell_f_vol[cell_id];
+    else
+      dvol = 0.;
+
+    for (cs_lnum_t k = 0; k < nf; k++) {
+      for (int j = 0; j < 3; j++)
+        grad[cell_id*nf + k][j] *= dvol;
+    }
+  }
+
+  /* Synchronize halos (single exchange for all fields) */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_EXTENDED,
+                             (cs_real_t *)grad, 3*nf);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalars using least-squares
+ * reconstruction, with a single traversal of the mesh.
+ *
+ * Values and gradients are interleaved by field: the value of field k
+ * for cell c is pvar[c*n_fields + k]. Geometric quantities are loaded
+ * once per face for all fields.
+ *
+ * As boundary cell cocg matrices depend on each field's boundary
+ * conditions, they are computed in a work array when recompute_cocg
+ * is true, leaving the shared cocg array unchanged.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_fields       <-- number of fields
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   extrap         <-- gradient extrapolation coefficient
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   pvar           <-- interleaved variables
+ *   grad           --> interleaved gradients
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t             *m,
+                           const cs_mesh_quantities_t  *fvq,
+                           cs_halo_type_t               halo_type,
+                           bool                         recompute_cocg,
+                           int                          n_fields,
+                           cs_real_t                    inc,
+                           cs_real_t                    extrap,
+                           const cs_real_t       *const coefap[],
+                           const cs_real_t       *const coefbp[],
+                           const cs_real_t              pvar[],
+                           cs_real_3_t        *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+
+  const cs_lnum_t nf = n_fields;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  /* Compute boundary cell cocg for each field */
+
+  cs_lnum_t *b_cell_id = NULL;
+  cs_real_33_t *b_cocg = NULL;
+
+  if (recompute_cocg) {
+
+    BFT_MALLOC(b_cell_id, n_cells, cs_lnum_t);
+    BFT_MALLOC(b_cocg, n_b_cells*nf, cs_real_33_t);
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      b_cell_id[c_id] = -1;
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      b_cell_id[m->b_cells[ii]] = ii;
+      for (cs_lnum_t k = 0; k < nf; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            b_cocg[ii*nf + k][ll][mm] = cocgb[ii][ll][mm];
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t ii = b_cell_id[b_face_cells[f_id]];
+
+          cs_real_t udbfs_0 = 1. / b_face_surf[f_id];
+          cs_real_t unddij = 1. / b_dist[f_id];
+
+          for (cs_lnum_t k = 0; k < nf; k++) {
+
+            cs_real_t extrab = 1. - isympa[f_id]*extrap*coefbp[k][f_id];
+
+            cs_real_t umcbdd = extrab * (1. - coefbp[k][f_id]) * unddij;
+            cs_real_t udbfs = extrab * udbfs_0;
+
+            cs_real_3_t dddij;
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                          + umcbdd * diipb[f_id][ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              for (cs_lnum_t mm = 0; mm < 3; mm++)
+                b_cocg[ii*nf + k][ll][mm] += dddij[ll]*dddij[mm];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+#   pragma omp parallel for
+    for (cs_lnum_t i = 0; i < n_b_cells*nf; i++)
+      cs_math_33_inv_cramer_sym_in_place(b_cocg[i]);
+
+  } /* End of recompute_cocg */
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+  cs_real_3_t  *restrict rhs;
+  BFT_MALLOC(rhs, n_cells_ext*nf, cs_real_3_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t i = 0; i < n_cells_ext*nf; i++) {
+    rhs[i][0] = 0.0;
+    rhs[i][1] = 0.0;
+    rhs[i][2] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_3_t dc;
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        const cs_real_t *restrict pvar_i = pvar + ii*nf;
+        const cs_real_t *restrict pvar_j = pvar + jj*nf;
+        cs_real_3_t *restrict rhs_i = rhs + ii*nf;
+        cs_real_3_t *restrict rhs_j = rhs + jj*nf;
+
+        for (cs_lnum_t k = 0; k < nf; k++) {
+
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac = (pvar_j[k] - pvar_i[k]) * ddc;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            rhs_i[k][ll] += dc[ll] * pfac;
+            rhs_j[k][ll] += dc[ll] * pfac;
+          }
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_3_t dc;
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t k = 0; k < nf; k++) {
+          cs_real_t pfac = (pvar[jj*nf + k] - pvar[ii*nf + k]) * ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs[ii*nf + k][ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+        for (cs_lnum_t k = 0; k < nf; k++) {
+
+          cs_real_t extrab
+            = pow((1. - isympa[f_id]*extrap*coefbp[k][f_id]), 2.0);
+          cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
+
+          cs_real_3_t dsij;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                       + umcbdd*diipb[f_id][ll];
+
+          cs_real_t pfac
+            =   (  coefap[k][f_id]*inc
+                 + (coefbp[k][f_id] -1.)*pvar[ii*nf + k])
+              * unddij * extrab;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs[ii*nf + k][ll] += dsij[ll] * pfac;
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Compute gradient */
+  /*------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_lnum_t b_id = (b_cell_id != NULL) ? b_cell_id[c_id] : -1;
+
+    for (cs_lnum_t k = 0; k < nf; k++) {
+
+      cs_real_t (*restrict c_cocg)[3]
+        = (b_id > -1) ? b_cocg[b_id*nf + k] : cocg[c_id];
+      const cs_real_t *restrict c_rhs = rhs[c_id*nf + k];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[c_id*nf + k][ll] =   c_cocg[ll][0] * c_rhs[0]
+                                + c_cocg[ll][1] * c_rhs[1]
+                                + c_cocg[ll][2] * c_rhs[2];
+
+    }
+
+  }
+
+  /* Synchronize halos (single exchange for all fields) */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                             (cs_real_t *)grad, 3*nf);
+
+  BFT_FREE(rhs);
+  BFT_FREE(b_cocg);
+  BFT_FREE(b_cell_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Reconstruct the gradient of a scalar using a given gradient of
+ * this scalar (typically lsq).
+ *
+ * Optionally, a volume force generating a hydrostatic pressure component
+ * may be accounted for.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   cpl            <-> structure associated with internal coupling, or NULL
+ *   idimtr         <-- 0 if ivar does not match a vector or tensor
+ *                        or there is no periodicity of rotation
+ *                      1 for velocity, 2 for Reynolds stress
+ *   hyd_p_flag     <-- flag for hydrostatic pressure
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   f_ext          <-- exterior force generating pressure
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   c_weight       <-- weighted gradient coefficient variable
+ *   c_var          <-- variable
+ *   r_grad         <-- gradient used for reconstruction
+ *   grad           <-> gradient of c_var (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_reconstruct_scalar_gradient(const cs_mesh_t                 *m,
+                             const cs_mesh_quantities_t      *fvq,
+                             const cs_internal_coupling_t    *cpl,
+                             int                              idimtr,
+                             int                              hyd_p_flag,
+                             cs_real_t                        inc,
+                             const cs_real_t                  f_ext[][3],
+                             const cs_real_t                  coefap[],
+                             const cs_real_t                  coefbp[],
+                             const cs_real_t                  c_weight[],
+                             const cs_real_t                  c_var[],
+                             cs_real_3_t            *restrict r_grad,
+                             cs_real_3_t            *restrict grad)
+{
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const int *restrict c_disable_flag = fvq->c_disable_flag;
+  int has_dc = fvq->has_disable_flag; /* Has cells disabled? */
+
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
+    cell_f_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
+  const cs_real_3_t *restrict b_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)fvq->b_face_cog;
+
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *restrict)fvq->dofij;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const cs_real_33_t *restrict corr_grad_lin
+    = (const cs_real_33_t *restrict)fvq->corr_grad_lin;
+
+  bool  *coupled_faces = (cpl == NULL) ?
+    NULL : (bool *)cpl->coupled_faces;
+
+  /*Additional terms due to porosity */
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+
+  cs_real_t *i_poro_duq_0;
+  cs_real_t *i_poro_duq_1;
+  cs_real_t *b_poro_duq;
+  cs_real_t _f_ext = 0.;
+
+  cs_lnum_t is_porous = 0;
+  if (f_i_poro_duq_0 != NULL) {
+    is_porous = 1;
+    i_poro_duq_0 = f_i_poro_duq_0->val;
+    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
+    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+  } else {
+    i_poro_duq_0 = &_f_ext;
+    i_poro_duq_1 = &_f_ext;
+    b_poro_duq = &_f_ext;
+  }
+
+  /* Initialize gradient */
+  /*---------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    for (int j = 0; j < 3; j++)
+      grad[cell_id][j] = 0.0;
+  }
+
+  /* Case with hydrostatic pressure */
+  /*--------------------------------*/
+
+  if (hyd_p_flag == 1) {
+
+    /* Contribution from interior faces */
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        cs_real_t  fexd[3];
+
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t c_id1 = i_face_cells[f_id][0];
+          cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+          cs_real_t ktpond = (c_weight == NULL) ?
+             weight[f_id] :              /* no cell weighting */
+             weight[f_id] * c_weight[c_id1] /* cell weighting active */
+               / (      weight[f_id] * c_weight[c_id1]
                  + (1.0-weight[f_id])* c_weight[c_id2]);
 
           cs_real_2_t poro = {
@@ -3487,80 +4203,238 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
 
     } /* loop on thread groups */
 
-    /* Contribution from coupled faces */
-    if (cpl != NULL) {
-      cs_internal_coupling_initialize_scalar_gradient(cpl, c_weight, c_var, grad);
-      cs_internal_coupling_reconstruct_scalar_gradient(cpl, r_grad, grad);
-    }
+    /* Contribution from coupled faces */
+    if (cpl != NULL) {
+      cs_internal_coupling_initialize_scalar_gradient(cpl, c_weight, c_var, grad);
+      cs_internal_coupling_reconstruct_scalar_gradient(cpl, r_grad, grad);
+    }
+
+    /* Contribution from boundary faces */
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
+
+          if (cpl == NULL || !coupled_faces[f_id]) {
+
+            cs_lnum_t c_id = b_face_cells[f_id];
+
+            /*
+               Remark: for the cell \f$ \celli \f$ we remove
+                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+             */
+
+            cs_real_t pfac =   inc*coefap[f_id]
+                             + (coefbp[f_id]-1.0)*c_var[c_id];
+
+            /* Reconstruction part */
+            cs_real_t
+              rfac =   coefbp[f_id]
+                     * (  diipb[f_id][0] * r_grad[c_id][0]
+                        + diipb[f_id][1] * r_grad[c_id][1]
+                        + diipb[f_id][2] * r_grad[c_id][2] );
+
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              grad[c_id][j] +=(pfac + rfac) * b_f_face_normal[f_id][j];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+  }
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_real_t dvol;
+    /* Is the cell disabled (for solid or porous)? Not the case if coupled */
+    if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+      dvol = 1. / cell_f_vol[c_id];
+    else
+      dvol = 0.;
+
+    grad[c_id][0] *= dvol;
+    grad[c_id][1] *= dvol;
+    grad[c_id][2] *= dvol;
+
+    if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION) {
+      cs_real_3_t gradpa;
+      for (int i = 0; i < 3; i++) {
+        gradpa[i] = grad[c_id][i];
+        grad[c_id][i] = 0.;
+      }
+
+      for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+          grad[c_id][i] += corr_grad_lin[c_id][i][j] * gradpa[j];
+    }
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, idimtr, grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Reconstruct the gradient of a scalar using a given gradient of
+ * this scalar (typically lsq), using a cell-based (gather) formulation.
+ *
+ * This variant is equivalent to the standard case (without hydrostatic
+ * pressure or internal coupling) of _reconstruct_scalar_gradient, but
+ * loops on cells and their adjacent faces, so that each cell's gradient
+ * is computed and written by a single thread.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   idimtr         <-- 0 if ivar does not match a vector or tensor
+ *                        or there is no periodicity of rotation
+ *                      1 for velocity, 2 for Reynolds stress
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   c_weight       <-- weighted gradient coefficient variable
+ *   c_var          <-- variable
+ *   r_grad         <-- gradient used for reconstruction
+ *   grad           <-> gradient of c_var (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_reconstruct_scalar_gradient_gather(const cs_mesh_t              *m,
+                                    const cs_mesh_quantities_t   *fvq,
+                                    int                           idimtr,
+                                    cs_real_t                     inc,
+                                    const cs_real_t               coefap[],
+                                    const cs_real_t               coefbp[],
+                                    const cs_real_t               c_weight[],
+                                    const cs_real_t               c_var[],
+                                    cs_real_3_t         *restrict r_grad,
+                                    cs_real_3_t         *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_mesh_adjacencies_t *ma = _gather_adjacencies();
+
+  const cs_lnum_t *restrict c2f_idx = ma->cell_i_faces_idx;
+  const cs_lnum_t *restrict c2f = ma->cell_i_faces;
+  const short int *restrict c2f_sgn = ma->cell_i_faces_sgn;
+  const cs_lnum_t *restrict c2b_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict c2b = ma->cell_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  const int *restrict c_disable_flag = fvq->c_disable_flag;
+  int has_dc = fvq->has_disable_flag; /* Has cells disabled? */
+
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
+    cell_f_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict i_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
+  const cs_real_3_t *restrict b_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
+
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *restrict)fvq->dofij;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const cs_real_33_t *restrict corr_grad_lin
+    = (const cs_real_33_t *restrict)fvq->corr_grad_lin;
+
+  const bool warped_correction
+    = (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION) ?
+      true : false;
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_real_t g[3] = {0., 0., 0.};
+
+    /* Contribution from interior faces;
+       for the face's second cell, the face normal is reversed. */
+
+    for (cs_lnum_t i = c2f_idx[c_id]; i < c2f_idx[c_id+1]; i++) {
 
-    /* Contribution from boundary faces */
+      cs_lnum_t f_id = c2f[i];
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+      cs_real_t ktpond = (c_weight == NULL) ?
+         weight[f_id] :              /* no cell weighting */
+         weight[f_id] * c_weight[c_id1] /* cell weighting active */
+           / (      weight[f_id] * c_weight[c_id1]
+             + (1.0-weight[f_id])* c_weight[c_id2]);
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      cs_real_t dvar = c_var[c_id2] - c_var[c_id1];
+      cs_real_t pfac = (c2f_sgn[i] > 0) ?
+        (1.0-ktpond) * dvar : -ktpond * dvar;
 
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
+      /* Reconstruction part */
+      cs_real_t rfac = 0.5 *
+                (dofij[f_id][0]*(r_grad[c_id1][0]+r_grad[c_id2][0])
+                +dofij[f_id][1]*(r_grad[c_id1][1]+r_grad[c_id2][1])
+                +dofij[f_id][2]*(r_grad[c_id1][2]+r_grad[c_id2][2]));
 
-          if (cpl == NULL || !coupled_faces[f_id]) {
+      cs_real_t sfac = c2f_sgn[i] * (pfac + rfac);
 
-            cs_lnum_t c_id = b_face_cells[f_id];
+      for (cs_lnum_t j = 0; j < 3; j++)
+        g[j] += sfac * i_f_face_normal[f_id][j];
 
-            /*
-               Remark: for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-             */
+    }
 
-            cs_real_t pfac =   inc*coefap[f_id]
-                             + (coefbp[f_id]-1.0)*c_var[c_id];
+    /* Contribution from boundary faces */
 
-            /* Reconstruction part */
-            cs_real_t
-              rfac =   coefbp[f_id]
-                     * (  diipb[f_id][0] * r_grad[c_id][0]
-                        + diipb[f_id][1] * r_grad[c_id][1]
-                        + diipb[f_id][2] * r_grad[c_id][2] );
+    for (cs_lnum_t i = c2b_idx[c_id]; i < c2b_idx[c_id+1]; i++) {
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              grad[c_id][j] +=(pfac + rfac) * b_f_face_normal[f_id][j];
-            }
+      cs_lnum_t f_id = c2b[i];
 
-          }
+      cs_real_t pfac =   inc*coefap[f_id]
+                       + (coefbp[f_id]-1.0)*c_var[c_id];
 
-        } /* loop on faces */
+      /* Reconstruction part */
+      cs_real_t
+        rfac =   coefbp[f_id]
+               * (  diipb[f_id][0] * r_grad[c_id][0]
+                  + diipb[f_id][1] * r_grad[c_id][1]
+                  + diipb[f_id][2] * r_grad[c_id][2] );
 
-      } /* loop on threads */
+      for (cs_lnum_t j = 0; j < 3; j++)
+        g[j] += (pfac + rfac) * b_f_face_normal[f_id][j];
 
-    } /* loop on thread groups */
+    }
 
-  }
+    /* Is the cell disabled (for solid or porous)? */
 
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     cs_real_t dvol;
-    /* Is the cell disabled (for solid or porous)? Not the case if coupled */
     if (has_dc * c_disable_flag[has_dc * c_id] == 0)
       dvol = 1. / cell_f_vol[c_id];
     else
       dvol = 0.;
 
-    grad[c_id][0] *= dvol;
-    grad[c_id][1] *= dvol;
-    grad[c_id][2] *= dvol;
-
-    if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION) {
-      cs_real_3_t gradpa;
-      for (int i = 0; i < 3; i++) {
-        gradpa[i] = grad[c_id][i];
-        grad[c_id][i] = 0.;
-      }
-
-      for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++)
-          grad[c_id][i] += corr_grad_lin[c_id][i][j] * gradpa[j];
+    if (warped_correction) {
+      for (int j = 0; j < 3; j++)
+        grad[c_id][j] = dvol * (  corr_grad_lin[c_id][j][0] * g[0]
+                                + corr_grad_lin[c_id][j][1] * g[1]
+                                + corr_grad_lin[c_id][j][2] * g[2]);
+    }
+    else {
+      for (int j = 0; j < 3; j++)
+        grad[c_id][j] = dvol * g[j];
     }
+
   }
 
   /* Synchronize halos */
@@ -7413,6 +8287,14 @@ _gradient_scalar(const char                    *var_name,
     bc_coeff_b = _bc_coeff_b;
   }
 
+  /* Cell-based (gather) variants handle the standard case only */
+
+  bool gather = (   _gradient_cell_gather[gradient_type]
+                 && cs_glob_mesh_adjacencies != NULL
+                 && cpl == NULL
+                 && hyd_p_flag != 1
+                 && !(w_stride == 6 && c_weight != NULL)) ? true : false;
+
   /* Allocate work arrays */
 
   /* Compute gradient */
@@ -7468,6 +8350,19 @@ _gradient_scalar(const char                    *var_name,
                                var,
                                (const cs_real_6_t *)c_weight,
                                grad);
+    else if (gather)
+      _lsq_scalar_gradient_gather(mesh,
+                                  fvq,
+                                  halo_type,
+                                  recompute_cocg,
+                                  tr_dim,
+                                  inc,
+                                  extrap,
+                                  bc_coeff_a,
+                                  bc_coeff_b,
+                                  var,
+                                  c_weight,
+                                  grad);
     else
       _lsq_scalar_gradient(mesh,
                            fvq,
@@ -7511,6 +8406,19 @@ _gradient_scalar(const char                    *var_name,
                                  var,
                                  (const cs_real_6_t *)c_weight,
                                  grad);
+      else if (gather)
+        _lsq_scalar_gradient_gather(mesh,
+                                    fvq,
+                                    halo_type,
+                                    recompute_cocg,
+                                    tr_dim,
+                                    inc,
+                                    extrap,
+                                    bc_coeff_a,
+                                    bc_coeff_b,
+                                    var,
+                                    c_weight,
+                                    r_grad);
       else
         _lsq_scalar_gradient(mesh,
                              fvq,
@@ -7536,19 +8444,31 @@ _gradient_scalar(const char                    *var_name,
                                 var_name,
                                 var, r_grad);
 
-      _reconstruct_scalar_gradient(mesh,
-                                   fvq,
-                                   cpl,
-                                   tr_dim,
-                                   hyd_p_flag,
-                                   inc,
-                                   (const cs_real_3_t *)f_ext,
-                                   bc_coeff_a,
-                                   bc_coeff_b,
-                                   c_weight,
-                                   var,
-                                   r_grad,
-                                   grad);
+      if (gather)
+        _reconstruct_scalar_gradient_gather(mesh,
+                                            fvq,
+                                            tr_dim,
+                                            inc,
+                                            bc_coeff_a,
+                                            bc_coeff_b,
+                                            c_weight,
+                                            var,
+                                            r_grad,
+                                            grad);
+      else
+        _reconstruct_scalar_gradient(mesh,
+                                     fvq,
+                                     cpl,
+                                     tr_dim,
+                                     hyd_p_flag,
+                                     inc,
+                                     (const cs_real_3_t *)f_ext,
+                                     bc_coeff_a,
+                                     bc_coeff_b,
+                                     c_weight,
+                                     var,
+                                     r_grad,
+                                     grad);
 
       BFT_FREE(r_grad);
     }
@@ -7578,6 +8498,183 @@ _gradient_scalar(const char                    *var_name,
   BFT_FREE(_bc_coeff_b);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields with
+ *         interleaved values.
+ *
+ * Least-squares and non-reconstructed Green-Gauss gradients are computed
+ * for all fields with a single mesh traversal; other cases are handled
+ * field by field.
+ *
+ * \param[in]       var_name        variable name
+ * \param[in]       gradient_info   performance logging structure, or NULL
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       epsilon         precision for iterative gradient
+ *                                  calculation
+ * \param[in]       extrap          boundary gradient extrapolation
+ *                                  coefficient
+ * \param[in]       n_fields        number of fields
+ * \param[in]       bc_coeff_a      boundary condition term a for each field
+ * \param[in]       bc_coeff_b      boundary condition term b for each field
+ * \param[in]       var             interleaved variables
+ *                                  (size: n_cells_ext*n_fields)
+ * \param[out]      grad            interleaved gradients
+ *                                  (size: n_cells_ext*n_fields)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_gradient_scalar_multi(const char                *var_name,
+                       cs_gradient_info_t        *gradient_info,
+                       cs_gradient_type_t         gradient_type,
+                       cs_halo_type_t             halo_type,
+                       int                        inc,
+                       bool                       recompute_cocg,
+                       int                        n_r_sweeps,
+                       int                        verbosity,
+                       double                     epsilon,
+                       double                     extrap,
+                       int                        n_fields,
+                       const cs_real_t     *const bc_coeff_a[],
+                       const cs_real_t     *const bc_coeff_b[],
+                       const cs_real_t            var[restrict],
+                       cs_real_3_t       *restrict grad)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t nf = n_fields;
+
+  /* Use Neumann BC's as default if not provided */
+
+  cs_real_t *_bc_coeff_a = NULL;
+  cs_real_t *_bc_coeff_b = NULL;
+
+  const cs_real_t **coefap, **coefbp;
+  BFT_MALLOC(coefap, nf, const cs_real_t *);
+  BFT_MALLOC(coefbp, nf, const cs_real_t *);
+
+  for (cs_lnum_t k = 0; k < nf; k++) {
+    coefap[k] = (bc_coeff_a != NULL) ? bc_coeff_a[k] : NULL;
+    coefbp[k] = (bc_coeff_b != NULL) ? bc_coeff_b[k] : NULL;
+    if (coefap[k] == NULL) {
+      if (_bc_coeff_a == NULL) {
+        BFT_MALLOC(_bc_coeff_a, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          _bc_coeff_a[i] = 0;
+      }
+      coefap[k] = _bc_coeff_a;
+    }
+    if (coefbp[k] == NULL) {
+      if (_bc_coeff_b == NULL) {
+        BFT_MALLOC(_bc_coeff_b, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          _bc_coeff_b[i] = 1;
+      }
+      coefbp[k] = _bc_coeff_b;
+    }
+  }
+
+  /* Batched computation when no per-field specific treatment is needed */
+
+  bool batched = true;
+
+  if (   mesh->have_rotation_perio
+      || (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION))
+    batched = false;
+
+  else if (gradient_type == CS_GRADIENT_LSQ)
+    _lsq_scalar_gradient_multi(mesh,
+                               fvq,
+                               halo_type,
+                               recompute_cocg,
+                               n_fields,
+                               inc,
+                               extrap,
+                               coefap,
+                               coefbp,
+                               var,
+                               grad);
+
+  else if (gradient_type == CS_GRADIENT_GREEN_ITER && n_r_sweeps < 2) {
+    _initialize_scalar_gradient_multi(mesh,
+                                      fvq,
+                                      n_fields,
+                                      inc,
+                                      coefap,
+                                      coefbp,
+                                      var,
+                                      grad);
+    if (gradient_info != NULL)
+      _gradient_info_update_iter(gradient_info, 0);
+  }
+
+  else
+    batched = false;
+
+  /* Otherwise, compute gradients field by field */
+
+  if (batched == false) {
+
+    cs_real_t *f_var;
+    cs_real_3_t *f_grad;
+    BFT_MALLOC(f_var, n_cells_ext, cs_real_t);
+    BFT_MALLOC(f_grad, n_cells_ext, cs_real_3_t);
+
+    for (cs_lnum_t k = 0; k < nf; k++) {
+
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+        f_var[c_id] = var[c_id*nf + k];
+
+      _gradient_scalar(var_name,
+                       gradient_info,
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       recompute_cocg,
+                       n_r_sweeps,
+                       0,                       /* tr_dim */
+                       0,                       /* hyd_p_flag */
+                       1,                       /* w_stride */
+                       verbosity,
+                       CS_GRADIENT_LIMIT_NONE,
+                       epsilon,
+                       extrap,
+                       1.5,                     /* clip_coeff (unused) */
+                       NULL,                    /* f_ext */
+                       coefap[k],
+                       coefbp[k],
+                       f_var,
+                       NULL,                    /* c_weight */
+                       NULL,                    /* cpl */
+                       f_grad);
+
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+        for (cs_lnum_t j = 0; j < 3; j++)
+          grad[c_id*nf + k][j] = f_grad[c_id][j];
+      }
+
+    }
+
+    BFT_FREE(f_grad);
+    BFT_FREE(f_var);
+
+  }
+
+  BFT_FREE(coefbp);
+  BFT_FREE(coefap);
+  BFT_FREE(_bc_coeff_a);
+  BFT_FREE(_bc_coeff_b);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -8879,6 +9976,54 @@ cs_gradient_free_quantities(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select cell-based (gather) or face-based (scatter) kernels
+ *         for a given gradient type.
+ *
+ * With the default face-based formulation, face contributions are
+ * scattered to adjacent cells, using the interior face numbering's thread
+ * groups to avoid write conflicts. With the cell-based formulation, each
+ * cell gathers contributions from its adjacent faces (using the
+ * cell -> faces adjacencies from \ref cs_glob_mesh_adjacencies), so
+ * each gradient value is written by a single thread.
+ *
+ * Cell-based kernels are currently available for the least-squares
+ * (\ref CS_GRADIENT_LSQ) and least-squares reconstructed Green-Gauss
+ * (\ref CS_GRADIENT_GREEN_LSQ) scalar gradients, in the standard case
+ * (no hydrostatic pressure, internal coupling, or anisotropic weighting).
+ * Other cases use the face-based kernels.
+ *
+ * \param[in]  gradient_type  gradient type
+ * \param[in]  gather         true for cell-based kernels,
+ *                            false for face-based kernels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_cell_gather(cs_gradient_type_t  gradient_type,
+                            bool                gather)
+{
+  _gradient_cell_gather[gradient_type] = gather;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether cell-based (gather) kernels are selected
+ *         for a given gradient type.
+ *
+ * \param[in]  gradient_type  gradient type
+ *
+ * \return  true if cell-based kernels are selected, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_cell_gather(cs_gradient_type_t  gradient_type)
+{
+  return _gradient_cell_gather[gradient_type];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -9007,6 +10152,200 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * Values and gradients of the n_fields fields are interleaved, so that
+ * the value of field k for cell c is var[c*n_fields + k], and its
+ * gradient grad[c*n_fields + k].
+ *
+ * For least-squares and non-reconstructed Green-Gauss gradients,
+ * all fields are handled with a single traversal of the mesh (so that
+ * connectivity and geometric quantities are loaded only once), and
+ * a single halo exchange for all fields is used for the input variables
+ * and resulting gradients. Other gradient types (or rotational periodicity)
+ * are handled field by field, still with a single input halo exchange.
+ *
+ * No clipping, cell weighting, hydrostatic pressure or internal coupling
+ * is handled here; \ref cs_gradient_scalar should be used in those cases.
+ *
+ * \param[in]       var_name        variable name (for logging)
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       epsilon         precision for iterative gradient
+ *                                  calculation
+ * \param[in]       extrap          boundary gradient extrapolation
+ *                                  coefficient
+ * \param[in]       n_fields        number of fields
+ * \param[in]       bc_coeff_a      boundary condition term a for each field,
+ *                                  or NULL
+ * \param[in]       bc_coeff_b      boundary condition term b for each field,
+ *                                  or NULL
+ * \param[in, out]  var             interleaved variables
+ *                                  (size: n_cells_ext*n_fields)
+ * \param[out]      grad            interleaved gradients
+ *                                  (size: n_cells_ext*n_fields)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         double                     epsilon,
+                         double                     extrap,
+                         int                        n_fields,
+                         const cs_real_t     *const bc_coeff_a[],
+                         const cs_real_t     *const bc_coeff_b[],
+                         cs_real_t                  var[restrict],
+                         cs_real_3_t       *restrict grad)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_gradient_info_t *gradient_info = NULL;
+  cs_timer_t t0, t1;
+
+  bool update_stats = true;
+
+  t0 = cs_timer_time();
+
+  if (update_stats == true)
+    gradient_info = _find_or_add_system(var_name, gradient_type);
+
+  /* Synchronize variables (single exchange for all fields) */
+
+  if (mesh->halo != NULL)
+    cs_halo_sync_var_strided(mesh->halo, halo_type, var, n_fields);
+
+  _gradient_scalar_multi(var_name,
+                         gradient_info,
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         recompute_cocg,
+                         n_r_sweeps,
+                         verbosity,
+                         epsilon,
+                         extrap,
+                         n_fields,
+                         bc_coeff_a,
+                         bc_coeff_b,
+                         var,
+                         grad);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  if (update_stats == true) {
+    gradient_info->n_calls += 1;
+    cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields, with
+ *         non-interleaved values.
+ *
+ * This variant of \ref cs_gradient_scalar_multi takes separate arrays
+ * for each field (such as field values), which are gathered in a temporary
+ * interleaved array; the resulting gradients (including ghost cells)
+ * are scattered back to separate arrays.
+ *
+ * \param[in]       var_name        variable name (for logging)
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       epsilon         precision for iterative gradient
+ *                                  calculation
+ * \param[in]       extrap          boundary gradient extrapolation
+ *                                  coefficient
+ * \param[in]       n_fields        number of fields
+ * \param[in]       bc_coeff_a      boundary condition term a for each field,
+ *                                  or NULL
+ * \param[in]       bc_coeff_b      boundary condition term b for each field,
+ *                                  or NULL
+ * \param[in]       var             variable array for each field
+ * \param[out]      grad            gradient array for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi_ni(const char                *var_name,
+                            cs_gradient_type_t         gradient_type,
+                            cs_halo_type_t             halo_type,
+                            int                        inc,
+                            bool                       recompute_cocg,
+                            int                        n_r_sweeps,
+                            int                        verbosity,
+                            double                     epsilon,
+                            double                     extrap,
+                            int                        n_fields,
+                            const cs_real_t     *const bc_coeff_a[],
+                            const cs_real_t     *const bc_coeff_b[],
+                            const cs_real_t     *const var[],
+                            cs_real_3_t         *const grad[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+  const cs_lnum_t nf = n_fields;
+
+  cs_real_t *i_var;
+  cs_real_3_t *i_grad;
+  BFT_MALLOC(i_var, n_cells_ext*nf, cs_real_t);
+  BFT_MALLOC(i_grad, n_cells_ext*nf, cs_real_3_t);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t k = 0; k < nf; k++)
+      i_var[c_id*nf + k] = var[k][c_id];
+  }
+
+  cs_gradient_scalar_multi(var_name,
+                           gradient_type,
+                           halo_type,
+                           inc,
+                           recompute_cocg,
+                           n_r_sweeps,
+                           verbosity,
+                           epsilon,
+                           extrap,
+                           n_fields,
+                           bc_coeff_a,
+                           bc_coeff_b,
+                           i_var,
+                           i_grad);
+
+  BFT_FREE(i_var);
+
+# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    for (cs_lnum_t k = 0; k < nf; k++) {
+      for (cs_lnum_t j = 0; j < 3; j++)
+        grad[k][c_id][j] = i_grad[c_id*nf + k][j];
+    }
+  }
+
+  BFT_FREE(i_grad);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
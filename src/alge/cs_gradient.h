@@ -208,6 +208,48 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select cell-based (gather) or face-based (scatter) kernels
+ *         for a given gradient type.
+ *
+ * With the default face-based formulation, face contributions are
+ * scattered to adjacent cells, using the interior face numbering's thread
+ * groups to avoid write conflicts. With the cell-based formulation, each
+ * cell gathers contributions from its adjacent faces (using the
+ * cell -> faces adjacencies from \ref cs_glob_mesh_adjacencies), so
+ * each gradient value is written by a single thread.
+ *
+ * Cell-based kernels are currently available for the least-squares
+ * (\ref CS_GRADIENT_LSQ) and least-squares reconstructed Green-Gauss
+ * (\ref CS_GRADIENT_GREEN_LSQ) scalar gradients, in the standard case
+ * (no hydrostatic pressure, internal coupling, or anisotropic weighting).
+ * Other cases use the face-based kernels.
+ *
+ * \param[in]  gradient_type  gradient type
+ * \param[in]  gather         true for cell-based kernels,
+ *                            false for face-based kernels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_cell_gather(cs_gradient_type_t  gradient_type,
+                            bool                gather);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether cell-based (gather) kernels are selected
+ *         for a given gradient type.
+ *
+ * \param[in]  gradient_type  gradient type
+ *
+ * \return  true if cell-based kernels are selected, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_cell_gather(cs_gradient_type_t  gradient_type);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -263,6 +305,112 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * Values and gradients of the n_fields fields are interleaved, so that
+ * the value of field k for cell c is var[c*n_fields + k], and its
+ * gradient grad[c*n_fields + k].
+ *
+ * For least-squares and non-reconstructed Green-Gauss gradients,
+ * all fields are handled with a single traversal of the mesh (so that
+ * connectivity and geometric quantities are loaded only once), and
+ * a single halo exchange for all fields is used for the input variables
+ * and resulting gradients. Other gradient types (or rotational periodicity)
+ * are handled field by field, still with a single input halo exchange.
+ *
+ * No clipping, cell weighting, hydrostatic pressure or internal coupling
+ * is handled here; \ref cs_gradient_scalar should be used in those cases.
+ *
+ * \param[in]       var_name        variable name (for logging)
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       epsilon         precision for iterative gradient
+ *                                  calculation
+ * \param[in]       extrap          boundary gradient extrapolation
+ *                                  coefficient
+ * \param[in]       n_fields        number of fields
+ * \param[in]       bc_coeff_a      boundary condition term a for each field,
+ *                                  or NULL
+ * \param[in]       bc_coeff_b      boundary condition term b for each field,
+ *                                  or NULL
+ * \param[in, out]  var             interleaved variables
+ *                                  (size: n_cells_ext*n_fields)
+ * \param[out]      grad            interleaved gradients
+ *                                  (size: n_cells_ext*n_fields)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         double                     epsilon,
+                         double                     extrap,
+                         int                        n_fields,
+                         const cs_real_t     *const bc_coeff_a[],
+                         const cs_real_t     *const bc_coeff_b[],
+                         cs_real_t                  var[restrict],
+                         cs_real_3_t       *restrict grad);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields, with
+ *         non-interleaved values.
+ *
+ * This variant of \ref cs_gradient_scalar_multi takes separate arrays
+ * for each field (such as field values), which are gathered in a temporary
+ * interleaved array; the resulting gradients (including ghost cells)
+ * are scattered back to separate arrays.
+ *
+ * \param[in]       var_name        variable name (for logging)
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       epsilon         precision for iterative gradient
+ *                                  calculation
+ * \param[in]       extrap          boundary gradient extrapolation
+ *                                  coefficient
+ * \param[in]       n_fields        number of fields
+ * \param[in]       bc_coeff_a      boundary condition term a for each field,
+ *                                  or NULL
+ * \param[in]       bc_coeff_b      boundary condition term b for each field,
+ *                                  or NULL
+ * \param[in]       var             variable array for each field
+ * \param[out]      grad            gradient array for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi_ni(const char                *var_name,
+                            cs_gradient_type_t         gradient_type,
+                            cs_halo_type_t             halo_type,
+                            int                        inc,
+                            bool                       recompute_cocg,
+                            int                        n_r_sweeps,
+                            int                        verbosity,
+                            double                     epsilon,
+                            double                     extrap,
+                            int                        n_fields,
+                            const cs_real_t     *const bc_coeff_a[],
+                            const cs_real_t     *const bc_coeff_b[],
+                            const cs_real_t     *const var[],
+                            cs_real_3_t         *const grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -152,6 +152,18 @@ struct _cs_grid_t {
                                        < 0 orientation opposite as parent);
                                        size: parent n_faces */
 
+  int                 coarsening_type; /* Coarsening type used to build
+                                          this grid from its parent */
+
+  cs_lnum_t          *prolong_index;  /* Prolongation matrix row index
+                                         (CSR, parent local rows to local
+                                         coarse rows before merging), or
+                                         NULL for piecewise-constant
+                                         prolongation using coarse_row;
+                                         size: parent n_rows + 1 */
+  cs_lnum_t          *prolong_col_id; /* Prolongation matrix column ids */
+  cs_real_t          *prolong_val;    /* Prolongation matrix values */
+
   /* Geometric data */
 
   cs_real_t         relaxation;     /* P0/P1 relaxation parameter */
@@ -258,7 +270,9 @@ const char *cs_grid_coarsening_type_name[]
      N_("SPD, diag/extra-diag ratio based"),
      N_("SPD, max extra-diag ratio based"),
      N_("SPD, (multiple) pairwise aggregation"),
-     N_("convection + diffusion")};
+     N_("convection + diffusion"),
+     N_("SPD, smoothed aggregation"),
+     N_("SPD, classical (Ruge-Stueben)")};
 
 /* Select tuning options */
 
@@ -390,6 +404,12 @@ _create_grid(void)
   g->coarse_row = NULL;
   g->coarse_face = NULL;
 
+  g->coarsening_type = CS_GRID_COARSENING_DEFAULT;
+
+  g->prolong_index = NULL;
+  g->prolong_col_id = NULL;
+  g->prolong_val = NULL;
+
   g->cell_cen = NULL;
   g->_cell_cen = NULL;
   g->cell_vol = NULL;
@@ -493,6 +513,31 @@ _coarse_init(const cs_grid_t *f)
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the matrix type on which coarsening of a grid is based.
+ *
+ * SELL-C-sigma matrices are built over an MSR structure, whose arrays
+ * are available through cs_matrix_get_msr_arrays, so they are coarsened
+ * as MSR matrices (the coarse levels always use MSR matrices).
+ *
+ * parameters:
+ *   g <-- Pointer to grid structure
+ *
+ * returns:
+ *   matrix type to use for coarsening
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_type_t
+_coarsening_matrix_type(const cs_grid_t  *g)
+{
+  cs_matrix_type_t m_type = cs_matrix_get_type(g->matrix);
+
+  if (m_type == CS_MATRIX_SELL)
+    m_type = CS_MATRIX_MSR;
+
+  return m_type;
+}
+
 /*----------------------------------------------------------------------------
  * Log aggregation information using the face to cells adjacency.
  *
@@ -2500,6 +2545,70 @@ _graph_m_ptr_insert_m(cs_graph_m_ptr_t  *s,
   s->m_head[_m] = elt_id;
 }
 
+/*----------------------------------------------------------------------------
+ * Remove an element from a list (queue) of elements listed by measure,
+ * when elements are selected by highest measure.
+ *
+ * Only s->m_max is maintained here (s->m_min is not used).
+ *
+ * parameters:
+ *   s      <-> structure associated with graph traversal and update
+ *   a_m_e  <-- measure considered for this element
+ *   elt_id <-- id of element to remove
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_graph_m_ptr_remove_max(cs_graph_m_ptr_t  *s,
+                        cs_lnum_t          a_m_e,
+                        cs_lnum_t          elt_id)
+{
+  cs_lnum_t s_p = s->prev[elt_id];
+  cs_lnum_t s_n = s->next[elt_id];
+
+  if (s_p > -1)
+    s->next[s_p] = s_n;
+  else {
+    assert(s->m_head[a_m_e] == elt_id);
+    s->m_head[a_m_e] = s_n;
+  }
+  if (s_n > -1)
+    s->prev[s_n] = s_p;
+
+  s->prev[elt_id] = -1;
+  s->next[elt_id] = -1;
+
+  while (s->m_max > 0 && s->m_head[s->m_max] < 0)
+    s->m_max--;
+}
+
+/*----------------------------------------------------------------------------
+ * Insert an element at the head of a list (queue) of elements listed
+ * by measure, when elements are selected by highest measure.
+ *
+ * parameters:
+ *   s      <-> structure associated with graph traversal and update
+ *   a_m_e  <-- measure considered for this element
+ *   elt_id <-- id of element to insert
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_graph_m_ptr_insert_max(cs_graph_m_ptr_t  *s,
+                        cs_lnum_t          a_m_e,
+                        cs_lnum_t          elt_id)
+{
+  cs_lnum_t s_n = s->m_head[a_m_e];
+
+  s->prev[elt_id] = -1;
+  s->next[elt_id] = s_n;
+  if (s_n > -1)
+    s->prev[s_n] = elt_id;
+
+  s->m_head[a_m_e] = elt_id;
+
+  if (a_m_e > s->m_max)
+    s->m_max = a_m_e;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Apply one step of the pairwise aggregation algorithm for a
@@ -3243,6 +3352,360 @@ _automatic_aggregation_mx_msr(const cs_grid_t  *f,
   BFT_FREE(penalize);
 }
 
+/*----------------------------------------------------------------------------
+ * Build a coarse grid level from the previous level using a classical
+ * (Ruge-Stueben) strength of connection based C/F splitting and direct
+ * interpolation, with a scalar matrix in MSR format.
+ *
+ * The splitting uses the classical two passes: a greedy selection of
+ * C rows by measure, then a check that strongly connected F rows share
+ * a strong C row, adding C rows where needed.
+ *
+ * Only couplings between local rows are considered for the splitting
+ * and interpolation; contributions from ghost rows are redistributed
+ * on local interpolatory points, so that constants are still prolonged
+ * exactly for zero row-sum matrices.
+ *
+ * Each F row is also assigned the coarse row of its most strongly coupled
+ * C row, so as to define an aggregation compatible with halo construction.
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   verbosity <-- Verbosity level
+ *   c         <-> Coarse grid structure (coarse_row and prolongation set)
+ *----------------------------------------------------------------------------*/
+
+static void
+_automatic_aggregation_rs_msr(const cs_grid_t  *f,
+                              int               verbosity,
+                              cs_grid_t        *c)
+{
+  const cs_lnum_t f_n_rows = f->n_rows;
+
+  cs_lnum_t *f_c_row = c->coarse_row;
+
+  /* Algorithm parameters */
+  const cs_real_t theta = 0.25;
+  const cs_real_t p_test = (f->level == 0) ? 1. : -1;
+
+  if (verbosity > 3)
+    bft_printf("\n     %s: theta %5.3e; pena_thd: %5.3e, p_test: %g\n",
+               __func__, theta, _penalization_threshold, p_test);
+
+  /* Access matrix MSR vectors */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+
+  cs_matrix_get_msr_arrays(f->matrix,
+                           &row_index,
+                           &col_id,
+                           &d_val,
+                           &x_val);
+
+  assert(f->db_size[0] == 1 && f->eb_size[0] == 1);
+
+  /* Allocate working arrays */
+
+  bool *penalize;
+  cs_real_t *maxi;
+  short int *cf_state; /* -2: penalized, -1: undecided, 0: F, 1: C */
+
+  BFT_MALLOC(penalize, f_n_rows, bool);
+  BFT_MALLOC(maxi, f_n_rows, cs_real_t);
+  BFT_MALLOC(cf_state, f_n_rows, short int);
+
+  /* Maximum negative coupling and penalization test for each row */
+
+# pragma omp parallel for if(f_n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    maxi[ii] = 0.0;
+
+    cs_real_t  sum = 0.0;
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+      const cs_real_t  xv = x_val[jj];
+      if (xv < 0) {
+        sum -= xv;
+        maxi[ii] = CS_MAX(maxi[ii], -xv);
+      }
+      else
+        sum += xv;
+    }
+
+    penalize[ii] = (d_val[ii]*p_test > _penalization_threshold * sum);
+    cf_state[ii] = (penalize[ii]) ? -2 : -1;
+
+  }
+
+  /* Strong couplings (S) and their transpose (S^T) */
+
+  cs_lnum_t *s_index, *s_col_id, *st_index, *st_row_id;
+
+  BFT_MALLOC(s_index, f_n_rows+1, cs_lnum_t);
+  BFT_MALLOC(s_col_id, row_index[f_n_rows], cs_lnum_t);
+  BFT_MALLOC(st_index, f_n_rows+1, cs_lnum_t);
+
+  s_index[0] = 0;
+  for (cs_lnum_t ii = 0; ii <= f_n_rows; ii++)
+    st_index[ii] = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    cs_lnum_t n = s_index[ii];
+    if (!penalize[ii] && maxi[ii] > 0) {
+      const cs_real_t  row_criterion = -theta*maxi[ii];
+      for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+        cs_lnum_t jj = col_id[jidx];
+        if (jj < f_n_rows && x_val[jidx] <= row_criterion && !penalize[jj]) {
+          s_col_id[n++] = jj;
+          st_index[jj+1] += 1;
+        }
+      }
+    }
+    s_index[ii+1] = n;
+  }
+
+  cs_lnum_t st_max = 0;
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    st_max = CS_MAX(st_max, st_index[ii+1]);
+    st_index[ii+1] += st_index[ii];
+  }
+
+  BFT_MALLOC(st_row_id, st_index[f_n_rows], cs_lnum_t);
+
+  {
+    cs_lnum_t *st_count;
+    BFT_MALLOC(st_count, f_n_rows, cs_lnum_t);
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++)
+      st_count[ii] = st_index[ii];
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      for (cs_lnum_t sidx = s_index[ii]; sidx < s_index[ii+1]; sidx++) {
+        cs_lnum_t jj = s_col_id[sidx];
+        st_row_id[st_count[jj]] = ii;
+        st_count[jj] += 1;
+      }
+    }
+    BFT_FREE(st_count);
+  }
+
+  /* First pass of the C/F splitting: build lists of undecided rows by
+     measure (number of undecided rows strongly depending on a row,
+     plus twice the number of such F rows), bounded by 2.|S^T_i|. */
+
+  cs_lnum_t *lambda;
+  BFT_MALLOC(lambda, f_n_rows, cs_lnum_t);
+
+  cs_graph_m_ptr_t s;
+
+  s.m_min = 0;
+  s.m_max = 0;
+
+  BFT_MALLOC(s.m_head, 2*st_max + 1, cs_lnum_t);
+  BFT_MALLOC(s.next, f_n_rows*2, cs_lnum_t);
+  s.prev = s.next + f_n_rows;
+
+  for (cs_lnum_t ii = 0; ii < 2*st_max + 1; ii++)
+    s.m_head[ii] = -1;
+
+  for (cs_lnum_t ii = f_n_rows-1; ii >= 0; ii--) {
+    lambda[ii] = st_index[ii+1] - st_index[ii];
+    s.next[ii] = -1;
+    s.prev[ii] = -1;
+    if (cf_state[ii] == -1)
+      _graph_m_ptr_insert_max(&s, lambda[ii], ii);
+  }
+
+  while (s.m_head[s.m_max] > -1) {
+
+    /* Select undecided row with highest measure as C row */
+
+    cs_lnum_t ii = s.m_head[s.m_max];
+
+    _graph_m_ptr_remove_max(&s, lambda[ii], ii);
+    cf_state[ii] = 1;
+
+    /* Rows strongly depending on ii become F rows */
+
+    for (cs_lnum_t tidx = st_index[ii]; tidx < st_index[ii+1]; tidx++) {
+      cs_lnum_t jj = st_row_id[tidx];
+      if (cf_state[jj] != -1)
+        continue;
+      _graph_m_ptr_remove_max(&s, lambda[jj], jj);
+      cf_state[jj] = 0;
+
+      /* Rows on which new F row depends become better C candidates */
+
+      for (cs_lnum_t sidx = s_index[jj]; sidx < s_index[jj+1]; sidx++) {
+        cs_lnum_t kk = s_col_id[sidx];
+        if (cf_state[kk] == -1) {
+          _graph_m_ptr_remove_max(&s, lambda[kk], kk);
+          lambda[kk] += 1;
+          _graph_m_ptr_insert_max(&s, lambda[kk], kk);
+        }
+      }
+    }
+
+    /* Rows on which ii depends become worse C candidates */
+
+    for (cs_lnum_t sidx = s_index[ii]; sidx < s_index[ii+1]; sidx++) {
+      cs_lnum_t kk = s_col_id[sidx];
+      if (cf_state[kk] == -1 && lambda[kk] > 0) {
+        _graph_m_ptr_remove_max(&s, lambda[kk], kk);
+        lambda[kk] -= 1;
+        _graph_m_ptr_insert_max(&s, lambda[kk], kk);
+      }
+    }
+
+  }
+
+  BFT_FREE(s.next);
+  BFT_FREE(s.m_head);
+  BFT_FREE(lambda);
+
+  /* Second pass of the C/F splitting: ensure that each pair of strongly
+     connected F rows shares a common strong C row, so that direct
+     interpolation is accurate; otherwise, the F row on which the other
+     depends becomes a C row. */
+
+  {
+    cs_lnum_t *c_mark;
+    BFT_MALLOC(c_mark, f_n_rows, cs_lnum_t);
+
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++)
+      c_mark[ii] = -1;
+
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+      if (cf_state[ii] != 0)
+        continue;
+
+      for (cs_lnum_t sidx = s_index[ii]; sidx < s_index[ii+1]; sidx++) {
+        cs_lnum_t jj = s_col_id[sidx];
+        if (cf_state[jj] == 1)
+          c_mark[jj] = ii;
+      }
+
+      for (cs_lnum_t sidx = s_index[ii]; sidx < s_index[ii+1]; sidx++) {
+        cs_lnum_t jj = s_col_id[sidx];
+        if (cf_state[jj] != 0)
+          continue;
+        bool common_c = false;
+        for (cs_lnum_t kidx = s_index[jj]; kidx < s_index[jj+1]; kidx++) {
+          if (c_mark[s_col_id[kidx]] == ii) {
+            common_c = true;
+            break;
+          }
+        }
+        if (common_c == false) {
+          cf_state[jj] = 1;
+          c_mark[jj] = ii;
+        }
+      }
+
+    }
+
+    BFT_FREE(c_mark);
+  }
+
+  /* Number C rows, then assign each F row to its strongest C row
+     (F rows always have at least one strong C coupling, as they
+     were selected through one) */
+
+  cs_lnum_t c_n_rows = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    if (cf_state[ii] == 1)
+      f_c_row[ii] = c_n_rows++;
+    else
+      f_c_row[ii] = -1;
+  }
+
+  /* Direct interpolation (positive couplings lumped on diagonal) */
+
+  cs_lnum_t *p_index, *p_col_id;
+  cs_real_t *p_val;
+
+  BFT_MALLOC(p_index, f_n_rows+1, cs_lnum_t);
+  BFT_MALLOC(p_col_id, s_index[f_n_rows] + f_n_rows, cs_lnum_t);
+  BFT_MALLOC(p_val, s_index[f_n_rows] + f_n_rows, cs_real_t);
+
+  p_index[0] = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    cs_lnum_t n = p_index[ii];
+
+    if (cf_state[ii] == 1) {
+      p_col_id[n] = f_c_row[ii];
+      p_val[n] = 1.;
+      n++;
+    }
+
+    else if (cf_state[ii] == 0) {
+
+      cs_real_t neg_sum = 0, pos_sum = 0, c_sum = 0, c_min = 0;
+
+      for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+        const cs_real_t  xv = x_val[jidx];
+        if (xv < 0)
+          neg_sum += xv;
+        else
+          pos_sum += xv;
+      }
+
+      const cs_real_t  row_criterion = -theta*maxi[ii];
+
+      for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+        cs_lnum_t jj = col_id[jidx];
+        if (   jj < f_n_rows && cf_state[jj] == 1
+            && x_val[jidx] <= row_criterion) {
+          c_sum += x_val[jidx];
+          p_col_id[n] = f_c_row[jj];
+          p_val[n] = x_val[jidx];
+          n++;
+          if (x_val[jidx] < c_min) {
+            c_min = x_val[jidx];
+            f_c_row[ii] = f_c_row[jj];
+          }
+        }
+      }
+
+      assert(c_sum < 0 && f_c_row[ii] > -1);
+
+      const cs_real_t  d_f = d_val[ii] + pos_sum;
+      const cs_real_t  w = (CS_ABS(d_f) > EPZERO) ? -neg_sum/(c_sum*d_f) : 0;
+
+      for (cs_lnum_t kidx = p_index[ii]; kidx < n; kidx++)
+        p_val[kidx] *= w;
+
+    }
+
+    p_index[ii+1] = n;
+
+  }
+
+  BFT_REALLOC(p_col_id, p_index[f_n_rows], cs_lnum_t);
+  BFT_REALLOC(p_val, p_index[f_n_rows], cs_real_t);
+
+  BFT_FREE(c->prolong_index);
+  BFT_FREE(c->prolong_col_id);
+  BFT_FREE(c->prolong_val);
+
+  c->prolong_index = p_index;
+  c->prolong_col_id = p_col_id;
+  c->prolong_val = p_val;
+
+  /* Free working arrays */
+
+  BFT_FREE(st_row_id);
+  BFT_FREE(st_index);
+  BFT_FREE(s_col_id);
+  BFT_FREE(s_index);
+  BFT_FREE(cf_state);
+  BFT_FREE(maxi);
+  BFT_FREE(penalize);
+}
+
 /*----------------------------------------------------------------------------
  * Build a coarse grid level from the previous level using
  * an automatic criterion, using the face to cells adjacency.
@@ -4712,40 +5175,441 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 }
 
 /*----------------------------------------------------------------------------
- * Build edge-based matrix values from MSR matrix.
+ * Build a smoothed aggregation prolongation from the fine -> coarse row
+ * aggregation, with a scalar matrix in MSR format.
+ *
+ * The tentative (piecewise constant) prolongation P0 is smoothed by one
+ * damped Jacobi step: P = (I - omega.D^-1.A_f).P0, with
+ * omega = 4/(3.rho), rho being a Gershgorin bound of the spectral radius
+ * of D^-1.A. A_f is the filtered matrix restricted to couplings between
+ * local, aggregated rows, the dropped couplings being lumped on the
+ * diagonal so that constants are still prolonged exactly.
  *
  * parameters:
- *   grid <-> grid structure
+ *   f <-- Fine grid structure
+ *   c <-> Coarse grid structure (prolongation set)
  *----------------------------------------------------------------------------*/
 
 static void
-_native_from_msr(cs_grid_t  *g)
-
+_smoothed_prolongation_msr(const cs_grid_t  *f,
+                           cs_grid_t        *c)
 {
-  const cs_lnum_t db_stride = g->db_size[3];
-  const cs_lnum_t eb_stride = g->eb_size[3];
-
-  const cs_lnum_t n_rows = g->n_rows;
-  const cs_lnum_t n_cols_ext = g->n_cols_ext;
-
-  /* Matrix in the MSR format */
+  const cs_lnum_t f_n_rows = f->n_rows;
+  const cs_lnum_t c_n_rows = c->n_elts_r[0];
+  const cs_lnum_t *coarse_row = c->coarse_row;
 
   const cs_lnum_t  *row_index, *col_id;
   const cs_real_t  *d_val, *x_val;
 
-  cs_matrix_get_msr_arrays(g->matrix,
+  cs_matrix_get_msr_arrays(f->matrix,
                            &row_index,
                            &col_id,
                            &d_val,
                            &x_val);
 
-  {
-    BFT_REALLOC(g->_da, db_stride*n_cols_ext, cs_real_t);
-    g->da = g->_da;
+  assert(f->db_size[0] == 1 && f->eb_size[0] == 1);
 
-    for (cs_lnum_t i = 0; i < n_rows; i++) {
-      for (cs_lnum_t l = 0; l < eb_stride; l++)
-        g->_da[i*db_stride + l] = d_val[i*db_stride + l];
+  /* Jacobi damping factor */
+
+  cs_real_t rho = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    if (coarse_row[ii] > -1 && d_val[ii] > 0) {
+      cs_real_t sum = d_val[ii];
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+        sum += CS_ABS(x_val[jj]);
+      rho = CS_MAX(rho, sum / d_val[ii]);
+    }
+  }
+
+#if defined(HAVE_MPI) && defined(HAVE_MPI_IN_PLACE)
+  if (f->comm != MPI_COMM_NULL)
+    MPI_Allreduce(MPI_IN_PLACE, &rho, 1, CS_MPI_REAL, MPI_MAX, f->comm);
+#endif
+
+  const cs_real_t omega = (rho > 0) ? 4./(3.*rho) : 0;
+
+  /* Build prolongation */
+
+  cs_lnum_t *p_index, *p_col_id, *c_pos;
+  cs_real_t *p_val;
+
+  BFT_MALLOC(p_index, f_n_rows+1, cs_lnum_t);
+  BFT_MALLOC(p_col_id, row_index[f_n_rows] + f_n_rows, cs_lnum_t);
+  BFT_MALLOC(p_val, row_index[f_n_rows] + f_n_rows, cs_real_t);
+  BFT_MALLOC(c_pos, c_n_rows, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++)
+    c_pos[i] = -1;
+
+  p_index[0] = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    cs_lnum_t s_id = p_index[ii];
+    cs_lnum_t n = s_id;
+
+    cs_lnum_t i = coarse_row[ii];
+
+    if (i > -1) {
+
+      const cs_real_t r = (d_val[ii] > 0) ? omega / d_val[ii] : 0;
+      cs_real_t d_f = d_val[ii];
+
+      p_col_id[n] = i;
+      p_val[n] = 0;
+      c_pos[i] = n;
+      n++;
+
+      for (cs_lnum_t jj_ind = row_index[ii];
+           jj_ind < row_index[ii+1];
+           jj_ind++) {
+
+        cs_lnum_t jj = col_id[jj_ind];
+        cs_lnum_t j = (jj < f_n_rows) ? coarse_row[jj] : -1;
+
+        if (j > -1) {
+          if (c_pos[j] < s_id) {
+            c_pos[j] = n;
+            p_col_id[n] = j;
+            p_val[n] = 0;
+            n++;
+          }
+          p_val[c_pos[j]] -= r*x_val[jj_ind];
+        }
+        else
+          d_f += x_val[jj_ind];
+
+      }
+
+      p_val[s_id] += 1. - r*d_f;
+
+    }
+
+    p_index[ii+1] = n;
+
+  }
+
+  BFT_FREE(c_pos);
+
+  BFT_REALLOC(p_col_id, p_index[f_n_rows], cs_lnum_t);
+  BFT_REALLOC(p_val, p_index[f_n_rows], cs_real_t);
+
+  BFT_FREE(c->prolong_index);
+  BFT_FREE(c->prolong_col_id);
+  BFT_FREE(c->prolong_val);
+
+  c->prolong_index = p_index;
+  c->prolong_col_id = p_col_id;
+  c->prolong_val = p_val;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse level from a finer level with a scalar MSR matrix,
+ * using a Galerkin (R.A.P) product with the grid's prolongation matrix.
+ *
+ * The prolongation only involves local rows, so couplings with ghost rows
+ * are coarsened using the fine -> coarse aggregation (i.e. the tentative
+ * prolongation), which keeps the coarse matrix symmetric across ranks.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_rap(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+{
+  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
+  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
+  const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
+
+  const cs_lnum_t *p_index = coarse_grid->prolong_index;
+  const cs_lnum_t *p_col_id = coarse_grid->prolong_col_id;
+  const cs_real_t *p_val = coarse_grid->prolong_val;
+
+  assert(fine_grid->db_size[0] == 1 && fine_grid->eb_size[0] == 1);
+
+  /* Fine matrix in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+  const cs_real_t  *f_d_val, *f_x_val;
+
+  cs_matrix_get_msr_arrays(fine_grid->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           &f_d_val,
+                           &f_x_val);
+
+  /* Transposed prolongation (restriction) */
+
+  cs_lnum_t *r_index, *r_row_id;
+  cs_real_t *r_val;
+
+  BFT_MALLOC(r_index, c_n_rows+1, cs_lnum_t);
+  BFT_MALLOC(r_row_id, p_index[f_n_rows], cs_lnum_t);
+  BFT_MALLOC(r_val, p_index[f_n_rows], cs_real_t);
+
+  for (cs_lnum_t i = 0; i <= c_n_rows; i++)
+    r_index[i] = 0;
+
+  for (cs_lnum_t k = 0; k < p_index[f_n_rows]; k++)
+    r_index[p_col_id[k] + 1] += 1;
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++)
+    r_index[i+1] += r_index[i];
+
+  {
+    cs_lnum_t *r_count;
+    BFT_MALLOC(r_count, c_n_rows, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < c_n_rows; i++)
+      r_count[i] = r_index[i];
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      for (cs_lnum_t k = p_index[ii]; k < p_index[ii+1]; k++) {
+        cs_lnum_t i = p_col_id[k];
+        r_row_id[r_count[i]] = ii;
+        r_val[r_count[i]] = p_val[k];
+        r_count[i] += 1;
+      }
+    }
+    BFT_FREE(r_count);
+  }
+
+  /* Fine rows by aggregate (for couplings with ghost rows) */
+
+  cs_lnum_t *cf_row_idx, *f_row_id;
+
+  BFT_MALLOC(cf_row_idx, c_n_rows+1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i <= c_n_rows; i++)
+    cf_row_idx[i] = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    cs_lnum_t i = c_coarse_row[ii];
+    if (i > -1 && i < c_n_rows)
+      cf_row_idx[i+1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++)
+    cf_row_idx[i+1] += cf_row_idx[i];
+
+  BFT_MALLOC(f_row_id, cf_row_idx[c_n_rows], cs_lnum_t);
+
+  {
+    cs_lnum_t *cf_count;
+    BFT_MALLOC(cf_count, c_n_rows, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < c_n_rows; i++)
+      cf_count[i] = cf_row_idx[i];
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t i = c_coarse_row[ii];
+      if (i > -1 && i < c_n_rows) {
+        f_row_id[cf_count[i]] = ii;
+        cf_count[i] += 1;
+      }
+    }
+    BFT_FREE(cf_count);
+  }
+
+  /* Coarse matrix structure (symbolic product) */
+
+  cs_lnum_t *restrict c_row_index, *restrict c_col_id;
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+
+  BFT_MALLOC(c_row_index, c_n_rows+1, cs_lnum_t);
+
+  cs_lnum_t c_size_max = CS_MAX(f_row_index[f_n_rows], 16);
+  BFT_MALLOC(c_col_id, c_size_max, cs_lnum_t);
+
+  cs_lnum_t *c_pos;
+  BFT_MALLOC(c_pos, c_n_cols, cs_lnum_t);
+
+  for (cs_lnum_t j = 0; j < c_n_cols; j++)
+    c_pos[j] = -1;
+
+  c_row_index[0] = 0;
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
+
+    cs_lnum_t n = c_row_index[i];
+
+    for (cs_lnum_t r_id = r_index[i]; r_id < r_index[i+1]; r_id++) {
+
+      cs_lnum_t ii = r_row_id[r_id];
+
+      for (cs_lnum_t jj_ind = f_row_index[ii] - 1;
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
+
+        /* Diagonal handled along with local columns */
+        cs_lnum_t jj = (jj_ind < f_row_index[ii]) ? ii : f_col_id[jj_ind];
+        if (jj >= f_n_rows)
+          continue;
+
+        for (cs_lnum_t k = p_index[jj]; k < p_index[jj+1]; k++) {
+          cs_lnum_t j = p_col_id[k];
+          if (j != i && c_pos[j] < c_row_index[i]) {
+            if (n >= c_size_max) {
+              c_size_max *= 2;
+              BFT_REALLOC(c_col_id, c_size_max, cs_lnum_t);
+            }
+            c_pos[j] = n;
+            c_col_id[n++] = j;
+          }
+        }
+
+      }
+
+    }
+
+    for (cs_lnum_t f_id = cf_row_idx[i]; f_id < cf_row_idx[i+1]; f_id++) {
+
+      cs_lnum_t ii = f_row_id[f_id];
+
+      for (cs_lnum_t jj_ind = f_row_index[ii];
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
+        cs_lnum_t jj = f_col_id[jj_ind];
+        cs_lnum_t j = (jj >= f_n_rows) ? c_coarse_row[jj] : -1;
+        if (j > -1 && c_pos[j] < c_row_index[i]) {
+          if (n >= c_size_max) {
+            c_size_max *= 2;
+            BFT_REALLOC(c_col_id, c_size_max, cs_lnum_t);
+          }
+          c_pos[j] = n;
+          c_col_id[n++] = j;
+        }
+      }
+
+    }
+
+    c_row_index[i+1] = n;
+
+  }
+
+  cs_lnum_t c_size = c_row_index[c_n_rows];
+
+  BFT_REALLOC(c_col_id, c_size, cs_lnum_t);
+  BFT_MALLOC(c_x_val, c_size, cs_real_t);
+  BFT_MALLOC(c_d_val, c_n_rows, cs_real_t);
+
+  /* Order column ids in case some algorithms expect it */
+
+  cs_sort_indexed(c_n_rows, c_row_index, c_col_id);
+
+  /* Values assignment pass (numeric product) */
+
+  for (cs_lnum_t i = 0; i < c_size; i++)
+    c_x_val[i] = 0;
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
+
+    c_d_val[i] = 0;
+
+    for (cs_lnum_t k = c_row_index[i]; k < c_row_index[i+1]; k++)
+      c_pos[c_col_id[k]] = k;
+
+    for (cs_lnum_t r_id = r_index[i]; r_id < r_index[i+1]; r_id++) {
+
+      cs_lnum_t ii = r_row_id[r_id];
+      cs_real_t r_ii = r_val[r_id];
+
+      for (cs_lnum_t jj_ind = f_row_index[ii] - 1;
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
+
+        cs_lnum_t jj;
+        cs_real_t a_ij;
+        if (jj_ind < f_row_index[ii]) {
+          jj = ii;
+          a_ij = f_d_val[ii];
+        }
+        else {
+          jj = f_col_id[jj_ind];
+          a_ij = f_x_val[jj_ind];
+        }
+        if (jj >= f_n_rows)
+          continue;
+
+        for (cs_lnum_t k = p_index[jj]; k < p_index[jj+1]; k++) {
+          cs_lnum_t j = p_col_id[k];
+          cs_real_t v = r_ii * a_ij * p_val[k];
+          if (j != i)
+            c_x_val[c_pos[j]] += v;
+          else
+            c_d_val[i] += v;
+        }
+
+      }
+
+    }
+
+    for (cs_lnum_t f_id = cf_row_idx[i]; f_id < cf_row_idx[i+1]; f_id++) {
+
+      cs_lnum_t ii = f_row_id[f_id];
+
+      for (cs_lnum_t jj_ind = f_row_index[ii];
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
+        cs_lnum_t jj = f_col_id[jj_ind];
+        cs_lnum_t j = (jj >= f_n_rows) ? c_coarse_row[jj] : -1;
+        if (j > -1)
+          c_x_val[c_pos[j]] += f_x_val[jj_ind];
+      }
+
+    }
+
+  }
+
+  BFT_FREE(c_pos);
+  BFT_FREE(f_row_id);
+  BFT_FREE(cf_row_idx);
+  BFT_FREE(r_val);
+  BFT_FREE(r_row_id);
+  BFT_FREE(r_index);
+
+  _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
+                           c_row_index, c_col_id,
+                           c_d_val, c_x_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Build edge-based matrix values from MSR matrix.
+ *
+ * parameters:
+ *   grid <-> grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_native_from_msr(cs_grid_t  *g)
+
+{
+  const cs_lnum_t db_stride = g->db_size[3];
+  const cs_lnum_t eb_stride = g->eb_size[3];
+
+  const cs_lnum_t n_rows = g->n_rows;
+  const cs_lnum_t n_cols_ext = g->n_cols_ext;
+
+  /* Matrix in the MSR format */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+
+  cs_matrix_get_msr_arrays(g->matrix,
+                           &row_index,
+                           &col_id,
+                           &d_val,
+                           &x_val);
+
+  {
+    BFT_REALLOC(g->_da, db_stride*n_cols_ext, cs_real_t);
+    g->da = g->_da;
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t l = 0; l < eb_stride; l++)
+        g->_da[i*db_stride + l] = d_val[i*db_stride + l];
     }
   }
 
@@ -5152,6 +6016,10 @@ cs_grid_destroy(cs_grid_t **grid)
 
     BFT_FREE(g->coarse_row);
 
+    BFT_FREE(g->prolong_index);
+    BFT_FREE(g->prolong_col_id);
+    BFT_FREE(g->prolong_val);
+
     if (g->_halo != NULL)
       cs_halo_destroy(&(g->_halo));
 
@@ -5384,6 +6252,28 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Set whether a grid's matrix should use single precision extra-diagonal
+ * coefficients for matrix.vector products.
+ *
+ * This only applies to matrices owned by the grid (i.e. coarse grids);
+ * a matrix shared with the calling code is never modified.
+ *
+ * parameters:
+ *   g       <-> Grid structure
+ *   reduced <-- if true, use single precision extra-diagonal coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_reduced_precision(cs_grid_t  *g,
+                              bool        reduced)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_set_reduced_precision(g->_matrix, reduced);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -5476,7 +6366,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
      structure allowing threading without a specific renumbering, as
      structures are rebuilt often (so only CSR and MSR can be considered) */
 
-  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+  cs_matrix_type_t fine_matrix_type = _coarsening_matrix_type(f);
   cs_matrix_type_t coarse_matrix_type = CS_MATRIX_MSR;
 
   cs_matrix_variant_t *coarse_mv = NULL;
@@ -5528,6 +6418,19 @@ cs_grid_coarsen(const cs_grid_t  *f,
       coarsening_type = CS_GRID_COARSENING_SPD_MX;
   }
 
+  else if (   coarsening_type == CS_GRID_COARSENING_SPD_SA
+           || coarsening_type == CS_GRID_COARSENING_SPD_RS) {
+    /* closest altenative; explicit prolongation requires scalar
+       MSR matrices, and excludes P0/P1 relaxation */
+    if (   fine_matrix_type != CS_MATRIX_MSR
+        || db_size[0] > 1 || f->eb_size[0] > 1)
+      coarsening_type = CS_GRID_COARSENING_SPD_MX;
+    else
+      c->relaxation = 0;
+  }
+
+  c->coarsening_type = coarsening_type;
+
   /* Determine fine->coarse cell connectivity (aggregation) */
 
   if (   coarsening_type == CS_GRID_COARSENING_SPD_DX
@@ -5573,9 +6476,17 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 _(cs_matrix_type_name[fine_matrix_type]));
     }
   }
+  else if (coarsening_type == CS_GRID_COARSENING_SPD_SA)
+    _automatic_aggregation_mx_msr(f, aggregation_limit, verbosity,
+                                  c->coarse_row);
+  else if (coarsening_type == CS_GRID_COARSENING_SPD_RS)
+    _automatic_aggregation_rs_msr(f, verbosity, c);
 
   _coarsen(f, c);
 
+  if (coarsening_type == CS_GRID_COARSENING_SPD_SA)
+    _smoothed_prolongation_msr(f, c);
+
   if (verbosity > 3)
     _aggregation_stats_log(f, c, verbosity);
 
@@ -5643,7 +6554,10 @@ cs_grid_coarsen(const cs_grid_t  *f,
 
   if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
 
-   _compute_coarse_quantities_msr(f, c);
+    if (c->prolong_index != NULL)
+      _compute_coarse_quantities_rap(f, c);
+    else
+      _compute_coarse_quantities_msr(f, c);
 
     /* Merge grids if we are below the threshold */
 #if defined(HAVE_MPI)
@@ -5845,7 +6759,7 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
      structure allowing threading without a specific renumbering, as
      structures are rebuilt often (so only CSR and MSR can be considered) */
 
-  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+  cs_matrix_type_t fine_matrix_type = _coarsening_matrix_type(f);
 
   cs_grid_t *c = NULL;
 
@@ -5924,6 +6838,108 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Refresh coarse grid matrix coefficients from an updated fine grid,
+ * keeping the existing aggregation and coarse structure.
+ *
+ * The fine -> coarse row (and face) connectivity and associated coarse
+ * geometric quantities built by cs_grid_coarsen() are reused, so
+ * cs_grid_free_quantities() must not have been called on either grid.
+ *
+ * Refreshing is not possible for coarse grids resulting from a merge
+ * of ranks, or when the fine grid's symmetry or block sizes do not match
+ * those used to build the coarse grid; in this case, the coarse grid is
+ * left unchanged and false is returned, so the caller may rebuild it.
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if coarse coefficients were refreshed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_refresh_coarse_quantities(const cs_grid_t  *f,
+                                  cs_grid_t        *c,
+                                  int               verbosity)
+{
+  assert(f != NULL && c != NULL);
+
+  if (c->coarse_row == NULL || f->symmetric != c->symmetric)
+    return false;
+
+  for (int i = 0; i < 4; i++) {
+    if (f->db_size[i] != c->db_size[i] || f->eb_size[i] != c->eb_size[i])
+      return false;
+  }
+
+#if defined(HAVE_MPI)
+  if (c->next_merge_stride != f->next_merge_stride)
+    return false;
+  if (c->prolong_index != NULL && c->merge_sub_size > 1)
+    return false;
+#endif
+
+  cs_matrix_type_t fine_matrix_type = _coarsening_matrix_type(f);
+
+  c->parent = f;
+
+  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+
+    /* Coarse MSR structure is rebuilt along with the values, as
+       it is only a by-product of the (kept) aggregation */
+
+    cs_matrix_destroy(&(c->_matrix));
+    cs_matrix_structure_destroy(&(c->matrix_struct));
+    c->matrix = NULL;
+
+    /* Smoothed aggregation prolongation depends on the fine matrix
+       values; the classical C/F splitting and interpolation are kept */
+
+    if (c->coarsening_type == CS_GRID_COARSENING_SPD_SA)
+      _smoothed_prolongation_msr(f, c);
+
+    if (c->prolong_index != NULL)
+      _compute_coarse_quantities_rap(f, c);
+    else
+      _compute_coarse_quantities_msr(f, c);
+
+  }
+
+  else if (   f->face_cell != NULL && c->coarse_face != NULL
+           && c->_matrix != NULL) {
+
+    if (c->conv_diff)
+      _compute_coarse_quantities_conv_diff(f, c, verbosity);
+    else
+      _compute_coarse_quantities_native(f, c, verbosity);
+
+    if (c->halo != NULL)
+      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_da,
+                               c->db_size[3]);
+
+    cs_matrix_set_coefficients(c->_matrix,
+                               c->symmetric,
+                               c->db_size,
+                               c->eb_size,
+                               c->n_faces,
+                               c->face_cell,
+                               c->da,
+                               c->xa);
+
+  }
+
+  else
+    return false;
+
+  if (verbosity > 3)
+    _verify_matrix(c);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -5962,7 +6978,21 @@ cs_grid_restrict_row_var(const cs_grid_t  *f,
   for (cs_lnum_t ii = 0; ii < _c_n_cols_ext; ii++)
     c_var[ii] = 0.;
 
-  if (f->level == 0) { /* possible penalization at first level */
+  if (c->prolong_index != NULL) { /* explicit prolongation (transposed) */
+
+    const cs_lnum_t *p_index = c->prolong_index;
+    const cs_lnum_t *p_col_id = c->prolong_col_id;
+    const cs_real_t *p_val = c->prolong_val;
+
+    assert(db_size[0] == 1);
+
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      for (cs_lnum_t k = p_index[ii]; k < p_index[ii+1]; k++)
+        c_var[p_col_id[k]] += p_val[k]*f_var[ii];
+    }
+  }
+
+  else if (f->level == 0) { /* possible penalization at first level */
 
     if (db_size[0] == 1) {
       for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
@@ -6136,7 +7166,25 @@ cs_grid_prolong_row_var(const cs_grid_t  *c,
 
   coarse_row = c->coarse_row;
 
-  if (f->level == 0) {
+  if (c->prolong_index != NULL) { /* explicit prolongation */
+
+    const cs_lnum_t *p_index = c->prolong_index;
+    const cs_lnum_t *p_col_id = c->prolong_col_id;
+    const cs_real_t *p_val = c->prolong_val;
+
+    assert(db_size[0] == 1);
+
+#   pragma omp parallel for if(f_n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_real_t s = 0;
+      for (cs_lnum_t k = p_index[ii]; k < p_index[ii+1]; k++)
+        s += p_val[k]*_c_var[p_col_id[k]];
+      f_var[ii] = s;
+    }
+
+  }
+
+  else if (f->level == 0) {
 
     if (db_size[0] == 1) {
 #     pragma omp parallel if(f_n_rows > CS_THR_MIN)
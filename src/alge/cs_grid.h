@@ -57,8 +57,11 @@ typedef enum {
   CS_GRID_COARSENING_SPD_DX,         /*!< SPD, diag/extradiag ratio based */
   CS_GRID_COARSENING_SPD_MX,         /*!< SPD, max extradiag ratio based */
   CS_GRID_COARSENING_SPD_PW,         /*!< SPD, pairwise aggregation */
-  CS_GRID_COARSENING_CONV_DIFF_DX    /*!< convection+diffusion,
+  CS_GRID_COARSENING_CONV_DIFF_DX,   /*!< convection+diffusion,
                                           diag/extradiag ratio based */
+  CS_GRID_COARSENING_SPD_SA,         /*!< SPD, smoothed aggregation */
+  CS_GRID_COARSENING_SPD_RS          /*!< SPD, classical (Ruge-Stueben)
+                                          strength of connection based */
 
 } cs_grid_coarsening_t;
 
@@ -254,6 +257,21 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Set whether a grid's matrix should use single precision extra-diagonal
+ * coefficients for matrix.vector products.
+ *
+ * This only applies to matrices owned by the grid (i.e. coarse grids).
+ *
+ * parameters:
+ *   g       <-> Grid structure
+ *   reduced <-- if true, use single precision extra-diagonal coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_reduced_precision(cs_grid_t  *g,
+                              bool        reduced);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -332,6 +350,33 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
                           int               merge_stride,
                           int               verbosity);
 
+/*----------------------------------------------------------------------------
+ * Refresh coarse grid matrix coefficients from an updated fine grid,
+ * keeping the existing aggregation and coarse structure.
+ *
+ * The fine -> coarse row (and face) connectivity and associated coarse
+ * geometric quantities built by cs_grid_coarsen() are reused, so
+ * cs_grid_free_quantities() must not have been called on either grid.
+ *
+ * Refreshing is not possible for coarse grids resulting from a merge
+ * of ranks, or when the fine grid's symmetry or block sizes do not match
+ * those used to build the coarse grid; in this case, the coarse grid is
+ * left unchanged and false is returned, so the caller may rebuild it.
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if coarse coefficients were refreshed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_refresh_coarse_quantities(const cs_grid_t  *f,
+                                  cs_grid_t        *c,
+                                  int               verbosity);
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -119,6 +119,14 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/* Maximum slice height for SELL-C-sigma matrices */
+
+#define CS_MATRIX_SELL_MAX_CHUNK  32
+
+/* Maximum block size for fixed-size BSR kernels */
+
+#define CS_MATRIX_BSR_MAX_FIXED_SIZE  8
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -135,7 +143,9 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL"),
+                                      N_("BSR")};
 
 /* Full names for matrix types */
 
@@ -143,7 +153,9 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK (SELL-C-sigma)"),
+                              N_("Block Sparse Row")};
 
 /* Fill type names for matrices */
 
@@ -154,6 +166,11 @@ const char  *cs_matrix_fill_type_name[] = {"CS_MATRIX_SCALAR",
                                            "CS_MATRIX_BLOCK_D_SYM",
                                            "CS_MATRIX_BLOCK"};
 
+/* Slicing options for SELL-C-sigma matrices */
+
+static cs_lnum_t _sell_chunk_size = 8;
+static cs_lnum_t _sell_sigma = 256;
+
 #if defined (HAVE_MKL)
 
 static char _no_exclude_diag_error_str[]
@@ -827,7 +844,7 @@ _release_coeffs_native(cs_matrix_t  *matrix)
 }
 
 /*----------------------------------------------------------------------------
- * Copy diagonal of native or MSR matrix.
+ * Copy diagonal of native, MSR, or SELL-C-sigma matrix.
  *
  * parameters:
  *   matrix <-- pointer to matrix structure
@@ -843,7 +860,9 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL
+           || matrix->type == CS_MATRIX_BSR) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
@@ -1670,6 +1689,8 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
 
     BFT_FREE(ms->_col_id);
 
+    BFT_FREE(ms->split_row_id);
+
     BFT_FREE(ms);
 
     *matrix = NULL;
@@ -1677,6 +1698,59 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build split of rows based on dependency to ghost columns for a CSR
+ * or MSR matrix structure.
+ *
+ * Rows depending only on local columns are listed first, followed by
+ * rows having at least one ghost column, so that the former may be
+ * handled while halo values are being exchanged.
+ *
+ * parameters:
+ *   ms  <-> pointer to CSR matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_row_split_csr(cs_matrix_struct_csr_t  *ms)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  ms->n_halo_rows = 0;
+  ms->split_row_id = NULL;
+
+  if (ms->n_cols_ext <= n_rows)
+    return;
+
+  BFT_MALLOC(ms->split_row_id, n_rows, cs_lnum_t);
+
+  cs_lnum_t n_inner = 0, k = n_rows;
+
+  /* Halo rows are filled from the end, then reversed so as to
+     keep increasing row ids in both sets */
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    bool inner = true;
+    for (cs_lnum_t j = ms->row_index[i]; j < ms->row_index[i+1]; j++) {
+      if (ms->col_id[j] >= n_rows) {
+        inner = false;
+        break;
+      }
+    }
+    if (inner)
+      ms->split_row_id[n_inner++] = i;
+    else
+      ms->split_row_id[--k] = i;
+  }
+
+  ms->n_halo_rows = n_rows - n_inner;
+
+  for (cs_lnum_t i = 0; i < ms->n_halo_rows/2; i++) {
+    cs_lnum_t tmp = ms->split_row_id[n_inner + i];
+    ms->split_row_id[n_inner + i] = ms->split_row_id[n_rows - 1 - i];
+    ms->split_row_id[n_rows - 1 - i] = tmp;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Create a CSR matrix structure from a native matrix stucture.
  *
@@ -1828,6 +1902,8 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _build_row_split_csr(ms);
+
   return ms;
 }
 
@@ -1896,6 +1972,8 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  _build_row_split_csr(ms);
+
   return ms;
 }
 
@@ -1941,6 +2019,8 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  _build_row_split_csr(ms);
+
   return ms;
 }
 
@@ -2000,6 +2080,9 @@ _create_struct_csr_from_restrict_local(const cs_matrix_struct_csr_t  *src)
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  ms->n_halo_rows = 0;
+  ms->split_row_id = NULL;
+
   return ms;
 }
 
@@ -2629,6 +2712,77 @@ _mat_vec_p_l_csr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with CSR matrix, restricted to
+ * a given subset of rows.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   n_rows       <-- number of rows in subset
+ *   row_id       <-- ids of rows in subset
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_csr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           n_rows,
+                      const cs_lnum_t    *restrict row_id,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+
+  /* Standard case */
+
+  if (!exclude_diag) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+
+      const cs_lnum_t ii = row_id[r_id];
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii;
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+
+      const cs_lnum_t ii = row_id[r_id];
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        if (col_id[jj] != ii)
+          sii += (m_row[jj]*x[col_id[jj]]);
+      }
+
+      y[ii] = sii;
+
+    }
+  }
+
+}
+
 #if defined (HAVE_MKL)
 
 static void
@@ -3246,6 +3400,8 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->_x_val_sp = NULL;
+
   return mc;
 }
 
@@ -3263,6 +3419,8 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->_x_val_sp);
+
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3585,6 +3743,44 @@ _map_or_copy_xa_coeffs_msr(cs_matrix_t      *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update single precision copy of MSR matrix extradiagonal coefficients.
+ *
+ * This copy is only maintained if it has been activated (i.e. allocated)
+ * using cs_matrix_set_reduced_precision(), and is only handled for scalar
+ * extradiagonal terms; it is freed otherwise.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_coeffs_msr_sp(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->_x_val_sp == NULL || mc->x_val == NULL)
+    return;
+
+  if (matrix->eb_size[3] != 1) {
+    BFT_FREE(mc->_x_val_sp);
+    return;
+  }
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  BFT_REALLOC(mc->_x_val_sp, ms->row_index[n_rows], float);
+
+  /* Use same threading behavior as SpMV for NUMA performance */
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+      mc->_x_val_sp[jj] = mc->x_val[jj];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Set MSR matrix coefficients.
  *
@@ -3633,6 +3829,8 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
     if (xa != NULL)
       _set_xa_coeffs_msr_increment(matrix, symmetric, n_edges, edges, xa);
   }
+
+  _update_coeffs_msr_sp(matrix);
 }
 
 /*----------------------------------------------------------------------------
@@ -3711,6 +3909,8 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
     BFT_FREE(*d_vals_transfer);
   if (x_vals_transfer != NULL)
     BFT_FREE(*x_vals_transfer);
+
+  _update_coeffs_msr_sp(matrix);
 }
 
 /*----------------------------------------------------------------------------
@@ -3732,118 +3932,336 @@ _release_coeffs_msr(cs_matrix_t  *matrix)
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix.
+ * Add BSR extradiagonal block coefficients from graph edge values.
+ *
+ * Each edge value is a dense block of eb_size[3] values; for symmetric
+ * coefficients, the same block is used for both (i, j) and (j, i) terms,
+ * as for native matrices. The matrix coefficients should have been
+ * initialized (i.e. set to 0) before using this function.
  *
  * parameters:
- *   exclude_diag <-- exclude diagonal if true
- *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
- *   y            --> resulting vector
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
  *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_msr(bool                exclude_diag,
-                 const cs_matrix_t  *matrix,
-                 const cs_real_t    *restrict x,
-                 cs_real_t          *restrict y)
+_set_xa_coeffs_bsr_increment(cs_matrix_t        *matrix,
+                             bool                symmetric,
+                             cs_lnum_t           n_edges,
+                             const cs_lnum_2_t  *edges,
+                             const cs_real_t    *restrict xa)
 {
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  cs_lnum_t  n_rows = ms->n_rows;
-
-  /* Standard case */
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  e_stride = matrix->eb_size[3];
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  assert(edges != NULL || n_edges == 0);
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+  for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+    cs_lnum_t ii = edges[face_id][0];
+    cs_lnum_t jj = edges[face_id][1];
 
-      y[ii] = sii + mc->d_val[ii]*x[ii];
+    const cs_real_t *xa_ij, *xa_ji;
+    if (symmetric) {
+      xa_ij = xa + face_id*e_stride;
+      xa_ji = xa_ij;
+    }
+    else {
+      xa_ij = xa + 2*face_id*e_stride;
+      xa_ji = xa_ij + e_stride;
+    }
 
+    if (ii < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[ii]; ms->col_id[kk] != jj; kk++);
+      cs_real_t *m_b = mc->_x_val + kk*e_stride;
+      for (cs_lnum_t ll = 0; ll < e_stride; ll++)
+        m_b[ll] += xa_ij[ll];
+    }
+    if (jj < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[jj]; ms->col_id[kk] != ii; kk++);
+      cs_real_t *m_b = mc->_x_val + kk*e_stride;
+      for (cs_lnum_t ll = 0; ll < e_stride; ll++)
+        m_b[ll] += xa_ji[ll];
     }
 
   }
+}
 
-  /* Exclude diagonal */
-
-  else {
+/*----------------------------------------------------------------------------
+ * Set BSR matrix coefficients.
+ *
+ * BSR matrices share the MSR structure and coefficients representation,
+ * so this only differs from the MSR variant when extradiagonal terms are
+ * dense blocks.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+static void
+_set_coeffs_bsr(cs_matrix_t         *matrix,
+                bool                 symmetric,
+                bool                 copy,
+                cs_lnum_t            n_edges,
+                const cs_lnum_2_t  *restrict edges,
+                const cs_real_t    *restrict da,
+                const cs_real_t    *restrict xa)
+{
+  if (matrix->eb_size[3] <= 1) {
+    _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+    return;
+  }
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+  /* Map or copy diagonal values */
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+  _map_or_copy_da_coeffs_msr(matrix, copy, da);
 
-      y[ii] = sii;
+  /* Extradiagonal blocks are always copied (allocated and zeroed here) */
 
-    }
-  }
+  _map_or_copy_xa_coeffs_msr(matrix, true, NULL);
 
+  if (xa != NULL)
+    _set_xa_coeffs_bsr_increment(matrix, symmetric, n_edges, edges, xa);
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix.
+ * Local matrix.vector product y = A.x with MSR matrix, restricted to
+ * a given subset of rows (or all rows if row_id is NULL), using the single
+ * precision copy of extradiagonal coefficients.
+ *
+ * Diagonal coefficients and vectors remain in double precision, as do
+ * the accumulations.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
  *   matrix       <-- pointer to matrix structure
+ *   n_rows       <-- number of rows in subset
+ *   row_id       <-- ids of rows in subset, or NULL
  *   x            <-- multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
-                           const cs_matrix_t  *matrix,
-                           const cs_real_t    *restrict x,
-                           cs_real_t          *restrict y)
+_mat_vec_p_l_msr_sp_rows(bool                exclude_diag,
+                         const cs_matrix_t  *matrix,
+                         cs_lnum_t           n_rows,
+                         const cs_lnum_t    *restrict row_id,
+                         const cs_real_t    *restrict x,
+                         cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  cs_lnum_t  n_rows = ms->n_rows;
-
-  /* Standard case */
 
-  if (!exclude_diag && mc->d_val != NULL) {
-
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-      cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, CS_CL);
-      if (n_s_rows > n_rows)
-        n_s_rows = n_rows;
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_s_rows; ii++) {
+    const cs_lnum_t ii = (row_id != NULL) ? row_id[r_id] : r_id;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_sp + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
 
-        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-        const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-        cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-        cs_real_t sii = 0.0;
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          sii += (m_row[jj]*x[col_id[jj]]);
+    if (d_val != NULL)
+      sii += d_val[ii]*x[ii];
 
-        y[ii] = sii + mc->d_val[ii]*x[ii];
+    y[ii] = sii;
 
-      }
+  }
+}
 
-#     pragma omp for schedule(dynamic, CS_CL)
-      for (cs_lnum_t ii = n_s_rows; ii < n_rows; ii++) {
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * using the single precision copy of extradiagonal coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+static void
+_b_mat_vec_p_l_msr_sp(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t     x[restrict],
+                      cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_sp + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (use_diag)
+      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        y[ii*db_size[1] + kk]
+          += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr(bool                exclude_diag,
+                 const cs_matrix_t  *matrix,
+                 const cs_real_t    *restrict x,
+                 cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Reduced precision case */
+
+  if (mc->_x_val_sp != NULL) {
+    _mat_vec_p_l_msr_sp_rows(exclude_diag, matrix, n_rows, NULL, x, y);
+    return;
+  }
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii + mc->d_val[ii]*x[ii];
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii;
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t    *restrict x,
+                           cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Reduced precision case */
+
+  if (mc->_x_val_sp != NULL) {
+    _mat_vec_p_l_msr_sp_rows(exclude_diag, matrix, n_rows, NULL, x, y);
+    return;
+  }
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+
+      cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, CS_CL);
+      if (n_s_rows > n_rows)
+        n_s_rows = n_rows;
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_s_rows; ii++) {
+
+        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+        const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+        cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+        cs_real_t sii = 0.0;
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          sii += (m_row[jj]*x[col_id[jj]]);
+
+        y[ii] = sii + mc->d_val[ii]*x[ii];
+
+      }
+
+#     pragma omp for schedule(dynamic, CS_CL)
+      for (cs_lnum_t ii = n_s_rows; ii < n_rows; ii++) {
+
+        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
         const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
         cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
         cs_real_t sii = 0.0;
@@ -3906,6 +4324,82 @@ _mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, restricted to
+ * a given subset of rows.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   n_rows       <-- number of rows in subset
+ *   row_id       <-- ids of rows in subset
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           n_rows,
+                      const cs_lnum_t    *restrict row_id,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  /* Reduced precision case */
+
+  if (mc->_x_val_sp != NULL) {
+    _mat_vec_p_l_msr_sp_rows(exclude_diag, matrix, n_rows, row_id, x, y);
+    return;
+  }
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+
+      const cs_lnum_t ii = row_id[r_id];
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii + mc->d_val[ii]*x[ii];
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+
+      const cs_lnum_t ii = row_id[r_id];
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii;
+
+    }
+  }
+
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, blocked version.
  *
@@ -3965,20 +4459,787 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
       for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
         y[ii*db_size[1] + kk] = 0.;
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-          y[ii*db_size[1] + kk]
-            += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
-        }
-      }
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+          y[ii*db_size[1] + kk]
+            += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+        }
+      }
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, 3x3 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_msr(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      _dense_3_3_ax(ii, mc->d_val, x, y);
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+      }
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      for (cs_lnum_t kk = 0; kk < 3; kk++)
+        y[ii*3 + kk] = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+      }
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_mat_vec_p_l_msr(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      _dense_6_6_ax(ii, mc->d_val, x, y);
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+      }
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+      }
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t     x[restrict],
+                   cs_real_t           y[restrict])
+{
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->_x_val_sp != NULL)
+    _b_mat_vec_p_l_msr_sp(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
+    _6_6_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else
+    _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix, generic version.
+ *
+ * Extradiagonal terms may be either scalar (eb_size[0] = 1) or dense
+ * blocks of the same size as diagonal blocks; block sizes are handled
+ * at runtime.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_bsr_generic(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  if (matrix->eb_size[0] == 1) {
+    _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
+    return;
+  }
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL);
+
+# pragma omp parallel for  if(n_rows*db_size[0] > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row
+      = mc->x_val + ms->row_index[ii]*eb_size[3];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (use_diag)
+      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+          y[ii*db_size[1] + kk]
+            +=   m_row[jj*eb_size[3] + kk*eb_size[2] + ll]
+               * x[col_id[jj]*db_size[1] + ll];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Generate fixed block size row kernels for BSR matrix.vector products.
+ *
+ * For a block size n, this defines _<n>_<n>_bsr_row_ax(), computing
+ * y[ii] = D[ii].x[ii] + sum_j A[ii, j].x[j] for one block row, with
+ * unpadded n*n blocks. The diagonal contribution is skipped if d_val is
+ * NULL, and extradiagonal terms are dense n*n blocks if dense_eb is true,
+ * or scalars otherwise. Using a compile-time block size allows the
+ * compiler to fully unroll inner loops and keep accumulators in registers.
+ *----------------------------------------------------------------------------*/
+
+#define _CS_MATRIX_BSR_ROW_AX(_n)                                        \
+                                                                         \
+static inline void                                                       \
+_##_n##_##_n##_bsr_row_ax(cs_lnum_t                  ii,                 \
+                          bool                       dense_eb,           \
+                          const cs_lnum_t  *restrict row_index,          \
+                          const cs_lnum_t  *restrict col_id,             \
+                          const cs_real_t  *restrict d_val,              \
+                          const cs_real_t  *restrict x_val,              \
+                          const cs_real_t  *restrict x,                  \
+                          cs_real_t        *restrict y)                  \
+{                                                                        \
+  cs_real_t  s[_n];                                                      \
+                                                                         \
+  if (d_val != NULL) {                                                   \
+    const cs_real_t *restrict a = d_val + ii*(_n*_n);                    \
+    const cs_real_t *restrict _x = x + ii*_n;                            \
+    for (int kk = 0; kk < _n; kk++) {                                    \
+      s[kk] = 0.;                                                        \
+      for (int ll = 0; ll < _n; ll++)                                    \
+        s[kk] += a[kk*_n + ll] * _x[ll];                                 \
+    }                                                                    \
+  }                                                                      \
+  else {                                                                 \
+    for (int kk = 0; kk < _n; kk++)                                      \
+      s[kk] = 0.;                                                        \
+  }                                                                      \
+                                                                         \
+  if (dense_eb) {                                                        \
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {     \
+      const cs_real_t *restrict a = x_val + jj*(_n*_n);                  \
+      const cs_real_t *restrict _x = x + col_id[jj]*_n;                  \
+      for (int kk = 0; kk < _n; kk++) {                                  \
+        for (int ll = 0; ll < _n; ll++)                                  \
+          s[kk] += a[kk*_n + ll] * _x[ll];                               \
+      }                                                                  \
+    }                                                                    \
+  }                                                                      \
+  else {                                                                 \
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {     \
+      const cs_real_t *restrict _x = x + col_id[jj]*_n;                  \
+      for (int kk = 0; kk < _n; kk++)                                    \
+        s[kk] += x_val[jj] * _x[kk];                                     \
+    }                                                                    \
+  }                                                                      \
+                                                                         \
+  for (int kk = 0; kk < _n; kk++)                                        \
+    y[ii*_n + kk] = s[kk];                                               \
+}
+
+_CS_MATRIX_BSR_ROW_AX(2)
+_CS_MATRIX_BSR_ROW_AX(3)
+_CS_MATRIX_BSR_ROW_AX(4)
+_CS_MATRIX_BSR_ROW_AX(5)
+_CS_MATRIX_BSR_ROW_AX(6)
+_CS_MATRIX_BSR_ROW_AX(7)
+_CS_MATRIX_BSR_ROW_AX(8)
+
+#undef _CS_MATRIX_BSR_ROW_AX
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix.
+ *
+ * This variant uses fixed block size kernels for unpadded blocks of
+ * size 2 to 8, and falls back to the generic variant otherwise.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_bsr(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t     x[restrict],
+                   cs_real_t           y[restrict])
+{
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+  const cs_lnum_t  b_size = db_size[0];
+  const bool dense_eb = (eb_size[0] > 1);
+
+  if (   b_size < 2 || b_size > CS_MATRIX_BSR_MAX_FIXED_SIZE
+      || db_size[1] != b_size || db_size[3] != b_size*b_size
+      || (dense_eb && (   eb_size[0] != b_size
+                       || eb_size[3] != b_size*b_size))) {
+    _b_mat_vec_p_l_bsr_generic(exclude_diag, matrix, x, y);
+    return;
+  }
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t *restrict row_index = ms->row_index;
+  const cs_lnum_t *restrict col_id = ms->col_id;
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+  const cs_real_t *restrict x_val = mc->x_val;
+
+  /* The switch is loop-invariant and always predicted, while each case
+     is fully specialized for its block size */
+
+# pragma omp parallel for  if(n_rows*b_size > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    switch(b_size) {
+    case 2:
+      _2_2_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    case 3:
+      _3_3_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    case 4:
+      _4_4_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    case 5:
+      _5_5_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    case 6:
+      _6_6_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    case 7:
+      _7_7_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    default:
+      _8_8_bsr_row_ax(ii, dense_eb, row_index, col_id, d_val, x_val, x, y);
+      break;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  int n_rows = ms->n_rows;
+  char transa[] = "n";
+
+  mkl_cspblas_dcsrgemv(transa,
+                       &n_rows,
+                       mc->x_val,
+                       ms->row_index,
+                       ms->col_id,
+                       (double *)x,
+                       y);
+
+  /* Add diagonal contribution */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+    cs_lnum_t ii;
+    const double *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      y[ii] += da[ii] * x[ii];
+  }
+}
+
+#endif /* defined (HAVE_MKL) */
+
+/*----------------------------------------------------------------------------
+ * Create a SELL-C-sigma matrix structure from an MSR matrix structure.
+ *
+ * Rows are sorted by decreasing length within windows of sigma rows,
+ * then grouped in slices of chunk_size rows, each slice being padded
+ * to the length of its longest row. Column ids are stored column-major
+ * within each slice, so that consecutive rows of a slice may be handled
+ * using contiguous memory accesses.
+ *
+ * The MSR structure is absorbed in the new structure, and freed.
+ *
+ * parameters:
+ *   ms_csr <-> pointer to MSR-type CSR structure (freed on return)
+ *
+ * returns:
+ *   pointer to allocated SELL-C-sigma structure
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_matrix_struct_csr_t  *ms_csr)
+{
+  cs_matrix_struct_sell_t  *ms;
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  /* Take ownership of base MSR structure */
+
+  memcpy(&(ms->csr), ms_csr, sizeof(cs_matrix_struct_csr_t));
+  BFT_FREE(ms_csr);
+
+  const cs_lnum_t  n_rows = ms->csr.n_rows;
+  const cs_lnum_t  *row_index = ms->csr.row_index;
+
+  const cs_lnum_t  c_size = _sell_chunk_size;
+  cs_lnum_t  sigma = 1;
+  if (_sell_sigma > 1)
+    sigma = ((_sell_sigma + c_size - 1) / c_size) * c_size;
+
+  ms->chunk_size = c_size;
+  ms->sigma = sigma;
+  ms->n_slices = (n_rows + c_size - 1) / c_size;
+
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t  n_s_rows = n_slices*c_size;
+
+  BFT_MALLOC(ms->slice_index, n_slices + 1, cs_lnum_t);
+  BFT_MALLOC(ms->row_id, n_s_rows, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    ms->row_id[ii] = ii;
+  for (cs_lnum_t ii = n_rows; ii < n_s_rows; ii++)
+    ms->row_id[ii] = -1;
+
+  /* Sort rows by decreasing length within each window; a counting
+     sort is used, which is stable, so the initial row ordering
+     is preserved for rows of equal length */
+
+  if (sigma > 1 && n_rows > 0) {
+
+    cs_lnum_t  max_len = 0;
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_lnum_t  n_cols = row_index[ii+1] - row_index[ii];
+      if (n_cols > max_len)
+        max_len = n_cols;
+    }
+
+    cs_lnum_t  *count;
+    BFT_MALLOC(count, max_len + 2, cs_lnum_t);
+
+    for (cs_lnum_t w_s = 0; w_s < n_rows; w_s += sigma) {
+
+      cs_lnum_t  w_e = CS_MIN(w_s + sigma, n_rows);
+
+      for (cs_lnum_t k = 0; k < max_len + 2; k++)
+        count[k] = 0;
+
+      for (cs_lnum_t ii = w_s; ii < w_e; ii++) {
+        cs_lnum_t  n_cols = row_index[ii+1] - row_index[ii];
+        count[max_len - n_cols + 1] += 1;
+      }
+
+      for (cs_lnum_t k = 1; k < max_len + 2; k++)
+        count[k] += count[k-1];
+
+      for (cs_lnum_t ii = w_s; ii < w_e; ii++) {
+        cs_lnum_t  n_cols = row_index[ii+1] - row_index[ii];
+        ms->row_id[w_s + count[max_len - n_cols]] = ii;
+        count[max_len - n_cols] += 1;
+      }
+
+    }
+
+    BFT_FREE(count);
+
+  }
+
+  /* Slice widths and index */
+
+  ms->slice_index[0] = 0;
+
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    const cs_lnum_t  *s_row_id = ms->row_id + s_id*c_size;
+    cs_lnum_t  s_width = 0;
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      cs_lnum_t  ii = s_row_id[c];
+      if (ii > -1) {
+        cs_lnum_t  n_cols = row_index[ii+1] - row_index[ii];
+        if (n_cols > s_width)
+          s_width = n_cols;
+      }
+    }
+    ms->slice_index[s_id + 1] = ms->slice_index[s_id] + s_width*c_size;
+  }
+
+  /* Sliced column ids; padding entries refer to the row itself
+     (or to the first row for padding rows), so as to remain valid */
+
+  BFT_MALLOC(ms->col_id, ms->slice_index[n_slices], cs_lnum_t);
+
+# pragma omp parallel for  if(n_s_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t  *s_row_id = ms->row_id + s_id*c_size;
+    const cs_lnum_t  s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
+    cs_lnum_t  *s_col_id = ms->col_id + ms->slice_index[s_id];
+
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      cs_lnum_t  ii = s_row_id[c];
+      cs_lnum_t  n_cols = 0, pad_id = 0;
+      if (ii > -1) {
+        const cs_lnum_t  *col_id = ms->csr.col_id + row_index[ii];
+        n_cols = row_index[ii+1] - row_index[ii];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          s_col_id[jj*c_size + c] = col_id[jj];
+        pad_id = ii;
+      }
+      for (cs_lnum_t jj = n_cols; jj < s_width; jj++)
+        s_col_id[jj*c_size + c] = pad_id;
+    }
+
+  }
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL-C-sigma matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL-C-sigma matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_sell_t  *ms = *matrix;
+
+    BFT_FREE(ms->csr._row_index);
+    BFT_FREE(ms->csr._col_id);
+    BFT_FREE(ms->csr.split_row_id);
+
+    BFT_FREE(ms->slice_index);
+    BFT_FREE(ms->row_id);
+    BFT_FREE(ms->col_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create SELL-C-sigma matrix coefficients.
+ *
+ * returns:
+ *   pointer to allocated SELL-C-sigma coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_sell_t *
+_create_coeff_sell(void)
+{
+  cs_matrix_coeff_sell_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_sell_t);
+
+  /* Initialize */
+
+  mc->msr.max_db_size = 0;
+  mc->msr.max_eb_size = 0;
+
+  mc->msr.d_val = NULL;
+  mc->msr.x_val = NULL;
+
+  mc->msr._d_val = NULL;
+  mc->msr._x_val = NULL;
+
+  mc->msr._x_val_sp = NULL;
+
+  mc->s_size = 0;
+  mc->s_val = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy SELL-C-sigma matrix coefficients.
+ *
+ * parameters:
+ *   coeff  <->  pointer to SELL-C-sigma matrix coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_sell(cs_matrix_coeff_sell_t  **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL) {
+
+    cs_matrix_coeff_sell_t  *mc = *coeff;
+
+    BFT_FREE(mc->msr._x_val_sp);
+    BFT_FREE(mc->msr._x_val);
+    BFT_FREE(mc->msr._d_val);
+
+    BFT_FREE(mc->s_val);
+
+    BFT_FREE(*coeff);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update sliced extra-diagonal coefficients of a SELL-C-sigma matrix
+ * based on its MSR-type coefficients.
+ *
+ * This must be called whenever the MSR-type extra-diagonal values
+ * have been modified.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t  e_stride
+    = (matrix->eb_size[3] > 1) ? matrix->eb_size[3] : 1;
+  const cs_lnum_t  n_s_vals = ms->slice_index[n_slices]*e_stride;
+
+  const cs_lnum_t  *row_index = ms->csr.row_index;
+  const cs_real_t  *x_val = mc->msr.x_val;
+
+  if (mc->s_size < n_s_vals) {
+    BFT_REALLOC(mc->s_val, n_s_vals, cs_real_t);
+    mc->s_size = n_s_vals;
+  }
+
+# pragma omp parallel for  if(n_slices*c_size > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t  *s_row_id = ms->row_id + s_id*c_size;
+    const cs_lnum_t  s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
+    cs_real_t  *s_val = mc->s_val + ms->slice_index[s_id]*e_stride;
+
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      cs_lnum_t  ii = s_row_id[c];
+      cs_lnum_t  n_cols = 0;
+      if (ii > -1 && x_val != NULL) {
+        const cs_real_t  *m_row = x_val + row_index[ii]*e_stride;
+        n_cols = row_index[ii+1] - row_index[ii];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < e_stride; kk++)
+            s_val[(jj*c_size + c)*e_stride + kk] = m_row[jj*e_stride + kk];
+        }
+      }
+      for (cs_lnum_t jj = n_cols; jj < s_width; jj++) {
+        for (cs_lnum_t kk = 0; kk < e_stride; kk++)
+          s_val[(jj*c_size + c)*e_stride + kk] = 0.;
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL-C-sigma matrix coefficients.
+ *
+ * Coefficients are first defined in MSR form, then copied to the
+ * sliced layout.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+
+  _update_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for finalization of SELL-C-sigma matrix coefficients assembly.
+ *
+ * parameters:
+ *   matrix_p <-> untyped pointer to matrix description structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_end(void  *matrix_p)
+{
+  _update_coeffs_sell((cs_matrix_t *)matrix_p);
+}
 
-    }
-  }
+/*----------------------------------------------------------------------------
+ * Function for finalization of MSR matrix coefficients assembly.
+ *
+ * parameters:
+ *   matrix_p <-> untyped pointer to matrix description structure
+ *----------------------------------------------------------------------------*/
 
+static void
+_msr_assembler_values_end(void  *matrix_p)
+{
+  _update_coeffs_msr_sp((cs_matrix_t *)matrix_p);
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, 3x3 blocked version.
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
@@ -3988,65 +5249,119 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
  *----------------------------------------------------------------------------*/
 
 static void
-_3_3_mat_vec_p_l_msr(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
-                     cs_real_t          *restrict y)
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
 {
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_slices = ms->n_slices;
 
-  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
 
-  /* Standard case */
+# pragma omp parallel for  if(n_slices*c_size > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
 
-  if (!exclude_diag && mc->d_val != NULL) {
+    const cs_lnum_t *restrict row_id = ms->row_id + s_id*c_size;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[s_id];
+    const cs_real_t *restrict m_val = mc->s_val + ms->slice_index[s_id];
+    const cs_lnum_t  s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_real_t  sii[CS_MATRIX_SELL_MAX_CHUNK];
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    for (cs_lnum_t c = 0; c < c_size; c++)
+      sii[c] = 0.;
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+    for (cs_lnum_t jj = 0; jj < s_width; jj++) {
+      for (cs_lnum_t c = 0; c < c_size; c++)
+        sii[c] += m_val[jj*c_size + c] * x[col_id[jj*c_size + c]];
+    }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+    if (d_val != NULL) {
+      for (cs_lnum_t c = 0; c < c_size; c++) {
+        cs_lnum_t ii = row_id[c];
+        if (ii > -1)
+          y[ii] = sii[c] + d_val[ii]*x[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t c = 0; c < c_size; c++) {
+        cs_lnum_t ii = row_id[c];
+        if (ii > -1)
+          y[ii] = sii[c];
       }
-
     }
 
   }
+}
 
-  /* Exclude diagonal */
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-  else {
+static void
+_b_mat_vec_p_l_sell_generic(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t     x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t *db_size = matrix->db_size;
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+# pragma omp parallel for  if(n_slices*c_size > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        y[ii*3 + kk] = 0.;
+    const cs_lnum_t *restrict row_id = ms->row_id + s_id*c_size;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[s_id];
+    const cs_real_t *restrict m_val = mc->s_val + ms->slice_index[s_id];
+    const cs_lnum_t  s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      cs_lnum_t ii = row_id[c];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk] = 0.;
       }
+    }
 
+    for (cs_lnum_t jj = 0; jj < s_width; jj++) {
+      for (cs_lnum_t c = 0; c < c_size; c++) {
+        cs_lnum_t ii = row_id[c];
+        if (ii < 0)
+          continue;
+        const cs_real_t a = m_val[jj*c_size + c];
+        const cs_lnum_t k_id = col_id[jj*c_size + c];
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk] += a*x[k_id*db_size[1] + kk];
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * 3x3 blocked version.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
@@ -4056,65 +5371,68 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
  *----------------------------------------------------------------------------*/
 
 static void
-_6_6_mat_vec_p_l_msr(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
-                     cs_real_t           y[restrict])
+_3_3_mat_vec_p_l_sell(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
 {
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_slices = ms->n_slices;
 
-  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
 
-  /* Standard case */
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+# pragma omp parallel for  if(n_slices*c_size > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t *restrict row_id = ms->row_id + s_id*c_size;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[s_id];
+    const cs_real_t *restrict m_val = mc->s_val + ms->slice_index[s_id];
+    const cs_lnum_t  s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t  sii[CS_MATRIX_SELL_MAX_CHUNK][3];
 
-      _dense_6_6_ax(ii, mc->d_val, x, y);
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      sii[c][0] = 0.;
+      sii[c][1] = 0.;
+      sii[c][2] = 0.;
+    }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+    for (cs_lnum_t jj = 0; jj < s_width; jj++) {
+      for (cs_lnum_t c = 0; c < c_size; c++) {
+        const cs_real_t a = m_val[jj*c_size + c];
+        const cs_lnum_t k_id = col_id[jj*c_size + c];
+        sii[c][0] += a*x[k_id*3];
+        sii[c][1] += a*x[k_id*3 + 1];
+        sii[c][2] += a*x[k_id*3 + 2];
       }
-
     }
 
-  }
-
-  /* Exclude diagonal */
-
-  else {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-
-      for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
-
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+    for (cs_lnum_t c = 0; c < c_size; c++) {
+      cs_lnum_t ii = row_id[c];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL) {
+        _dense_3_3_ax(ii, d_val, x, y);
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] += sii[c][kk];
+      }
+      else {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] = sii[c][kk];
       }
-
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, blocked version.
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * blocked version.
  *
  * This variant uses fixed block size variants for common cases.
  *
@@ -4126,66 +5444,18 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
  *----------------------------------------------------------------------------*/
 
 static void
-_b_mat_vec_p_l_msr(bool                exclude_diag,
-                   const cs_matrix_t  *matrix,
-                   const cs_real_t     x[restrict],
-                   cs_real_t           y[restrict])
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
 {
   if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
-    _3_3_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
-
-  else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
-    _6_6_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+    _3_3_mat_vec_p_l_sell(exclude_diag, matrix, x, y);
 
   else
-    _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
-}
-
-/*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, using MKL
- *
- * parameters:
- *   exclude_diag <-- exclude diagonal if true
- *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
- *   y            --> resulting vector
- *----------------------------------------------------------------------------*/
-
-#if defined (HAVE_MKL)
-
-static void
-_mat_vec_p_l_msr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
-                     cs_real_t           y[restrict])
-{
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-
-  int n_rows = ms->n_rows;
-  char transa[] = "n";
-
-  mkl_cspblas_dcsrgemv(transa,
-                       &n_rows,
-                       mc->x_val,
-                       ms->row_index,
-                       ms->col_id,
-                       (double *)x,
-                       y);
-
-  /* Add diagonal contribution */
-
-  if (!exclude_diag && mc->d_val != NULL) {
-    cs_lnum_t ii;
-    const double *restrict da = mc->d_val;
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      y[ii] += da[ii] * x[ii];
-  }
+    _b_mat_vec_p_l_sell_generic(exclude_diag, matrix, x, y);
 }
 
-#endif /* defined (HAVE_MKL) */
-
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -4294,6 +5564,76 @@ _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
   _pre_vector_multiply_sync_x(rotation_mode, matrix, x);
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x or y = (A-D).x, with halo update of x
+ * overlapped with the computation of rows not depending on ghost values.
+ *
+ * Overlap is only possible for scalar CSR or MSR matrices using the
+ * standard product functions, and if no rotation halo values need
+ * special treatment. In other cases, this function returns false and
+ * does nothing, so the caller should use the regular path.
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   matrix        <-- pointer to matrix structure
+ *   exclude_diag  <-- exclude diagonal if true
+ *   x             <-> multipliying vector values (ghost values updated)
+ *   y             --> resulting vector
+ *
+ * returns:
+ *   true if the product was computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_vector_multiply_overlap(cs_halo_rotation_t   rotation_mode,
+                         const cs_matrix_t   *matrix,
+                         bool                 exclude_diag,
+                         cs_real_t           *restrict x,
+                         cs_real_t           *restrict y)
+{
+  const cs_halo_t *halo = matrix->halo;
+
+  if (   matrix->db_size[3] != 1
+      || (halo->n_rotations > 0 && rotation_mode != CS_HALO_ROTATION_COPY))
+    return false;
+
+  cs_matrix_vector_product_t *spmv
+    = matrix->vector_multiply[matrix->fill_type][(exclude_diag) ? 1 : 0];
+  cs_matrix_vector_product_rows_t *spmv_rows = NULL;
+
+  if (matrix->type == CS_MATRIX_CSR) {
+    if (spmv == _mat_vec_p_l_csr)
+      spmv_rows = _mat_vec_p_l_csr_rows;
+  }
+  else if (matrix->type == CS_MATRIX_MSR) {
+    if (spmv == _mat_vec_p_l_msr || spmv == _mat_vec_p_l_msr_omp_sched)
+      spmv_rows = _mat_vec_p_l_msr_rows;
+  }
+
+  if (spmv_rows == NULL)
+    return false;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+
+  if (ms->split_row_id == NULL)
+    return false;
+
+  const cs_lnum_t n_inner_rows = ms->n_rows - ms->n_halo_rows;
+
+  _pre_vector_multiply_sync_y(matrix, y);
+
+  cs_halo_sync_start(halo, CS_HALO_STANDARD, x, 1, NULL);
+
+  spmv_rows(exclude_diag, matrix, n_inner_rows, ms->split_row_id, x, y);
+
+  cs_halo_sync_wait(halo, x, NULL);
+
+  spmv_rows(exclude_diag, matrix, ms->n_halo_rows,
+            ms->split_row_id + n_inner_rows, x, y);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Add variant
  *
@@ -4379,6 +5719,15 @@ _variant_add(const char                        *name,
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     default         (fixed-size kernels for block sizes 2 to 8)
+ *     standard
+ *     generic         (runtime block size loops)
+ *
  * parameters:
  *   m_type          <-- Matrix type
  *   numbering       <-- mesh numbering type, or NULL
@@ -4633,6 +5982,57 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 
     break;
 
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
+  case CS_MATRIX_BSR:
+
+    switch(fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      if (standard > 0) {
+        spmv[0] = _mat_vec_p_l_msr;
+        spmv[1] = _mat_vec_p_l_msr;
+      }
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+    case CS_MATRIX_BLOCK:
+      if (standard > 0) {
+        spmv[0] = _b_mat_vec_p_l_bsr;
+        spmv[1] = _b_mat_vec_p_l_bsr;
+      }
+      else if (!strcmp(func_name, "generic")) {
+        spmv[0] = _b_mat_vec_p_l_bsr_generic;
+        spmv[1] = _b_mat_vec_p_l_bsr_generic;
+      }
+      break;
+    default:
+      break;
+    }
+
+    break;
+
   default:
     break;
   }
@@ -4653,7 +6053,7 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 /*!
  * \brief Create matrix structure internals using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -4718,6 +6118,7 @@ _structure_from_assembler(cs_matrix_type_t        type,
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     if (ma_sep_diag == true)
       structure = _create_struct_csr_from_shared(false,
                                                  false, /* for safety */
@@ -4750,6 +6151,13 @@ _structure_from_assembler(cs_matrix_type_t        type,
                                               &_col_id);
     }
     break;
+
+  case CS_MATRIX_SELL:
+    structure = _create_struct_sell(_structure_from_assembler(CS_MATRIX_MSR,
+                                                              n_rows,
+                                                              n_cols_ext,
+                                                              ma));
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -4798,12 +6206,20 @@ _structure_destroy(cs_matrix_type_t   type,
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     {
       cs_matrix_struct_csr_t *_structure = *structure;
       _destroy_struct_csr(&_structure);
       *structure = _structure;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_sell_t *_structure = *structure;
+      _destroy_struct_sell(&_structure);
+      *structure = _structure;
+    }
+    break;
   default:
     assert(0);
     break;
@@ -4872,8 +6288,12 @@ _matrix_create(cs_matrix_type_t  type)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -4924,6 +6344,18 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
+  case CS_MATRIX_BSR:
+    m->set_coefficients = _set_coeffs_bsr;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
@@ -5017,12 +6449,20 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                            edges);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     ms->structure = _create_struct_csr(false,
                                        n_rows,
                                        n_cols_ext,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure = _create_struct_sell(_create_struct_csr(false,
+                                                           n_rows,
+                                                           n_cols_ext,
+                                                           n_edges,
+                                                           edges));
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5044,7 +6484,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*!
  * \brief Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -5104,6 +6544,7 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 col_id);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     ms->structure = _create_struct_csr_from_csr(false,
                                                 transfer,
                                                 false,
@@ -5112,6 +6553,16 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure
+      = _create_struct_sell(_create_struct_csr_from_csr(false,
+                                                        transfer,
+                                                        false,
+                                                        n_rows,
+                                                        n_cols_ext,
+                                                        row_index,
+                                                        col_id));
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -5197,7 +6648,7 @@ cs_matrix_structure_create_msr_shared(bool                    have_diag,
 /*!
  * \brief Create a matrix structure using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -5298,7 +6749,7 @@ cs_matrix_create(const cs_matrix_structure_t  *ms)
 /*!
  * \brief Create a matrix directly from assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -5376,8 +6827,12 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5430,6 +6885,7 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
 
   switch(m->type) {
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     {
       m->_structure = _create_struct_csr_from_restrict_local(src->structure);
       m->structure = m->_structure;
@@ -5466,6 +6922,148 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
   return m;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a SELL-C-sigma matrix with the same coefficients as a
+ *        given CSR or MSR matrix.
+ *
+ * Structure and coefficients are copied, so the resulting matrix may be
+ * used independently of the base matrix's coefficients, but it shares
+ * the base matrix's halo and numbering.
+ *
+ * \param[in]  src  reference matrix structure
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_sell_by_copy(const cs_matrix_t  *src)
+{
+  if (   src->type != CS_MATRIX_MSR
+      && (   src->type != CS_MATRIX_CSR
+          || src->fill_type > CS_MATRIX_SCALAR_SYM))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: conversion of matrix of type %s and fill %s\n"
+                "to %s is not handled."),
+              __func__,
+              _(cs_matrix_type_name[src->type]),
+              _(cs_matrix_fill_type_name[src->fill_type]),
+              _(cs_matrix_type_name[CS_MATRIX_SELL]));
+
+  const cs_lnum_t  n_rows = src->n_rows;
+  const cs_matrix_struct_csr_t  *ms_src = src->structure;
+
+  cs_lnum_t  *row_index, *col_id;
+  cs_real_t  *d_val = NULL, *x_val = NULL;
+
+  BFT_MALLOC(row_index, n_rows + 1, cs_lnum_t);
+
+  if (src->type == CS_MATRIX_MSR) {
+
+    const cs_matrix_coeff_msr_t  *mc_src = src->coeffs;
+    const cs_lnum_t  n_vals = ms_src->row_index[n_rows];
+    const cs_lnum_t  db_stride = src->db_size[3], eb_stride = src->eb_size[3];
+
+    memcpy(row_index, ms_src->row_index, (n_rows+1)*sizeof(cs_lnum_t));
+    BFT_MALLOC(col_id, n_vals, cs_lnum_t);
+    memcpy(col_id, ms_src->col_id, n_vals*sizeof(cs_lnum_t));
+
+    if (mc_src->d_val != NULL) {
+      BFT_MALLOC(d_val, n_rows*db_stride, cs_real_t);
+      memcpy(d_val, mc_src->d_val, n_rows*db_stride*sizeof(cs_real_t));
+    }
+    if (mc_src->x_val != NULL) {
+      BFT_MALLOC(x_val, n_vals*eb_stride, cs_real_t);
+      memcpy(x_val, mc_src->x_val, n_vals*eb_stride*sizeof(cs_real_t));
+    }
+
+  }
+  else { /* CSR: split diagonal and extra-diagonal values */
+
+    const cs_matrix_coeff_csr_t  *mc_src = src->coeffs;
+
+    row_index[0] = 0;
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_lnum_t  n_cols = 0;
+      for (cs_lnum_t jj = ms_src->row_index[ii];
+           jj < ms_src->row_index[ii+1];
+           jj++) {
+        if (ms_src->col_id[jj] != ii)
+          n_cols++;
+      }
+      row_index[ii+1] = row_index[ii] + n_cols;
+    }
+
+    BFT_MALLOC(col_id, row_index[n_rows], cs_lnum_t);
+
+    if (mc_src->val != NULL) {
+      BFT_MALLOC(d_val, n_rows, cs_real_t);
+      BFT_MALLOC(x_val, row_index[n_rows], cs_real_t);
+    }
+
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_lnum_t  kk = row_index[ii];
+      if (d_val != NULL)
+        d_val[ii] = 0.;
+      for (cs_lnum_t jj = ms_src->row_index[ii];
+           jj < ms_src->row_index[ii+1];
+           jj++) {
+        if (ms_src->col_id[jj] != ii) {
+          col_id[kk] = ms_src->col_id[jj];
+          if (x_val != NULL)
+            x_val[kk] = mc_src->val[jj];
+          kk++;
+        }
+        else if (d_val != NULL)
+          d_val[ii] = mc_src->val[jj];
+      }
+    }
+
+  }
+
+  /* Build matrix */
+
+  cs_matrix_t *m = _matrix_create(CS_MATRIX_SELL);
+
+  m->n_rows = n_rows;
+  m->n_cols_ext = src->n_cols_ext;
+  m->symmetric = src->symmetric;
+  m->fill_type = src->fill_type;
+  for (int i = 0; i < 4; i++) {
+    m->db_size[i] = src->db_size[i];
+    m->eb_size[i] = src->eb_size[i];
+  }
+
+  m->halo = src->halo;
+  m->numbering = src->numbering;
+
+  cs_matrix_struct_csr_t  *ms_msr
+    = _create_struct_csr_from_csr(false,
+                                  true, /* transfer */
+                                  true, /* ordered */
+                                  n_rows,
+                                  m->n_cols_ext,
+                                  &row_index,
+                                  &col_id);
+
+  m->_structure = _create_struct_sell(ms_msr);
+  m->structure = m->_structure;
+
+  cs_matrix_coeff_sell_t  *mc = m->coeffs;
+
+  mc->msr._d_val = d_val;
+  mc->msr.d_val = d_val;
+  mc->msr._x_val = x_val;
+  mc->msr.x_val = x_val;
+  mc->msr.max_db_size = m->db_size[3];
+  mc->msr.max_eb_size = m->eb_size[3];
+
+  _update_coeffs_sell(m);
+
+  return m;
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -5504,12 +7102,20 @@ cs_matrix_destroy(cs_matrix_t **matrix)
       }
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_BSR:
       {
         cs_matrix_coeff_msr_t *coeffs = m->coeffs;
         _destroy_coeff_msr(&coeffs);
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SELL:
+      {
+        cs_matrix_coeff_sell_t *coeffs = m->coeffs;
+        _destroy_coeff_sell(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5617,6 +7223,8 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     {
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
@@ -5697,6 +7305,51 @@ cs_matrix_get_halo(const cs_matrix_t  *matrix)
   return matrix->halo;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set slicing options for matrix structures of type CS_MATRIX_SELL.
+ *
+ * Options apply to structures created after this call. Rows are grouped
+ * in slices of chunk_size rows, after sorting by decreasing row length
+ * within windows of sigma rows (rounded up to a multiple of chunk_size).
+ *
+ * \param[in]  chunk_size  number of rows per slice (C), 1 to 32
+ * \param[in]  sigma       sorting window size, or 0 or 1 for no sorting
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_sell_options(cs_lnum_t  chunk_size,
+                           cs_lnum_t  sigma)
+{
+  if (chunk_size < 1 || chunk_size > CS_MATRIX_SELL_MAX_CHUNK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: chunk size %d is not in the allowed range [1, %d]."),
+              __func__, (int)chunk_size, CS_MATRIX_SELL_MAX_CHUNK);
+
+  _sell_chunk_size = chunk_size;
+  _sell_sigma = CS_MAX(sigma, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get slicing options for matrix structures of type CS_MATRIX_SELL.
+ *
+ * \param[out]  chunk_size  number of rows per slice (C), or NULL
+ * \param[out]  sigma       sorting window size, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_sell_options(cs_lnum_t  *chunk_size,
+                           cs_lnum_t  *sigma)
+{
+  if (chunk_size != NULL)
+    *chunk_size = _sell_chunk_size;
+  if (sigma != NULL)
+    *sigma = _sell_sigma;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get matrix fill type, depending on block sizes.
@@ -5945,6 +7598,7 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     _set_coeffs_msr_from_msr(matrix,
                              false, /* ignored in case of transfer */
                              row_index,
@@ -5955,6 +7609,18 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_msr_from_msr(matrix,
+                             false, /* ignored in case of transfer */
+                             row_index,
+                             col_id,
+                             d_val_p,
+                             d_val,
+                             x_val_p,
+                             x_val);
+    _update_coeffs_sell(matrix);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -6003,6 +7669,59 @@ cs_matrix_release_coefficients(cs_matrix_t  *matrix)
   _clear_fill_info(matrix);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether a matrix should use single precision extra-diagonal
+ *        coefficients for matrix.vector products.
+ *
+ * When activated, a single precision copy of the extra-diagonal
+ * coefficients is maintained and used by the matrix.vector product
+ * functions, reducing the associated memory traffic. Diagonal
+ * coefficients, vectors, and accumulations remain in double precision,
+ * as do coefficients accessed through \ref cs_matrix_get_msr_arrays
+ * (so Gauss-Seidel type smoothers are not affected).
+ *
+ * This is currently handled only for MSR matrices with scalar
+ * extra-diagonal terms, and is ignored for other matrix types
+ * (or matrices using external library variants).
+ *
+ * \param[in, out]  matrix   pointer to matrix structure
+ * \param[in]       reduced  if true, use single precision extra-diagonal
+ *                           coefficients; if false, return to default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_reduced_precision(cs_matrix_t  *matrix,
+                                bool          reduced)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (reduced == false) {
+    BFT_FREE(mc->_x_val_sp);
+    return;
+  }
+
+  if (mc->_x_val_sp == NULL && matrix->eb_size[3] <= 1) {
+    const cs_matrix_struct_csr_t  *ms = matrix->structure;
+    BFT_MALLOC(mc->_x_val_sp, ms->row_index[ms->n_rows], float);
+    if (mc->x_val == NULL) {
+      /* Coefficients not set yet: copy updated upon assignment */
+      for (cs_lnum_t ii = 0; ii < ms->row_index[ms->n_rows]; ii++)
+        mc->_x_val_sp[ii] = 0;
+    }
+    else
+      _update_coeffs_msr_sp(matrix);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a CSR matrix assembler values structure.
@@ -6053,6 +7772,7 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                             NULL);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     mav = cs_matrix_assembler_values_create(matrix->assembler,
                                             true,
                                             diag_block_size,
@@ -6062,7 +7782,19 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                             cs_matrix_msr_assembler_values_add,
                                             NULL,
                                             NULL,
-                                            NULL);
+                                            _msr_assembler_values_end);
+    break;
+  case CS_MATRIX_SELL:
+    mav = cs_matrix_assembler_values_create(matrix->assembler,
+                                            true,
+                                            diag_block_size,
+                                            extra_diag_block_size,
+                                            (void *)matrix,
+                                            cs_matrix_msr_assembler_values_init,
+                                            cs_matrix_msr_assembler_values_add,
+                                            NULL,
+                                            NULL,
+                                            _sell_assembler_values_end);
     break;
   default:
     bft_error(__FILE__, __LINE__, 0,
@@ -6213,6 +7945,8 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6354,6 +8088,8 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     {
       const cs_lnum_t _row_id = row_id / b_size;
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
@@ -6545,7 +8281,8 @@ cs_matrix_get_csr_arrays(const cs_matrix_t   *matrix,
  * \brief Get arrays describing a matrix in MSR format.
  *
  * This function only works for an MSR matrix (i.e. there is
- * no automatic conversion from another matrix type).
+ * no automatic conversion from another matrix type), or for a
+ * SELL-C-sigma matrix, whose MSR-type base arrays are returned.
  *
  * Matrix block sizes can be obtained by cs_matrix_get_diag_block_size()
  * and cs_matrix_get_extra_diag_block_size().
@@ -6574,7 +8311,9 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   if (x_val != NULL)
     *x_val = NULL;
 
-  if (matrix->type == CS_MATRIX_MSR) {
+  if (   matrix->type == CS_MATRIX_MSR
+      || matrix->type == CS_MATRIX_SELL
+      || matrix->type == CS_MATRIX_BSR) {
     const cs_matrix_struct_csr_t  *ms = matrix->structure;
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     if (row_index != NULL)
@@ -6601,6 +8340,8 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
  * \brief Matrix.vector product y = A.x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * computation of rows which do not depend on ghost values.
  *
  * \param[in]       rotation_mode  halo update option for
  *                                 rotational periodicity
@@ -6619,11 +8360,14 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, matrix, false, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
     matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
@@ -6672,6 +8416,8 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
  * \brief Matrix.vector product y = (A-D).x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * computation of rows which do not depend on ghost values.
  *
  * \param[in]       rotation_mode  halo update option for
  *                                 rotational periodicity
@@ -6690,11 +8436,14 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, matrix, true, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][1] != NULL)
     matrix->vector_multiply[matrix->fill_type][1](true, matrix, x, y);
@@ -7097,6 +8846,10 @@ cs_matrix_variant_create(cs_matrix_t  *m)
  * The matrix coefficients should be assigned, so the fill type can
  * be determined.
  *
+ * Variants whose type differs from that of the matrix (SELL-C-sigma
+ * variants for CSR and MSR matrices) must be used with a converted copy
+ * of the matrix.
+ *
  * \param[in]   m             associated matrix
  * \param[out]  n_variants    number of variants
  * \param[out]  m_variant     array of matrix variants
@@ -7357,6 +9110,28 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
 #endif /* defined(HAVE_MKL) */
 
+    /* MSR and BSR share the same structure and coefficients layout,
+       so fixed-size BSR kernels also apply to block-diagonal MSR fills */
+
+    switch(m->fill_type) {
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_bsr;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("MSR, fixed block size"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
 #if defined(HAVE_OPENMP)
 
     if (omp_get_num_threads() > 1) {
@@ -7385,6 +9160,86 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  /* SELL-C-sigma variants may also be used for CSR and MSR matrices,
+     through a converted copy (see cs_matrix_create_sell_by_copy) */
+
+  if (   m->type == CS_MATRIX_SELL || m->type == CS_MATRIX_MSR
+      || (   m->type == CS_MATRIX_CSR
+          && m->fill_type <= CS_MATRIX_SCALAR_SYM)) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL-C-sigma"),
+                 CS_MATRIX_SELL,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
+  if (m->type == CS_MATRIX_BSR) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_msr;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+    case CS_MATRIX_BLOCK:
+      vector_multiply = _b_mat_vec_p_l_bsr;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("BSR"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    switch(m->fill_type) {
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+    case CS_MATRIX_BLOCK:
+      vector_multiply = _b_mat_vec_p_l_bsr_generic;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("BSR, generic block size"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -7408,6 +9263,9 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv)
 /*!
  * \brief Apply a variant to a given matrix
  *
+ * Variants of another matrix type (such as SELL-C-sigma variants tuned
+ * for an MSR matrix) require a converted matrix, and are ignored.
+ *
  * \param[in, out]  m   pointer to matrix
  * \param[in]       mv  pointer to matrix variant pointer
  */
@@ -7424,6 +9282,9 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
       || m->fill_type < 0 || m->fill_type > CS_MATRIX_N_FILL_TYPES)
     return;
 
+  if (mv->type != m->type)
+    return;
+
   for (int i = 0; i < 2; i++)
     m->vector_multiply[m->fill_type][0] = mv->vector_multiply[0];
 }
@@ -7458,6 +9319,15 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     default         (fixed-size kernels for block sizes 2 to 8)
+ *     standard
+ *     generic         (runtime block size loops)
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -59,6 +59,10 @@ typedef enum {
   CS_MATRIX_CSR_SYM,          /*!< Compressed Symmetric Sparse Row storage */
   CS_MATRIX_MSR,              /*!< Modified Compressed Sparse Row storage
                                 (separate diagonal) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK storage (SELL-C-sigma),
+                                with MSR-type separate diagonal */
+  CS_MATRIX_BSR,              /*!< Block Sparse Row storage (MSR structure
+                                with dense extradiagonal blocks) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -171,7 +175,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*----------------------------------------------------------------------------
  * Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -246,7 +250,7 @@ cs_matrix_structure_create_msr_shared(bool                    have_diag,
 /*!
  * \brief Create a matrix structure using a matrix assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -289,7 +293,7 @@ cs_matrix_create(const cs_matrix_structure_t  *ms);
 /*!
  * \brief Create a matrix directly from assembler.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR, SELL, and BSR formats are handled.
  *
  * \param[in]  type  type of matrix considered
  * \param[in]  ma    pointer to matrix assembler structure
@@ -337,6 +341,24 @@ cs_matrix_create_by_copy(cs_matrix_t   *src);
 cs_matrix_t *
 cs_matrix_create_by_local_restrict(const cs_matrix_t  *src);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a SELL-C-sigma matrix with the same coefficients as a
+ *        given CSR or MSR matrix.
+ *
+ * Structure and coefficients are copied, so the resulting matrix may be
+ * used independently of the base matrix's coefficients, but it shares
+ * the base matrix's halo and numbering.
+ *
+ * \param[in]  src  reference matrix structure
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_sell_by_copy(const cs_matrix_t  *src);
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -439,6 +461,34 @@ cs_matrix_get_extra_diag_block_size(const cs_matrix_t  *matrix);
 const cs_halo_t *
 cs_matrix_get_halo(const cs_matrix_t  *matrix);
 
+/*----------------------------------------------------------------------------
+ * Set slicing options for matrix structures of type CS_MATRIX_SELL.
+ *
+ * Options apply to structures created after this call. Rows are grouped
+ * in slices of chunk_size rows, after sorting by decreasing row length
+ * within windows of sigma rows (rounded up to a multiple of chunk_size).
+ *
+ * parameters:
+ *   chunk_size <-- number of rows per slice (C), 1 to 32
+ *   sigma      <-- sorting window size, or 0 or 1 for no sorting
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_sell_options(cs_lnum_t  chunk_size,
+                           cs_lnum_t  sigma);
+
+/*----------------------------------------------------------------------------
+ * Get slicing options for matrix structures of type CS_MATRIX_SELL.
+ *
+ * parameters:
+ *   chunk_size --> number of rows per slice (C), or NULL
+ *   sigma      --> sorting window size, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_sell_options(cs_lnum_t  *chunk_size,
+                           cs_lnum_t  *sigma);
+
 /*----------------------------------------------------------------------------
  * Get matrix fill type, depending on block sizes.
  *
@@ -609,6 +659,29 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
 void
 cs_matrix_release_coefficients(cs_matrix_t  *matrix);
 
+/*----------------------------------------------------------------------------
+ * Set whether a matrix should use single precision extra-diagonal
+ * coefficients for matrix.vector products.
+ *
+ * When activated, a single precision copy of the extra-diagonal
+ * coefficients is maintained and used by the matrix.vector product
+ * functions. Diagonal coefficients, vectors, and accumulations remain
+ * in double precision, as do coefficients accessed through
+ * cs_matrix_get_msr_arrays().
+ *
+ * This is currently handled only for MSR matrices with scalar
+ * extra-diagonal terms, and is ignored for other matrix types.
+ *
+ * parameters:
+ *   matrix  <-> pointer to matrix structure
+ *   reduced <-- if true, use single precision extra-diagonal coefficients;
+ *               if false, return to default
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_reduced_precision(cs_matrix_t  *matrix,
+                                bool          reduced);
+
 /*----------------------------------------------------------------------------
  * Copy matrix diagonal values.
  *
@@ -784,7 +857,8 @@ cs_matrix_get_csr_arrays(const cs_matrix_t   *matrix,
  * Get arrays describing a matrix in MSR format.
  *
  * This function only works for an MSR matrix (i.e. there is
- * no automatic conversion from another matrix type).
+ * no automatic conversion from another matrix type), or for a
+ * SELL-C-sigma matrix, whose MSR-type base arrays are returned.
  *
  * Matrix block sizes can be obtained by cs_matrix_get_diag_block_size()
  * and cs_matrix_get_extra_diag_block_size().
@@ -826,6 +900,8 @@ cs_matrix_apply_variant(cs_matrix_t                *m,
  * Matrix.vector product y = A.x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * computation of rows which do not depend on ghost values.
  *
  * parameters:
  *   rotation_mode --> halo update option for rotational periodicity
@@ -863,6 +939,8 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
  * Matrix.vector product y = (A-D).x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * computation of rows which do not depend on ghost values.
  *
  * parameters:
  *   rotation_mode <-- halo update option for rotational periodicity
@@ -1010,6 +1088,10 @@ cs_matrix_msr_assembler_values_add(void             *matrix_p,
  * The matrix coefficients should be assigned, so the fill type can
  * be determined.
  *
+ * Variants whose type differs from that of the matrix (SELL-C-sigma
+ * variants for CSR and MSR matrices) must be used with a converted copy
+ * of the matrix.
+ *
  * \param[in]   m             associated matrix
  * \param[out]  n_variants    number of variants
  * \param[out]  m_variant     array of matrix variants
@@ -1049,6 +1131,9 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv);
 /*!
  * \brief Apply a variant to a given matrix
  *
+ * Variants of another matrix type (such as SELL-C-sigma variants tuned
+ * for an MSR matrix) require a converted matrix, and are ignored.
+ *
  * \param[in, out]  m   pointer to matrix
  * \param[in]       mv  pointer to matrix variant pointer
  */
@@ -1086,6 +1171,15 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     default         (fixed-size kernels for block sizes 2 to 8)
+ *     standard
+ *     generic         (runtime block size loops)
+ *
  * parameters:
  *   mv        <-> pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -182,6 +182,40 @@ void CS_PROCF (matrdt, MATRDT)
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Penalize the diagonal of a scalar matrix if it is not invertible
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_scalar_penalize_diag(int         ndircp,
+                               cs_real_t   da[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  /* If no Dirichlet condition, the diagonal is slightly increased in order
+     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
+     least 1 in order not to shift the diagonal). */
+
+  if (ndircp <= 0) {
+    const double epsi = 1.e-7;
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] = (1.+epsi)*da[cell_id];
+    }
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+  if (mq->has_disable_flag == 1) {
+# pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] += mq->c_disable_flag[cell_id];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar (or its counterpart for
  * symmetric matrices)
@@ -206,8 +240,6 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         xa[])
 {
   const cs_mesh_t *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_cells = m->n_cells;
 
   if (isym != 1 && isym != 2) {
     bft_error(__FILE__, __LINE__, 0,
@@ -248,27 +280,7 @@ cs_matrix_wrapper_scalar(int               iconvp,
 
   /* Penalization if non invertible matrix */
 
-  /* If no Dirichlet condition, the diagonal is slightly increased in order
-     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
-     least 1 in order not to shift the diagonal). */
-
-  if (ndircp <= 0) {
-    const double epsi = 1.e-7;
-
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] = (1.+epsi)*da[cell_id];
-    }
-  }
-
-  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
-  if (mq->has_disable_flag == 1) {
-# pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] += mq->c_disable_flag[cell_id];
-    }
-  }
-
+  cs_matrix_scalar_penalize_diag(ndircp, da);
 }
 
 /*----------------------------------------------------------------------------
@@ -297,7 +309,6 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
                                    cs_real_t         xa_diff[])
 {
   const cs_mesh_t *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_i_faces = m->n_i_faces;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
@@ -353,27 +364,7 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
 
   /* Penalization if non invertible matrix */
 
-  /* If no Dirichlet condition, the diagonal is slightly increased in order
-     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
-     least 1 in order not to shift the diagonal). */
-
-  if (ndircp <= 0) {
-    const double epsi = 1.e-7;
-
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] = (1.+epsi)*da[cell_id];
-    }
-  }
-
-  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
-  if (mq->has_disable_flag == 1) {
-# pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] += mq->c_disable_flag[cell_id];
-    }
-  }
-
+  cs_matrix_scalar_penalize_diag(ndircp, da);
 }
 
 /*----------------------------------------------------------------------------
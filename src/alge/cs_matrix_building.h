@@ -101,6 +101,14 @@ void CS_PROCF (matrdt, MATRDT)
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Penalize the diagonal of a scalar matrix if it is not invertible
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_scalar_penalize_diag(int         ndircp,
+                               cs_real_t   da[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar (or its counterpart for
  * symmetric matrices)
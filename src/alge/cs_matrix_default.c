@@ -539,7 +539,7 @@ cs_matrix_default(bool        symmetric,
 
   /* Modify in case unsupported */
 
-  if (mft == CS_MATRIX_BLOCK)
+  if (mft == CS_MATRIX_BLOCK && t != CS_MATRIX_BSR)
     t = CS_MATRIX_NATIVE;
 
   else if (t == CS_MATRIX_CSR_SYM) {
@@ -633,8 +633,22 @@ cs_matrix_default_set_tuned(cs_matrix_t  *m)
 
   }
 
-  if (_matrix_variant_tuned[m->type][m->fill_type] != NULL)
-    cs_matrix_variant_apply(m, _matrix_variant_tuned[m->type][m->fill_type]);
+  cs_matrix_variant_t *mv = _matrix_variant_tuned[m->type][m->fill_type];
+
+  if (mv == NULL)
+    return;
+
+  /* If tuning selected another matrix type (i.e. SELL-C-sigma for a
+     CSR or MSR matrix), switch the default type for this fill type
+     (unless it was set to another type), so that it is used for
+     matrices built from now on; the current matrix is left unchanged. */
+
+  if (mv->type != m->type) {
+    if (_default_type[m->fill_type] == m->type)
+      _default_type[m->fill_type] = mv->type;
+  }
+  else
+    cs_matrix_variant_apply(m, mv);
 }
 
 /*----------------------------------------------------------------------------
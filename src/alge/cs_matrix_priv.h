@@ -83,6 +83,14 @@ typedef void
                               const cs_real_t    *restrict x,
                               cs_real_t          *restrict y);
 
+typedef void
+(cs_matrix_vector_product_rows_t) (bool                exclude_diag,
+                                   const cs_matrix_t  *matrix,
+                                   cs_lnum_t           n_rows,
+                                   const cs_lnum_t    *restrict row_id,
+                                   const cs_real_t    *restrict x,
+                                   cs_real_t          *restrict y);
+
 /*----------------------------------------------------------------------------
  * Matrix types
  *----------------------------------------------------------------------------*/
@@ -152,6 +160,15 @@ typedef struct _cs_matrix_struct_csr_t {
   cs_lnum_t        *_row_index;       /* Row index (0 to n-1), if owner */
   cs_lnum_t        *_col_id;          /* Column id (0 to n-1), if owner */
 
+  /* Split of rows based on ghost column dependency, used to overlap
+     halo exchanges with computation */
+
+  cs_lnum_t         n_halo_rows;      /* Number of rows with ghost columns */
+  cs_lnum_t        *split_row_id;     /* Ids of rows depending only on local
+                                         columns, followed by those of the
+                                         n_halo_rows rows with ghost columns
+                                         (NULL if n_cols_ext == n_rows) */
+
 } cs_matrix_struct_csr_t;
 
 /* CSR matrix coefficients representation */
@@ -233,8 +250,52 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  float            *_x_val_sp;        /* Single precision copy of extra-
+                                         diagonal coefficients, used for
+                                         matrix.vector products if
+                                         non-NULL */
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL-C-sigma (Sliced ELLPACK) matrix structure representation */
+/*---------------------------------------------------------------*/
+
+/* The MSR-type base structure is kept as first member, so that functions
+   handling an MSR structure may also be applied to this type; the sliced
+   arrays are only used for matrix.vector products. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_matrix_struct_csr_t  csr;        /* Base MSR structure (no diagonal) */
+
+  cs_lnum_t         chunk_size;       /* Number of rows per slice (C) */
+  cs_lnum_t         sigma;            /* Sorting window size, in rows */
+  cs_lnum_t         n_slices;         /* Number of slices */
+
+  cs_lnum_t        *slice_index;      /* Start of each slice in sliced
+                                         arrays (size: n_slices + 1) */
+  cs_lnum_t        *row_id;           /* Row ids in slice order, -1 for
+                                         padding rows
+                                         (size: n_slices*chunk_size) */
+  cs_lnum_t        *col_id;           /* Column ids, stored column-major
+                                         within each slice; padding
+                                         entries refer to the row itself */
+
+} cs_matrix_struct_sell_t;
+
+/* SELL-C-sigma matrix coefficients representation */
+/*-------------------------------------------------*/
+
+typedef struct _cs_matrix_coeff_sell_t {
+
+  cs_matrix_coeff_msr_t  msr;         /* Base MSR coefficients */
+
+  cs_lnum_t        s_size;            /* Current allocated size of s_val */
+  cs_real_t       *s_val;             /* Extra-diagonal coefficients in
+                                         sliced order (0 for padding) */
+
+} cs_matrix_coeff_sell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
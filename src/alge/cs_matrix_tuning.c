@@ -150,7 +150,7 @@ _matrix_tune_test(const cs_matrix_t     *m,
   /*-----------------------------------------*/
 
   cs_lnum_t n_cols = cs_matrix_get_n_columns(m);
-  cs_lnum_t b_size = cs_matrix_get_diag_block_size(m)[0];
+  cs_lnum_t b_size = cs_matrix_get_diag_block_size(m)[1];
 
   cs_lnum_t n = n_cols*b_size;
 
@@ -169,6 +169,11 @@ _matrix_tune_test(const cs_matrix_t     *m,
     y[i] = 0.0;
   }
 
+  /* Variants of another type are measured on a converted copy,
+     built on first use */
+
+  cs_matrix_t *m_sell = NULL;
+
   /* Loop on variant types */
   /*-----------------------*/
 
@@ -176,6 +181,19 @@ _matrix_tune_test(const cs_matrix_t     *m,
 
     const cs_matrix_variant_t *v = m_variant + v_id;
 
+    const cs_matrix_t *m_v = m;
+
+    if (v->type != m->type) {
+      if (v->type != CS_MATRIX_SELL) {
+        spmv_cost[v_id*2] = -1;
+        spmv_cost[v_id*2 + 1] = -1;
+        continue;
+      }
+      if (m_sell == NULL)
+        m_sell = cs_matrix_create_sell_by_copy(m);
+      m_v = m_sell;
+    }
+
     /* Measure matrix.vector operations */
 
     for (ed_flag = 0; ed_flag < 2; ed_flag++) {
@@ -186,7 +204,7 @@ _matrix_tune_test(const cs_matrix_t     *m,
       if (vector_multiply != NULL) {
 
         cs_matrix_t m_t;
-        memcpy(&m_t, m, sizeof(cs_matrix_t));
+        memcpy(&m_t, m_v, sizeof(cs_matrix_t));
 
         m_t.vector_multiply[m->fill_type][ed_flag] = vector_multiply;
 
@@ -230,6 +248,8 @@ _matrix_tune_test(const cs_matrix_t     *m,
 
   } /* end of loop on variants */
 
+  cs_matrix_destroy(&m_sell);
+
   BFT_FREE(x);
   BFT_FREE(y);
 }
@@ -277,22 +297,40 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
 
 #endif
 
-  int min_c[2] = {0, 0};
+  /* The best y <= A.x variant determines the matrix type;
+     the y <= (A-D).x variant is then chosen among those of that type */
+
+  int min_c[2] = {0, -1};
 
   for (int i = 1; i < n_variants; i++) {
-    for (int j = 0; j < 2; j++) {
-      if (    spmv_cost[i*2 + j] > 0
-          && (spmv_cost[i*2 + j] < spmv_cost[min_c[j]*2 + j]))
-        min_c[j] = i;
-    }
+    if (    spmv_cost[i*2] > 0
+        && (spmv_cost[i*2] < spmv_cost[min_c[0]*2]))
+      min_c[0] = i;
+  }
+
+  const cs_matrix_type_t s_type = m_variant[min_c[0]].type;
+
+  for (int i = 0; i < n_variants; i++) {
+    if (m_variant[i].type != s_type || spmv_cost[i*2 + 1] <= 0)
+      continue;
+    if (min_c[1] < 0 || spmv_cost[i*2 + 1] < spmv_cost[min_c[1]*2 + 1])
+      min_c[1] = i;
+  }
+
+  if (s_type != m_variant->type) {
+    m_variant->type = s_type;
+    m_variant->vector_multiply[1] = NULL;
+    strcpy(m_variant->name[1], "-");
   }
 
   for (int j = 0; j < 2; j++) {
-    if (spmv_cost[min_c[j]*2 + j] < spmv_cost[j]) {
+    if (min_c[j] > 0) {
       const cs_matrix_variant_t *mv_s = m_variant+min_c[j];
       strcpy(m_variant->name[j], mv_s->name[j]);
       m_variant->vector_multiply[j] = mv_s->vector_multiply[j];
     }
+    else if (min_c[j] < 0)
+      min_c[j] = 0;
   }
 
   if (verbosity > 0) {
@@ -305,6 +343,10 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
                   _(cs_matrix_fill_type_name[m->fill_type]),
                   m_variant[0].name[0], spmv_cost[0]/spmv_cost[min_c[0]*2],
                   m_variant[0].name[1], spmv_cost[1]/spmv_cost[min_c[1]*2+1]);
+    if (s_type != m->type)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  (using matrices of type %s)\n"),
+                    _(cs_matrix_type_name[s_type]));
   }
 }
 
@@ -319,6 +361,9 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
  * \brief Build a matrix variant tuned matrix.vector product operations.
  *
  * The variant may later be applied to matrices of the same type and fill type.
+ * If a variant of another type performs best (see
+ * cs_matrix_variant_build_list), the returned variant's type is set
+ * accordingly, and it should only be applied to matrices of that type.
  *
  * \param[in]  m           associated matrix
  * \param[in]  verbosity   verbosity level
@@ -342,7 +387,7 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
   if (n_variants > 1) {
 
-    if (verbosity > 0)
+    if (verbosity > 0) {
       cs_log_printf(CS_LOG_PERFORMANCE,
                     _("\n"
                       "Tuning for matrices of type %s and fill %s\n"
@@ -350,6 +395,16 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
                     cs_matrix_type_name[m->type],
                     cs_matrix_fill_type_name[m->fill_type]);
 
+      /* Fixed-size block kernels are selected based on block sizes,
+         so log them for block fill types */
+
+      if (m->fill_type >= CS_MATRIX_BLOCK_D)
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("  diagonal block size:       %d\n"
+                        "  extra-diagonal block size: %d\n"),
+                      (int)m->db_size[0], (int)m->eb_size[0]);
+    }
+
     double *spmv_cost;
     BFT_MALLOC(spmv_cost, n_variants*2, double);
 
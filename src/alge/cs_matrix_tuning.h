@@ -62,6 +62,9 @@ BEGIN_C_DECLS
  * \brief Build a matrix variant tuned matrix.vector product operations.
  *
  * The variant may later be applied to matrices of the same type and fill type.
+ * If a variant of another type performs best (see
+ * cs_matrix_variant_build_list), the returned variant's type is set
+ * accordingly, and it should only be applied to matrices of that type.
  *
  * \param[in]  m           associated matrix
  * \param[in]  verbosity   verbosity level
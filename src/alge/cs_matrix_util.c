@@ -610,15 +610,35 @@ _b_diag_dom_msr(const cs_matrix_t  *matrix,
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   const int *db_size = matrix->db_size;
+  const int *eb_size = matrix->eb_size;
   const cs_lnum_t  n_rows = ms->n_rows;
 
   /* diagonal contribution */
 
   _b_diag_dom_diag_contrib(mc->d_val, dd, ms->n_rows, ms->n_cols_ext, db_size);
 
-  /* extra-diagonal contribution */
+  /* extra-diagonal contribution (dense blocks) */
 
-  if (mc->x_val != NULL) {
+  if (mc->x_val != NULL && eb_size[0] > 1) {
+
+#   pragma omp parallel for private(jj, kk, m_row, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      m_row = mc->x_val + ms->row_index[ii]*eb_size[3];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < db_size[0]; kk++) {
+          for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+            dd[ii*db_size[1] + kk]
+              -= fabs(m_row[jj*eb_size[3] + kk*eb_size[2] + ll]);
+        }
+      }
+    }
+
+  }
+
+  /* extra-diagonal contribution (scalar) */
+
+  else if (mc->x_val != NULL) {
 
 #   pragma omp parallel for private(jj, kk, m_row, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1174,10 +1194,16 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   const int  *db_size = matrix->db_size;
+  const int  *eb_size = matrix->eb_size;
   const cs_lnum_t  n_rows = ms->n_rows;
   const cs_lnum_t  dump_id_shift = ms->n_rows*db_size[0]*db_size[0];
 
-  cs_lnum_t  n_entries =   ms->row_index[n_rows]*db_size[0]
+  /* Entries per extradiagonal term (dense blocks or diagonal) */
+
+  const cs_lnum_t  e_size
+    = (eb_size[0] > 1) ? eb_size[0]*eb_size[0] : db_size[0];
+
+  cs_lnum_t  n_entries =   ms->row_index[n_rows]*e_size
                          + ms->n_rows*db_size[0]*db_size[0];
 
   /* Allocate arrays */
@@ -1194,9 +1220,33 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
                            g_coo_num, ms->n_rows, db_size);
 
 
-  /* extra-diagonal contribution */
+  /* extra-diagonal contribution (dense blocks) */
 
-  if (mc->x_val != NULL) {
+  if (eb_size[0] > 1) {
+#   pragma omp parallel for private(jj, kk, dump_id, col_id, m_row, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      col_id = ms->col_id + ms->row_index[ii];
+      m_row = (mc->x_val != NULL) ?
+        mc->x_val + ms->row_index[ii]*eb_size[3] : NULL;
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < eb_size[0]; kk++) {
+          for (cs_lnum_t ll = 0; ll < eb_size[0]; ll++) {
+            dump_id =   (ms->row_index[ii] + jj)*e_size + kk*eb_size[0] + ll
+                      + dump_id_shift;
+            _m_coo[dump_id*2] = g_coo_num[ii]*db_size[0] + kk;
+            _m_coo[dump_id*2+1] = g_coo_num[col_id[jj]]*db_size[0] + ll;
+            _m_val[dump_id] = (m_row != NULL) ?
+              m_row[jj*eb_size[3] + kk*eb_size[2] + ll] : 0.0;
+          }
+        }
+      }
+    }
+  }
+
+  /* extra-diagonal contribution (scalar) */
+
+  else if (mc->x_val != NULL) {
 #   pragma omp parallel for private(jj, kk, dump_id, col_id, m_row, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
       col_id = ms->col_id + ms->row_index[ii];
@@ -1372,6 +1422,8 @@ _prepare_matrix_dump_data(const cs_matrix_t   *m,
     _n_entries = _pre_dump_csr_sym(m, g_coo_num, &_m_coords, &_m_vals);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     if (m->db_size[3] == 1)
       _n_entries = _pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     else
@@ -1867,6 +1919,8 @@ _frobenius_norm(const cs_matrix_t  *m)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     if (   (m->eb_size[0]*m->eb_size[0] == m->eb_size[3])
         && (m->db_size[0]*m->db_size[0] == m->db_size[3])) {
       cs_lnum_t  d_stride = m->db_size[3];
@@ -1929,6 +1983,8 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
     _diag_dom_csr_sym(matrix, dd);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     if (matrix->db_size[3] == 1)
       _diag_dom_msr(matrix, dd);
     else
@@ -59,6 +59,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
+#include "cs_multigrid_direct.h"
 #include "cs_multigrid_smoother.h"
 #include "cs_post.h"
 #include "cs_sles.h"
@@ -160,6 +161,9 @@ typedef struct _cs_multigrid_info_t {
 
   unsigned             n_calls[2];          /* Number of times grids built
                                                (0) or solved (1) */
+  unsigned             n_refresh;           /* Number of builds reusing a
+                                               previous hierarchy, with
+                                               coefficient-only refresh */
 
   unsigned long long   n_levels_tot;        /* Total accumulated number of
                                                grid levels built */
@@ -278,6 +282,19 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  bool       coarse_sp;          /* use single precision extra-diagonal
+                                    coefficients for coarse matrices */
+
+  bool       reuse_hierarchy;    /* keep grid hierarchy between setups,
+                                    refreshing only coarse coefficients */
+  double     reuse_rate_ratio;   /* rebuild hierarchy when the mean
+                                    convergence rate per cycle exceeds
+                                    this multiple of the reference rate */
+
+  bool       coarse_direct;      /* use direct solver on coarsest level */
+  cs_gnum_t  coarse_direct_max;  /* maximum number of coarsest level rows
+                                    for use of direct solver */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -324,6 +341,17 @@ struct _cs_multigrid_t {
   int      merge_stride;
   int      caller_n_ranks;
 
+  /* Coarse grids kept between setups when hierarchy reuse is active */
+
+  unsigned     n_reuse_levels;   /* number of levels in kept hierarchy */
+  cs_grid_t  **reuse_grids;      /* kept grids (level 0 excluded, as
+                                    it is rebuilt from the new matrix) */
+  cs_lnum_t    reuse_f_size[2];  /* fine grid rows and columns associated
+                                    with kept hierarchy */
+  double       reuse_rate_ref;   /* reference convergence rate measured
+                                    after last full build, or < 0 */
+  bool         reuse_rebuild;    /* force full rebuild at next setup */
+
   /* Data available between "setup" and "solve" states */
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
@@ -409,6 +437,7 @@ _multigrid_info_init(cs_multigrid_info_t *info)
 
   for (i = 0; i < 2; i++)
     info->n_calls[i] = 0;
+  info->n_refresh = 0;
 
   info->n_levels_tot = 0;
 
@@ -474,6 +503,22 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_rows_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  if (mg->coarse_sp)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse matrix extra-diagonal terms: single precision\n"));
+
+  if (mg->reuse_hierarchy)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Grid hierarchy reuse:              coefficients only\n"
+                    "    Rebuild convergence rate ratio:  %g\n"),
+                  mg->reuse_rate_ratio);
+
+  if (mg->coarse_direct)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsest level solver:             direct (banded LU)\n"
+                    "    Maximum number of rows:          %llu\n"),
+                  (unsigned long long)(mg->coarse_direct_max));
+
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1)
     cs_log_printf(CS_LOG_SETUP,
@@ -616,6 +661,13 @@ _multigrid_performance_log(const cs_multigrid_t *mg)
                 tmp_s[1], n_cy_mean,
                 (int)(mg->info.n_cycles[0]), (int)(mg->info.n_cycles[1]));
 
+  if (mg->info.n_refresh > 0) {
+    cs_log_strpad(tmp_s[0], _("Coefficient-only refreshes:"), 36, 64);
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %s %12u (of %u builds)\n\n",
+                  tmp_s[0], mg->info.n_refresh, mg->info.n_calls[0]);
+  }
+
   cs_log_timer_array_header(CS_LOG_PERFORMANCE,
                             2,                  /* indent, */
                             "",                 /* header title */
@@ -965,6 +1017,25 @@ _multigrid_add_level(cs_multigrid_t  *mg,
   mgd->n_levels += 1;
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy coarse grids kept for reuse between setups, if present.
+ *
+ * parameters:
+ *   mg <-> multigrid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_free_reuse_grids(cs_multigrid_t  *mg)
+{
+  if (mg->reuse_grids != NULL) {
+    for (int i = mg->n_reuse_levels - 1; i > 0; i--)
+      cs_grid_destroy(mg->reuse_grids + i);
+    BFT_FREE(mg->reuse_grids);
+  }
+
+  mg->n_reuse_levels = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Add postprocessing info to multigrid hierarchy
  *
@@ -1979,28 +2050,61 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     mg_lv_info = mg->lv_info + i;
 
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[i*2]);
-    mg_sles->context
-      = cs_sles_it_create(mg->info.type[2],
-                          mg->info.poly_degree[2],
-                          mg->info.n_max_iter[2],
-                          false); /* stats not updated here */
-    mg_sles->setup_func = cs_sles_it_setup;
-    mg_sles->solve_func = cs_sles_it_solve;
-    mg_sles->destroy_func = cs_sles_it_destroy;
 
-    if (mg->lv_mg[2] != NULL) {
-      cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
-      cs_sles_it_transfer_pc(mg_sles->context, &pc);
+    /* Use direct solver for small enough scalar systems */
+
+    bool direct = false;
+
+    if (mg->coarse_direct && mg->lv_mg[2] == NULL) {
+      const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(m);
+      cs_gnum_t n_g_rows = cs_grid_get_n_g_rows(g);
+#if defined(HAVE_MPI)
+      if (mg->caller_n_ranks > 1) {
+        cs_gnum_t _n_g_rows = n_g_rows;
+        MPI_Allreduce(&_n_g_rows, &n_g_rows, 1, CS_MPI_GNUM, MPI_MAX,
+                      mg->caller_comm);
+      }
+#endif
+      if (db_size[3] == 1 && n_g_rows <= mg->coarse_direct_max)
+        direct = true;
     }
 
+    if (direct) {
+      mg_sles->context = cs_multigrid_direct_create();
+      mg_sles->setup_func = cs_multigrid_direct_setup;
+      mg_sles->solve_func = cs_multigrid_direct_solve;
+      mg_sles->destroy_func = cs_multigrid_direct_destroy;
+
 #if defined(HAVE_MPI)
-    {
-      cs_sles_it_t  *context = mg_sles->context;
-      cs_sles_it_set_mpi_reduce_comm(context,
-                                     cs_grid_get_comm(mgd->grid_hierarchy[i]),
-                                     mg->comm);
+      cs_multigrid_direct_set_comm(mg_sles->context,
+                                   cs_grid_get_comm(mgd->grid_hierarchy[i]));
+#endif
     }
+
+    else {
+      mg_sles->context
+        = cs_sles_it_create(mg->info.type[2],
+                            mg->info.poly_degree[2],
+                            mg->info.n_max_iter[2],
+                            false); /* stats not updated here */
+      mg_sles->setup_func = cs_sles_it_setup;
+      mg_sles->solve_func = cs_sles_it_solve;
+      mg_sles->destroy_func = cs_sles_it_destroy;
+
+      if (mg->lv_mg[2] != NULL) {
+        cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
+        cs_sles_it_transfer_pc(mg_sles->context, &pc);
+      }
+
+#if defined(HAVE_MPI)
+      {
+        cs_sles_it_t  *context = mg_sles->context;
+        cs_sles_it_set_mpi_reduce_comm(context,
+                                       cs_grid_get_comm(mgd->grid_hierarchy[i]),
+                                       mg->comm);
+      }
 #endif
+    }
 
     snprintf(_name, l-1, "%s:coarse:%d", name, i);
     _name[l-1] = '\0';
@@ -2151,6 +2255,9 @@ _setup_hierarchy(void             *context,
 
       _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
+      if (mg->coarse_sp)
+        cs_grid_set_reduced_precision(g, true);
+
       /* Print coarse mesh stats */
 
       if (verbosity > 2) {
@@ -2304,10 +2411,18 @@ _setup_hierarchy(void             *context,
 
   mg->info.n_calls[0] += 1;
 
-  /* Cleanup temporary interpolation arrays */
+  /* Cleanup temporary interpolation arrays, except those required
+     to refresh coarse coefficients if the hierarchy is kept */
 
-  for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
-    cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  if (mg->reuse_hierarchy && mg->subtype == CS_MULTIGRID_MAIN) {
+    cs_grid_free_quantities(mg->setup_data->grid_hierarchy[0]);
+    mg->reuse_rate_ref = -1;
+    mg->reuse_rebuild = false;
+  }
+  else {
+    for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
+      cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  }
 
   /* Setup solvers */
 
@@ -2322,6 +2437,118 @@ _setup_hierarchy(void             *context,
   cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t2);
 }
 
+/*----------------------------------------------------------------------------
+ * Setup multigrid solver using the grid hierarchy kept from a previous
+ * setup, refreshing only the coarse matrix coefficients.
+ *
+ * The aggregation and coarse structures are kept, so only
+ * cs_grid_refresh_coarse_quantities is called for each coarse level.
+ * If the kept hierarchy cannot be refreshed (fine matrix size change,
+ * merged ranks, ...) it is destroyed and false is returned, so that
+ * a full hierarchy may be built instead.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid structure
+ *   name      <-- pointer to name of linear system
+ *   f         <-> associated fine grid
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true if the kept hierarchy was reused, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_refresh_hierarchy(cs_multigrid_t  *mg,
+                   const char      *name,
+                   cs_grid_t       *f,
+                   int              verbosity)
+{
+  if (mg->reuse_grids == NULL)
+    return false;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  int reuse = (mg->reuse_rebuild) ? 0 : 1;
+
+  if (   cs_grid_get_n_rows(f) != mg->reuse_f_size[0]
+      || cs_grid_get_n_cols_ext(f) != mg->reuse_f_size[1])
+    reuse = 0;
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1) {
+    int _reuse = reuse;
+    MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
+
+  /* Refresh coarse coefficients level by level */
+
+  unsigned n_levels = (reuse) ? mg->n_reuse_levels : 0;
+
+  const cs_grid_t *g = f;
+  for (unsigned i = 1; i < n_levels; i++) {
+    if (cs_grid_refresh_coarse_quantities(g,
+                                          mg->reuse_grids[i],
+                                          verbosity) == false) {
+      reuse = 0;
+      break;
+    }
+    g = mg->reuse_grids[i];
+  }
+
+  if (reuse == 0) {
+    if (verbosity > 1)
+      bft_printf(_("   kept grid hierarchy discarded\n"));
+    _multigrid_free_reuse_grids(mg);
+    return false;
+  }
+
+  /* Transfer kept grids to hierarchy */
+
+  mg->setup_data = _multigrid_setup_data_create();
+
+  _multigrid_add_level(mg, f);
+
+  for (unsigned i = 1; i < n_levels; i++) {
+    _multigrid_add_level(mg, mg->reuse_grids[i]);
+    if (mg->coarse_sp)
+      cs_grid_set_reduced_precision(mg->reuse_grids[i], true);
+  }
+
+  cs_grid_free_quantities(f);
+
+  BFT_FREE(mg->reuse_grids);
+  mg->n_reuse_levels = 0;
+
+  if (verbosity > 1)
+    bft_printf(_("   refreshed coefficients of %u kept grid levels\n\n"),
+               n_levels - 1);
+
+  /* Update info */
+
+  mg->info.n_levels_tot += mg->setup_data->n_levels;
+  mg->info.n_levels[0] = mg->setup_data->n_levels;
+
+  if (mg->info.n_levels[0] < mg->info.n_levels[1])
+    mg->info.n_levels[1] = mg->info.n_levels[0];
+  if (mg->info.n_levels[0] > mg->info.n_levels[2])
+    mg->info.n_levels[2] = mg->info.n_levels[0];
+
+  mg->info.n_calls[0] += 1;
+  mg->info.n_refresh += 1;
+
+  /* Setup solvers */
+
+  _multigrid_setup_sles(mg, name, verbosity);
+
+  /* Update timers */
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t1);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup coarse multigrid for k cycle HPC variant.
@@ -2373,6 +2600,61 @@ _setup_k_cycle_hpc_sub(cs_multigrid_t     *mg,
   cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute dot products x[i].y[i] with reproducible accumulation,
+ * summing results over all ranks, if the reproducible BLAS reduction mode
+ * is active and the solver is distributed.
+ *
+ * parameters:
+ *   mg     <-- pointer to solver context info
+ *   n      <-- local number of elements
+ *   n_dots <-- number of dot products
+ *   x      <-- first vectors of each dot product
+ *   y      <-- second vectors of each dot product
+ *   s      --> resulting dot products
+ *
+ * returns:
+ *   true if the dot products were computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static bool
+_dot_products_reproducible(const cs_multigrid_t  *mg,
+                           cs_lnum_t              n,
+                           int                    n_dots,
+                           const cs_real_t       *x[],
+                           const cs_real_t       *y[],
+                           double                 s[])
+{
+#if defined(HAVE_MPI)
+
+  if (   mg->comm != MPI_COMM_NULL
+      && cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+
+    cs_blas_rsum_t acc[3];
+
+    cs_dot_rsum(n, n_dots, x, y, acc);
+    cs_blas_rsum_allreduce(n_dots, acc, mg->comm);
+
+    for (int i = 0; i < n_dots; i++)
+      s[i] = cs_blas_rsum_value(acc + i);
+
+    return true;
+  }
+
+#else
+
+  CS_UNUSED(mg);
+  CS_UNUSED(n);
+  CS_UNUSED(n_dots);
+  CS_UNUSED(x);
+  CS_UNUSED(y);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -2390,7 +2672,14 @@ _dot_xx(const cs_multigrid_t  *mg,
         cs_lnum_t              n,
         const cs_real_t       *x)
 {
-  double s = cs_dot_xx(n, x);
+  const cs_real_t *_x[1] = {x};
+
+  double s;
+
+  if (_dot_products_reproducible(mg, n, 1, _x, _x, &s))
+    return s;
+
+  s = cs_dot_xx(n, x);
 
 #if defined(HAVE_MPI)
 
@@ -2425,8 +2714,16 @@ _dot_xx_yy(const cs_multigrid_t  *mg,
            double                *s1,
            double                *s2)
 {
+  const cs_real_t *_x[2] = {x, y};
+
   double s[2];
 
+  if (_dot_products_reproducible(mg, n, 2, _x, _x, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   s[0] = cs_dot_xx(n, x);
   s[1] = cs_dot_xx(n, y);
 
@@ -2467,8 +2764,16 @@ _dot_xy_yz(const cs_multigrid_t  *mg,
            double                *s1,
            double                *s2)
 {
+  const cs_real_t *_x[2] = {x, y}, *_y[2] = {y, z};
+
   double s[2];
 
+  if (_dot_products_reproducible(mg, n, 2, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   cs_dot_xy_yz(n, x, y, z, s, s+1);
 
 #if defined(HAVE_MPI)
@@ -2511,8 +2816,17 @@ _dot_xu_xv_xw(const cs_multigrid_t  *mg,
               double                *s2,
               double                *s3)
 {
+  const cs_real_t *_x[3] = {x, x, x}, *_y[3] = {u, v, w};
+
   double s[3];
 
+  if (_dot_products_reproducible(mg, n, 3, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    *s3 = s[2];
+    return;
+  }
+
   /* Use two separate call as cs_blas.c does not yet hav matching call */
   cs_dot_xy_yz(n, u, x, v, s, s+1);
   s[2] = cs_dot(n, x, w);
@@ -3812,6 +4126,21 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->coarse_sp = false;
+
+  mg->reuse_hierarchy = false;
+  mg->reuse_rate_ratio = 1.5;
+
+  mg->coarse_direct = false;
+  mg->coarse_direct_max = 4096;
+
+  mg->n_reuse_levels = 0;
+  mg->reuse_grids = NULL;
+  mg->reuse_f_size[0] = 0;
+  mg->reuse_f_size[1] = 0;
+  mg->reuse_rate_ref = -1;
+  mg->reuse_rebuild = false;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = NULL;
@@ -3899,6 +4228,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_free_reuse_grids(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != NULL) {
@@ -4101,6 +4432,8 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
     case CS_SLES_JACOBI:
     case CS_SLES_P_GAUSS_SEIDEL:
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
+    case CS_SLES_MC_GAUSS_SEIDEL:
+    case CS_SLES_MC_SYM_GAUSS_SEIDEL:
       info->poly_degree[i] = -1;
       break;
     default:
@@ -4220,8 +4553,11 @@ cs_multigrid_setup_conv_diff(void               *context,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 
-  _setup_hierarchy(mg, name, mesh, f, verbosity); /* Assign to and build
-                                                     hierarchy */
+  /* Reuse kept hierarchy if possible, build it otherwise */
+
+  if (_refresh_hierarchy(mg, name, f, verbosity) == false)
+    _setup_hierarchy(mg, name, mesh, f, verbosity); /* Assign to and build
+                                                       hierarchy */
 
   /* Update timers */
 
@@ -4322,6 +4658,7 @@ cs_multigrid_solve(void                *context,
      with the legacy (by increment) case */
 
   double initial_residue = -1;
+  double cycle_1_residue = -1; /* for convergence rate monitoring */
 
   *residue = initial_residue; /* not known yet, so be safe */
 
@@ -4344,6 +4681,8 @@ cs_multigrid_solve(void                *context,
                                vx,
                                _aux_size - lv_names_size,
                                _aux_buf + lv_names_size);
+      if (cycle_id == 1)
+        cycle_1_residue = *residue;
     }
   }
   else if (   mg->type >= CS_MULTIGRID_K_CYCLE
@@ -4367,6 +4706,8 @@ cs_multigrid_solve(void                *context,
                                vx,
                                _aux_size - lv_names_size,
                                _aux_buf + lv_names_size);
+      if (cycle_id == 1)
+        cycle_1_residue = *residue;
     }
   }
 
@@ -4380,6 +4721,29 @@ cs_multigrid_solve(void                *context,
 
   t1 = cs_timer_time();
 
+  /* Monitor convergence rate if the hierarchy is kept between setups:
+     the first solve after a full build provides the reference rate,
+     and a degraded rate triggers a full rebuild at the next setup
+     (the first cycle is excluded, as initial residue is not always known) */
+
+  if (   mg->reuse_hierarchy && mg->subtype == CS_MULTIGRID_MAIN
+      && n_cycles > 1 && cycle_1_residue > 0 && *residue >= 0) {
+
+    double rate = pow(*residue / cycle_1_residue, 1./(n_cycles - 1));
+
+    if (mg->reuse_rate_ref < 0)
+      mg->reuse_rate_ref = CS_MAX(rate, 1e-2); /* avoid 0 reference */
+
+    else if (rate > mg->reuse_rate_ref * mg->reuse_rate_ratio) {
+      mg->reuse_rebuild = true;
+      if (verbosity > 1)
+        bft_printf(_("  convergence rate %g > %g x %g: "
+                     "grid hierarchy will be rebuilt\n"),
+                   rate, mg->reuse_rate_ratio, mg->reuse_rate_ref);
+    }
+
+  }
+
   /* Update stats on number of iterations (last, min, max, total) */
 
   mg_info->n_cycles[2] += n_cycles;
@@ -4454,11 +4818,23 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
-
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
-    BFT_FREE(mgd->grid_hierarchy);
+    /* Destroy grid hierarchy, or keep coarse grids for reuse */
+
+    if (   mg->reuse_hierarchy && mg->subtype == CS_MULTIGRID_MAIN
+        && mg->reuse_rebuild == false && mgd->n_levels > 1) {
+      _multigrid_free_reuse_grids(mg);
+      mg->reuse_f_size[0] = cs_grid_get_n_rows(mgd->grid_hierarchy[0]);
+      mg->reuse_f_size[1] = cs_grid_get_n_cols_ext(mgd->grid_hierarchy[0]);
+      cs_grid_destroy(mgd->grid_hierarchy);
+      mg->n_reuse_levels = mgd->n_levels;
+      mg->reuse_grids = mgd->grid_hierarchy;
+      mgd->grid_hierarchy = NULL;
+    }
+    else {
+      for (int i = mgd->n_levels - 1; i > -1; i--)
+        cs_grid_destroy(mgd->grid_hierarchy + i);
+      BFT_FREE(mgd->grid_hierarchy);
+    }
 
     /* Destroy peconditioning-only arrays */
 
@@ -4829,6 +5205,108 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarse matrix precision options.
+ *
+ * When single precision is activated, coarse level matrices (i.e. all
+ * levels except the finest) also store their extra-diagonal coefficients
+ * in single precision, which are then used for matrix.vector products
+ * on those levels, reducing the associated memory bandwidth.
+ *
+ * Diagonal coefficients, vectors and reductions remain in double
+ * precision, as do the Krylov solvers using this multigrid as a
+ * preconditioner. Gauss-Seidel type smoothers and coarsening use the
+ * double precision coefficients.
+ *
+ * \param[in, out]  mg                pointer to multigrid info and context
+ * \param[in]       single_precision  use single precision coarse matrix
+ *                                    extra-diagonal coefficients if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_precision(cs_multigrid_t  *mg,
+                                  bool             single_precision)
+{
+  if (mg == NULL)
+    return;
+
+  mg->coarse_sp = single_precision;
+
+  if (mg->lv_mg[2] != NULL)
+    cs_multigrid_set_coarse_precision(mg->lv_mg[2], single_precision);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid grid hierarchy reuse options.
+ *
+ * When reuse is activated, the aggregation and coarse grid structures
+ * are kept from one setup to the next (i.e. across time steps), and only
+ * the coarse matrix coefficients are recomputed from the new fine matrix.
+ * This assumes the matrix structure does not change.
+ *
+ * The mean convergence rate per cycle measured on the first solve
+ * following a full build is used as a reference; when a later solve's
+ * rate exceeds this reference multiplied by rate_ratio, the hierarchy
+ * is fully rebuilt at the next setup.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       reuse       keep grid hierarchy between setups if true
+ * \param[in]       rate_ratio  allowed convergence rate degradation ratio
+ *                              before rebuild (> 1, default: 1.5)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_hierarchy_reuse(cs_multigrid_t  *mg,
+                                 bool             reuse,
+                                 double           rate_ratio)
+{
+  if (mg == NULL)
+    return;
+
+  mg->reuse_hierarchy = reuse;
+  if (rate_ratio > 1.)
+    mg->reuse_rate_ratio = rate_ratio;
+
+  if (reuse == false)
+    _multigrid_free_reuse_grids(mg);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsest level direct solver options.
+ *
+ * When activated, and if the coarsest level system is scalar and has
+ * no more than n_g_rows_max rows, it is gathered on the ranks of its
+ * communicator and factorized once per setup (banded LU factorization
+ * after reverse Cuthill-McKee renumbering), so that each coarse solve
+ * is replaced by a forward and back substitution. This avoids the many
+ * latency-bound global reductions of an iterative coarse solver.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       direct        use direct coarsest level solver if true
+ * \param[in]       n_g_rows_max  maximum global number of coarsest level
+ *                                rows for which the direct solver is used
+ *                                (default: 4096)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_solver_direct(cs_multigrid_t  *mg,
+                                      bool             direct,
+                                      cs_gnum_t        n_g_rows_max)
+{
+  if (mg == NULL)
+    return;
+
+  mg->coarse_direct = direct;
+  if (n_g_rows_max > 0)
+    mg->coarse_direct_max = n_g_rows_max;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -446,6 +446,76 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
                                int              rows_mean_threshold,
                                cs_gnum_t        rows_glob_threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarse matrix precision options.
+ *
+ * When single precision is activated, coarse level matrices (i.e. all
+ * levels except the finest) also store their extra-diagonal coefficients
+ * in single precision, which are then used for matrix.vector products
+ * on those levels. Diagonal coefficients, vectors and reductions remain
+ * in double precision.
+ *
+ * \param[in, out]  mg                pointer to multigrid info and context
+ * \param[in]       single_precision  use single precision coarse matrix
+ *                                    extra-diagonal coefficients if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_precision(cs_multigrid_t  *mg,
+                                  bool             single_precision);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid grid hierarchy reuse options.
+ *
+ * When reuse is activated, the aggregation and coarse grid structures
+ * are kept from one setup to the next (i.e. across time steps), and only
+ * the coarse matrix coefficients are recomputed from the new fine matrix.
+ * This assumes the matrix structure does not change.
+ *
+ * The mean convergence rate per cycle measured on the first solve
+ * following a full build is used as a reference; when a later solve's
+ * rate exceeds this reference multiplied by rate_ratio, the hierarchy
+ * is fully rebuilt at the next setup.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       reuse       keep grid hierarchy between setups if true
+ * \param[in]       rate_ratio  allowed convergence rate degradation ratio
+ *                              before rebuild (> 1, default: 1.5)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_hierarchy_reuse(cs_multigrid_t  *mg,
+                                 bool             reuse,
+                                 double           rate_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsest level direct solver options.
+ *
+ * When activated, and if the coarsest level system is scalar and has
+ * no more than n_g_rows_max rows, it is gathered on the ranks of its
+ * communicator and factorized once per setup (banded LU factorization
+ * after reverse Cuthill-McKee renumbering), so that each coarse solve
+ * is replaced by a forward and back substitution. This avoids the many
+ * latency-bound global reductions of an iterative coarse solver.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       direct        use direct coarsest level solver if true
+ * \param[in]       n_g_rows_max  maximum global number of coarsest level
+ *                                rows for which the direct solver is used
+ *                                (default: 4096)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_solver_direct(cs_multigrid_t  *mg,
+                                      bool             direct,
+                                      cs_gnum_t        n_g_rows_max);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
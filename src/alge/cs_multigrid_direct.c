@@ -0,0 +1,876 @@
+/*============================================================================
+ * Sparse Linear Equation Solvers: Multigrid coarsest level direct solver
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_halo.h"
+#include "cs_matrix.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_multigrid_direct.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_multigrid_direct.c
+        Direct solver for the coarsest level of a multigrid hierarchy.
+
+  The coarsest level matrix (usually already merged on a few ranks) is
+  gathered on each rank of its communicator, renumbered with a reverse
+  Cuthill-McKee ordering, and factorized once per setup using a banded LU
+  factorization without pivoting (coarse matrices obtained by aggregation
+  are diagonally dominant). Each solve then only requires gathering the
+  right-hand side and a forward and back substitution, replacing the
+  iterations and associated global reductions of an iterative solver.
+
+  Null pivots, which appear for singular but consistent systems (such as
+  pressure with only Neumann boundary conditions), are handled by setting
+  the matching solution component to zero.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Relative threshold under which a pivot is considered null */
+
+#define CS_MG_DIRECT_NULL_PIVOT  1.e-10
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+struct _cs_multigrid_direct_t {
+
+  cs_lnum_t    n_rows;         /* Number of local rows */
+  cs_lnum_t    row_shift;      /* Shift of local rows in gathered system */
+  cs_lnum_t    n_g_rows;       /* Number of rows in gathered system */
+  cs_lnum_t    bandwidth;      /* Half bandwidth of renumbered system */
+
+  cs_lnum_t   *band_id;        /* Renumbered id of each gathered row */
+  cs_real_t   *band;           /* LU factors in band storage
+                                  (size: n_g_rows*(2*bandwidth + 1)) */
+  char        *null_pivot;     /* Null pivot flag for each renumbered row */
+  cs_real_t   *x;              /* Work array (size: n_g_rows*2) */
+
+#if defined(HAVE_MPI)
+  MPI_Comm     comm;           /* Associated communicator */
+  int          n_ranks;        /* Number of ranks in communicator */
+  int         *row_count;      /* Number of rows per rank */
+  int         *row_displ;      /* Shift of rows for each rank */
+#endif
+
+};
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Free factorization-related data.
+ *
+ * parameters:
+ *   c <-> pointer to direct solver context
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_factorization(cs_multigrid_direct_t  *c)
+{
+  BFT_FREE(c->band_id);
+  BFT_FREE(c->band);
+  BFT_FREE(c->null_pivot);
+  BFT_FREE(c->x);
+
+#if defined(HAVE_MPI)
+  BFT_FREE(c->row_count);
+  BFT_FREE(c->row_displ);
+#endif
+
+  c->n_rows = 0;
+  c->row_shift = 0;
+  c->n_g_rows = 0;
+  c->bandwidth = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Extract local matrix entries, using gathered system column numbering.
+ *
+ * Entries of a given row are contiguous, but not necessarily sorted
+ * (duplicates are allowed, and summed when building the band matrix).
+ *
+ * parameters:
+ *   a        <-- matrix (native, CSR, MSR or SELL)
+ *   g_col_id <-- gathered system id of local and ghost columns
+ *   row_size --> number of entries for each row
+ *   col      --> gathered system column id of each entry
+ *   val      --> value of each entry
+ *
+ * returns:
+ *   number of local entries
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_local_entries(const cs_matrix_t   *a,
+               const cs_real_t      g_col_id[],
+               int                **row_size,
+               int                **col,
+               cs_real_t          **val)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_matrix_type_t m_type = cs_matrix_get_type(a);
+
+  cs_lnum_t n_ent = 0;
+  int *_row_size, *_col;
+  cs_real_t *_val;
+
+  BFT_MALLOC(_row_size, n_rows, int);
+
+  if (m_type == CS_MATRIX_NATIVE) {
+
+    bool symmetric;
+    cs_lnum_t n_edges;
+    const cs_lnum_2_t *edges;
+    const cs_real_t *d_val, *x_val;
+
+    cs_matrix_get_native_arrays(a, &symmetric, &n_edges, &edges,
+                                &d_val, &x_val);
+
+    const int x_stride = (symmetric) ? 1 : 2;
+
+    cs_lnum_t *row_idx;
+    BFT_MALLOC(row_idx, n_rows + 1, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      _row_size[i] = 1;
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      for (int k = 0; k < 2; k++) {
+        if (edges[e][k] < n_rows)
+          _row_size[edges[e][k]] += 1;
+      }
+    }
+
+    row_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      row_idx[i+1] = row_idx[i] + _row_size[i];
+    n_ent = row_idx[n_rows];
+
+    BFT_MALLOC(_col, n_ent, int);
+    BFT_MALLOC(_val, n_ent, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      _col[row_idx[i]] = (int)(g_col_id[i]);
+      _val[row_idx[i]] = (d_val != NULL) ? d_val[i] : 0.;
+      row_idx[i] += 1;
+    }
+
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      for (int k = 0; k < 2; k++) {
+        cs_lnum_t i = edges[e][k], j = edges[e][(k+1)%2];
+        if (i < n_rows) {
+          _col[row_idx[i]] = (int)(g_col_id[j]);
+          _val[row_idx[i]] = (x_val != NULL) ? x_val[e*x_stride + k%x_stride]
+                                             : 0.;
+          row_idx[i] += 1;
+        }
+      }
+    }
+
+    BFT_FREE(row_idx);
+
+  }
+
+  else if (m_type == CS_MATRIX_CSR) {
+
+    const cs_lnum_t *row_index, *col_id;
+    const cs_real_t *m_val;
+
+    cs_matrix_get_csr_arrays(a, &row_index, &col_id, &m_val);
+
+    n_ent = row_index[n_rows];
+
+    BFT_MALLOC(_col, n_ent, int);
+    BFT_MALLOC(_val, n_ent, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      _row_size[i] = row_index[i+1] - row_index[i];
+    for (cs_lnum_t j = 0; j < n_ent; j++) {
+      _col[j] = (int)(g_col_id[col_id[j]]);
+      _val[j] = m_val[j];
+    }
+
+  }
+
+  else {
+
+    const cs_lnum_t *row_index, *col_id;
+    const cs_real_t *d_val, *x_val;
+
+    cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+
+    n_ent = n_rows + row_index[n_rows];
+
+    BFT_MALLOC(_col, n_ent, int);
+    BFT_MALLOC(_val, n_ent, cs_real_t);
+
+    cs_lnum_t k = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      _row_size[i] = row_index[i+1] - row_index[i] + 1;
+      _col[k] = (int)(g_col_id[i]);
+      _val[k++] = (d_val != NULL) ? d_val[i] : 0.;
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        _col[k] = (int)(g_col_id[col_id[j]]);
+        _val[k++] = (x_val != NULL) ? x_val[j] : 0.;
+      }
+    }
+
+  }
+
+  *row_size = _row_size;
+  *col = _col;
+  *val = _val;
+
+  return n_ent;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute reverse Cuthill-McKee renumbering of a graph.
+ *
+ * Each connected component is traversed breadth-first starting from its
+ * unvisited vertex of lowest degree, neighbors being visited by
+ * increasing degree.
+ *
+ * parameters:
+ *   n      <-- number of vertices
+ *   idx    <-- adjacency index (size: n+1)
+ *   adj    <-- adjacency (size: idx[n])
+ *   new_id --> new id for each vertex (size: n)
+ *----------------------------------------------------------------------------*/
+
+static void
+_rcm_renumber(cs_lnum_t        n,
+              const cs_lnum_t  idx[],
+              const cs_lnum_t  adj[],
+              cs_lnum_t        new_id[])
+{
+  cs_lnum_t *order, *degree;
+  char *visited;
+
+  BFT_MALLOC(order, n, cs_lnum_t);
+  BFT_MALLOC(degree, n, cs_lnum_t);
+  BFT_MALLOC(visited, n, char);
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    degree[i] = idx[i+1] - idx[i];
+    visited[i] = 0;
+  }
+
+  cs_lnum_t n_ordered = 0;
+
+  while (n_ordered < n) {
+
+    /* Start from unvisited vertex of minimum degree */
+
+    cs_lnum_t s = -1;
+    for (cs_lnum_t i = 0; i < n; i++) {
+      if (visited[i] == 0 && (s < 0 || degree[i] < degree[s]))
+        s = i;
+    }
+
+    visited[s] = 1;
+    cs_lnum_t head = n_ordered;
+    order[n_ordered++] = s;
+
+    while (head < n_ordered) {
+
+      cs_lnum_t v = order[head++];
+      cs_lnum_t q_s = n_ordered;
+
+      for (cs_lnum_t j = idx[v]; j < idx[v+1]; j++) {
+        cs_lnum_t k = adj[j];
+        if (visited[k] == 0) {
+          visited[k] = 1;
+          order[n_ordered++] = k;
+        }
+      }
+
+      /* Sort newly added vertices by increasing degree (insertion sort,
+         as vertex degrees are small) */
+
+      for (cs_lnum_t j = q_s + 1; j < n_ordered; j++) {
+        cs_lnum_t k = order[j];
+        cs_lnum_t l = j - 1;
+        while (l >= q_s && degree[order[l]] > degree[k]) {
+          order[l+1] = order[l];
+          l--;
+        }
+        order[l+1] = k;
+      }
+
+    }
+
+  }
+
+  for (cs_lnum_t i = 0; i < n; i++)
+    new_id[order[i]] = n - 1 - i;
+
+  BFT_FREE(visited);
+  BFT_FREE(degree);
+  BFT_FREE(order);
+}
+
+/*----------------------------------------------------------------------------
+ * Factorize band matrix in place (LU without pivoting).
+ *
+ * Row i of the matrix is stored in band[i*(2b+1) + b + (j-i)], for
+ * columns j in [i-b, i+b].
+ *
+ * parameters:
+ *   n          <-- number of rows
+ *   b          <-- half bandwidth
+ *   band       <-> band matrix, replaced by its LU factors
+ *   null_pivot --> null pivot flag for each row
+ *
+ * returns:
+ *   number of null pivots encountered
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_band_lu_factor(cs_lnum_t   n,
+                cs_lnum_t   b,
+                cs_real_t   band[],
+                char        null_pivot[])
+{
+  const cs_lnum_t w = 2*b + 1;
+
+  cs_lnum_t n_null = 0;
+
+  /* Reference values for null pivot detection */
+
+  cs_real_t *d_ref;
+  BFT_MALLOC(d_ref, n, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    d_ref[i] = 0;
+    for (cs_lnum_t j = 0; j < w; j++)
+      d_ref[i] = CS_MAX(d_ref[i], fabs(band[i*w + j]));
+    null_pivot[i] = 0;
+  }
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_real_t *restrict r_k = band + k*w + b;
+    cs_lnum_t i_max = CS_MIN(k + b, n - 1);
+
+    if (fabs(r_k[0]) <= CS_MG_DIRECT_NULL_PIVOT*d_ref[k]) {
+
+      /* Singular (consistent) system: drop this equation and
+         fix the matching unknown to 0 */
+
+      null_pivot[k] = 1;
+      n_null += 1;
+      r_k[0] = 1.;
+      for (cs_lnum_t i = k + 1; i <= i_max; i++)
+        band[i*w + b + (k-i)] = 0.;
+
+      continue;
+
+    }
+
+    const cs_real_t inv_p = 1. / r_k[0];
+
+    for (cs_lnum_t i = k + 1; i <= i_max; i++) {
+      cs_real_t *restrict r_i = band + i*w + b;
+      cs_real_t l = r_i[k-i] * inv_p;
+      r_i[k-i] = l;
+      for (cs_lnum_t j = k + 1; j <= i_max; j++)
+        r_i[j-i] -= l*r_k[j-k];
+    }
+
+  }
+
+  BFT_FREE(d_ref);
+
+  return n_null;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve system using band LU factors (in place).
+ *
+ * parameters:
+ *   n          <-- number of rows
+ *   b          <-- half bandwidth
+ *   band       <-- LU factors in band storage
+ *   null_pivot <-- null pivot flag for each row
+ *   x          <-> right-hand side in, solution out
+ *----------------------------------------------------------------------------*/
+
+static void
+_band_lu_solve(cs_lnum_t        n,
+               cs_lnum_t        b,
+               const cs_real_t  band[],
+               const char       null_pivot[],
+               cs_real_t        x[])
+{
+  const cs_lnum_t w = 2*b + 1;
+
+  /* Forward substitution (unit lower triangular) */
+
+  for (cs_lnum_t i = 1; i < n; i++) {
+    const cs_real_t *restrict r_i = band + i*w + b;
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = CS_MAX(0, i - b); j < i; j++)
+      s -= r_i[j-i]*x[j];
+    x[i] = s;
+  }
+
+  /* Back substitution */
+
+  for (cs_lnum_t i = n - 1; i > -1; i--) {
+    if (null_pivot[i]) {
+      x[i] = 0.;
+      continue;
+    }
+    const cs_real_t *restrict r_i = band + i*w + b;
+    const cs_lnum_t j_max = CS_MIN(i + b, n - 1);
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = i + 1; j <= j_max; j++)
+      s -= r_i[j-i]*x[j];
+    x[i] = s / r_i[0];
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create direct solver context for a multigrid coarsest level.
+ *
+ * returns:
+ *   pointer to newly created direct solver context
+ *----------------------------------------------------------------------------*/
+
+cs_multigrid_direct_t *
+cs_multigrid_direct_create(void)
+{
+  cs_multigrid_direct_t *c;
+
+  BFT_MALLOC(c, 1, cs_multigrid_direct_t);
+
+  c->band_id = NULL;
+  c->band = NULL;
+  c->null_pivot = NULL;
+  c->x = NULL;
+
+#if defined(HAVE_MPI)
+  c->comm = MPI_COMM_NULL;
+  c->n_ranks = 1;
+  c->row_count = NULL;
+  c->row_displ = NULL;
+#endif
+
+  _free_factorization(c);
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy direct solver context for a multigrid coarsest level.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context
+ *               (actual type: cs_multigrid_direct_t  **)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_destroy(void  **context)
+{
+  cs_multigrid_direct_t *c = (cs_multigrid_direct_t *)(*context);
+
+  if (c != NULL) {
+    _free_factorization(c);
+    BFT_FREE(c);
+    *context = c;
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Set MPI communicator over which the coarse system is distributed.
+ *
+ * Ranks not belonging to this communicator (i.e. for which comm is
+ * MPI_COMM_NULL) are expected to have no local rows.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context
+ *   comm    <-- MPI communicator for coarse system (MPI_COMM_NULL if local)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_set_comm(cs_multigrid_direct_t  *context,
+                             MPI_Comm                comm)
+{
+  context->comm = comm;
+
+  context->n_ranks = 1;
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_size(comm, &(context->n_ranks));
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Setup (factorize) direct solver for a multigrid coarsest level.
+ *
+ * The distributed matrix is gathered on all ranks of the associated
+ * communicator, renumbered using a reverse Cuthill-McKee ordering, and
+ * factorized in banded form, so that each subsequent solve only requires
+ * gathering the right-hand side and a forward and back substitution.
+ *
+ * parameters:
+ *   context   <-> pointer to direct solver context
+ *                 (actual type: cs_multigrid_direct_t  *)
+ *   name      <-- pointer to system name
+ *   a         <-- associated matrix
+ *   verbosity <-- verbosity level
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_setup(void               *context,
+                          const char         *name,
+                          const cs_matrix_t  *a,
+                          int                 verbosity)
+{
+  cs_multigrid_direct_t *c = context;
+
+  _free_factorization(c);
+
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+
+  if (db_size[3] != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: only scalar matrices are handled (system \"%s\")."),
+              __func__, name);
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+
+  c->n_rows = n_rows;
+  c->n_g_rows = n_rows;
+
+#if defined(HAVE_MPI)
+  if (c->comm == MPI_COMM_NULL) {
+    assert(n_rows == 0 || c->n_ranks == 1);
+    if (n_rows == 0)
+      return;
+  }
+  else if (c->n_ranks > 1) {
+    int rank_id;
+    MPI_Comm_rank(c->comm, &rank_id);
+    BFT_MALLOC(c->row_count, c->n_ranks, int);
+    BFT_MALLOC(c->row_displ, c->n_ranks, int);
+    int _n_rows = n_rows;
+    MPI_Allgather(&_n_rows, 1, MPI_INT, c->row_count, 1, MPI_INT, c->comm);
+    c->row_displ[0] = 0;
+    for (int i = 1; i < c->n_ranks; i++)
+      c->row_displ[i] = c->row_displ[i-1] + c->row_count[i-1];
+    c->row_shift = c->row_displ[rank_id];
+    c->n_g_rows =   c->row_displ[c->n_ranks-1]
+                  + c->row_count[c->n_ranks-1];
+  }
+#endif
+
+  const cs_lnum_t n_g_rows = c->n_g_rows;
+
+  /* Gathered system ids of local and ghost columns */
+
+  cs_real_t *g_col_id;
+  BFT_MALLOC(g_col_id, n_cols_ext, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    g_col_id[i] = c->row_shift + i;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  if (halo != NULL)
+    cs_halo_sync_var(halo, CS_HALO_STANDARD, g_col_id);
+
+  /* Local entries in gathered numbering */
+
+  int *l_row_size, *l_col;
+  cs_real_t *l_val;
+
+  const cs_lnum_t n_l_ent = _local_entries(a, g_col_id,
+                                           &l_row_size, &l_col, &l_val);
+
+  BFT_FREE(g_col_id);
+
+  /* Gather system on all ranks (CSR form) */
+
+  cs_lnum_t *g_idx, *g_col;
+  cs_real_t *g_val;
+  BFT_MALLOC(g_idx, n_g_rows + 1, cs_lnum_t);
+
+  int *g_row_size = l_row_size;
+  cs_lnum_t n_g_ent = n_l_ent;
+
+#if defined(HAVE_MPI)
+  if (c->n_ranks > 1) {
+
+    int *ent_count, *ent_displ;
+    BFT_MALLOC(ent_count, c->n_ranks, int);
+    BFT_MALLOC(ent_displ, c->n_ranks, int);
+
+    int _n_l_ent = n_l_ent;
+    MPI_Allgather(&_n_l_ent, 1, MPI_INT, ent_count, 1, MPI_INT, c->comm);
+    ent_displ[0] = 0;
+    for (int i = 1; i < c->n_ranks; i++)
+      ent_displ[i] = ent_displ[i-1] + ent_count[i-1];
+    n_g_ent = ent_displ[c->n_ranks-1] + ent_count[c->n_ranks-1];
+
+    BFT_MALLOC(g_row_size, n_g_rows, int);
+    MPI_Allgatherv(l_row_size, n_rows, MPI_INT,
+                   g_row_size, c->row_count, c->row_displ, MPI_INT,
+                   c->comm);
+
+    int *_g_col;
+    BFT_MALLOC(_g_col, n_g_ent, int);
+    BFT_MALLOC(g_val, n_g_ent, cs_real_t);
+    MPI_Allgatherv(l_col, n_l_ent, MPI_INT,
+                   _g_col, ent_count, ent_displ, MPI_INT,
+                   c->comm);
+    MPI_Allgatherv(l_val, n_l_ent, CS_MPI_REAL,
+                   g_val, ent_count, ent_displ, CS_MPI_REAL,
+                   c->comm);
+
+    BFT_FREE(l_col);
+    BFT_FREE(l_val);
+    l_col = _g_col;
+    l_val = g_val;
+
+    BFT_FREE(ent_displ);
+    BFT_FREE(ent_count);
+  }
+#endif
+
+  g_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_g_rows; i++)
+    g_idx[i+1] = g_idx[i] + g_row_size[i];
+
+  assert(g_idx[n_g_rows] == n_g_ent);
+
+  if (g_row_size != l_row_size)
+    BFT_FREE(g_row_size);
+  BFT_FREE(l_row_size);
+
+  BFT_MALLOC(g_col, n_g_ent, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_g_ent; i++)
+    g_col[i] = l_col[i];
+  BFT_FREE(l_col);
+  g_val = l_val;
+
+  /* Renumber to reduce bandwidth, then build band matrix */
+
+  BFT_MALLOC(c->band_id, n_g_rows, cs_lnum_t);
+
+  _rcm_renumber(n_g_rows, g_idx, g_col, c->band_id);
+
+  cs_lnum_t b = 0;
+  for (cs_lnum_t i = 0; i < n_g_rows; i++) {
+    for (cs_lnum_t j = g_idx[i]; j < g_idx[i+1]; j++) {
+      cs_lnum_t d = c->band_id[g_col[j]] - c->band_id[i];
+      b = CS_MAX(b, CS_ABS(d));
+    }
+  }
+  c->bandwidth = b;
+
+  const cs_lnum_t w = 2*b + 1;
+
+  BFT_MALLOC(c->band, (size_t)n_g_rows*w, cs_real_t);
+
+  for (size_t i = 0; i < (size_t)n_g_rows*w; i++)
+    c->band[i] = 0.;
+
+  for (cs_lnum_t i = 0; i < n_g_rows; i++) {
+    cs_lnum_t b_i = c->band_id[i];
+    for (cs_lnum_t j = g_idx[i]; j < g_idx[i+1]; j++) {
+      cs_lnum_t b_j = c->band_id[g_col[j]];
+      c->band[b_i*w + b + (b_j - b_i)] += g_val[j];
+    }
+  }
+
+  BFT_FREE(g_val);
+  BFT_FREE(g_col);
+  BFT_FREE(g_idx);
+
+  /* Factorize */
+
+  BFT_MALLOC(c->null_pivot, n_g_rows, char);
+  BFT_MALLOC(c->x, n_g_rows*2, cs_real_t);
+
+  cs_lnum_t n_null = _band_lu_factor(n_g_rows, b, c->band, c->null_pivot);
+
+  if (verbosity > 0)
+    bft_printf(_("  %s: direct solver factorization\n"
+                 "    rows: %d; half bandwidth: %d; null pivots: %d\n"),
+               name, (int)n_g_rows, (int)b, (int)n_null);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve coarsest level system using direct solver.
+ *
+ * parameters:
+ *   context       <-> pointer to direct solver context
+ *                     (actual type: cs_multigrid_direct_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision (unused)
+ *   r_norm        <-- residue normalization (unused)
+ *   n_iter        --> number of iterations (1)
+ *   residue       --> residue (0, as not computed)
+ *   rhs           <-- right hand side
+ *   vx            <-> system solution
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area (unused)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_multigrid_direct_solve(void                *context,
+                          const char          *name,
+                          const cs_matrix_t   *a,
+                          int                  verbosity,
+                          cs_halo_rotation_t   rotation_mode,
+                          double               precision,
+                          double               r_norm,
+                          int                 *n_iter,
+                          double              *residue,
+                          const cs_real_t     *rhs,
+                          cs_real_t           *vx,
+                          size_t               aux_size,
+                          void                *aux_vectors)
+{
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(precision);
+  CS_UNUSED(r_norm);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  cs_multigrid_direct_t *c = context;
+
+  if (c->band == NULL && c->n_rows > 0)
+    cs_multigrid_direct_setup(c, name, a, verbosity);
+
+  *n_iter = 1;
+  *residue = 0.;
+
+  const cs_lnum_t n_g_rows = c->n_g_rows;
+
+  if (n_g_rows == 0)
+    return CS_SLES_CONVERGED;
+
+  cs_real_t *restrict x_g = c->x;
+  cs_real_t *restrict x_b = c->x + n_g_rows;
+
+  /* Gather right-hand side */
+
+#if defined(HAVE_MPI)
+  if (c->n_ranks > 1)
+    MPI_Allgatherv(rhs, c->n_rows, CS_MPI_REAL,
+                   x_g, c->row_count, c->row_displ, CS_MPI_REAL,
+                   c->comm);
+  else
+#endif
+  {
+    for (cs_lnum_t i = 0; i < n_g_rows; i++)
+      x_g[i] = rhs[i];
+  }
+
+  for (cs_lnum_t i = 0; i < n_g_rows; i++)
+    x_b[c->band_id[i]] = x_g[i];
+
+  /* Forward and back substitution */
+
+  _band_lu_solve(n_g_rows, c->bandwidth, c->band, c->null_pivot, x_b);
+
+  /* Extract local part of solution */
+
+  const cs_lnum_t *restrict band_id = c->band_id + c->row_shift;
+
+  for (cs_lnum_t i = 0; i < c->n_rows; i++)
+    vx[i] = x_b[band_id[i]];
+
+  return CS_SLES_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,171 @@
+#ifndef __CS_MULTIGRID_DIRECT_H__
+#define __CS_MULTIGRID_DIRECT_H__
+
+/*============================================================================
+ * Sparse Linear Equation Solvers: Multigrid coarsest level direct solver
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo_perio.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Direct coarse solver context (opaque) */
+
+typedef struct _cs_multigrid_direct_t  cs_multigrid_direct_t;
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create direct solver context for a multigrid coarsest level.
+ *
+ * returns:
+ *   pointer to newly created direct solver context
+ *----------------------------------------------------------------------------*/
+
+cs_multigrid_direct_t *
+cs_multigrid_direct_create(void);
+
+/*----------------------------------------------------------------------------
+ * Destroy direct solver context for a multigrid coarsest level.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context
+ *               (actual type: cs_multigrid_direct_t  **)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_destroy(void  **context);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Set MPI communicator over which the coarse system is distributed.
+ *
+ * Ranks not belonging to this communicator (i.e. for which comm is
+ * MPI_COMM_NULL) are expected to have no local rows.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context
+ *   comm    <-- MPI communicator for coarse system (MPI_COMM_NULL if local)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_set_comm(cs_multigrid_direct_t  *context,
+                             MPI_Comm                comm);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Setup (factorize) direct solver for a multigrid coarsest level.
+ *
+ * The distributed matrix is gathered on all ranks of the associated
+ * communicator, renumbered using a reverse Cuthill-McKee ordering, and
+ * factorized in banded form, so that each subsequent solve only requires
+ * gathering the right-hand side and a forward and back substitution.
+ *
+ * parameters:
+ *   context   <-> pointer to direct solver context
+ *                 (actual type: cs_multigrid_direct_t  *)
+ *   name      <-- pointer to system name
+ *   a         <-- associated matrix
+ *   verbosity <-- verbosity level
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_direct_setup(void               *context,
+                          const char         *name,
+                          const cs_matrix_t  *a,
+                          int                 verbosity);
+
+/*----------------------------------------------------------------------------
+ * Solve coarsest level system using direct solver.
+ *
+ * parameters:
+ *   context       <-> pointer to direct solver context
+ *                     (actual type: cs_multigrid_direct_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision (unused)
+ *   r_norm        <-- residue normalization (unused)
+ *   n_iter        --> number of iterations (1)
+ *   residue       --> residue (0, as not computed)
+ *   rhs           <-- right hand side
+ *   vx            <-> system solution
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area (unused)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_multigrid_direct_solve(void                *context,
+                          const char          *name,
+                          const cs_matrix_t   *a,
+                          int                  verbosity,
+                          cs_halo_rotation_t   rotation_mode,
+                          double               precision,
+                          double               r_norm,
+                          int                 *n_iter,
+                          double              *residue,
+                          const cs_real_t     *rhs,
+                          cs_real_t           *vx,
+                          size_t               aux_size,
+                          void                *aux_vectors);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MULTIGRID_DIRECT_H__ */
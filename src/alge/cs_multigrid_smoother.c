@@ -1771,6 +1771,270 @@ _p_gauss_seidel(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Build a distance-1 coloring of local matrix rows for multicolor
+ * Gauss-Seidel.
+ *
+ * A greedy algorithm is used, so that no 2 rows of a same color are
+ * coupled by a matrix coefficient. The matrix structure is assumed
+ * symmetric (as is the case for matrices built from faces or edges), so
+ * only couplings with previous rows are checked. Couplings with ghost
+ * cells are ignored, as those are only updated by halo synchronization.
+ * Rows of each color are listed in increasing order.
+ *
+ * parameters:
+ *   c <-> pointer to solver context info
+ *   a <-- linear equation matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_mc_build_colors(cs_sles_it_t       *c,
+                 const cs_matrix_t  *a)
+{
+  cs_sles_it_setup_t *sd = c->setup_data;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, NULL);
+
+  cs_lnum_t max_row_size = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    max_row_size = CS_MAX(max_row_size, a_row_index[ii+1] - a_row_index[ii]);
+
+  cs_lnum_t *color, *forbidden;
+  BFT_MALLOC(color, n_rows, cs_lnum_t);
+  BFT_MALLOC(forbidden, max_row_size + 1, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < max_row_size + 1; ii++)
+    forbidden[ii] = -1;
+
+  cs_lnum_t n_colors = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      cs_lnum_t j = a_col_id[jj];
+      if (j < ii)
+        forbidden[color[j]] = ii;
+    }
+    cs_lnum_t cl = 0;
+    while (forbidden[cl] == ii)
+      cl++;
+    color[ii] = cl;
+    n_colors = CS_MAX(n_colors, cl + 1);
+  }
+
+  BFT_FREE(forbidden);
+
+  sd->n_colors = n_colors;
+
+  BFT_REALLOC(sd->color_index, n_colors + 1, cs_lnum_t);
+  BFT_REALLOC(sd->color_rows, n_rows, cs_lnum_t);
+
+  cs_lnum_t *c_index = sd->color_index;
+
+  for (cs_lnum_t cl = 0; cl < n_colors + 1; cl++)
+    c_index[cl] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    c_index[color[ii] + 1] += 1;
+
+  for (cs_lnum_t cl = 0; cl < n_colors; cl++)
+    c_index[cl+1] += c_index[cl];
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t cl = color[ii];
+    sd->color_rows[c_index[cl]] = ii;
+    c_index[cl] += 1;
+  }
+
+  for (cs_lnum_t cl = n_colors; cl > 0; cl--)
+    c_index[cl] = c_index[cl-1];
+  c_index[0] = 0;
+
+  BFT_FREE(color);
+}
+
+/*----------------------------------------------------------------------------
+ * Sweep over rows for multicolor Gauss-Seidel.
+ *
+ * Rows of a given color are not coupled, so they are processed in
+ * parallel; colors are processed in sequence.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   backward        <-- if true, handle colors in reverse order
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_mc_gauss_seidel_sweep(cs_sles_it_t       *c,
+                       const cs_matrix_t  *a,
+                       int                 diag_block_size,
+                       bool                backward,
+                       const cs_real_t    *rhs,
+                       cs_real_t          *restrict vx)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const int n_colors = c->setup_data->n_colors;
+  const cs_lnum_t  *restrict color_index = c->setup_data->color_index;
+  const cs_lnum_t  *restrict color_rows = c->setup_data->color_rows;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+# pragma omp parallel if(n_rows > CS_THR_MIN && !_thread_debug)
+  {
+    for (int cl_id = 0; cl_id < n_colors; cl_id++) {
+
+      const int cl = (backward) ? n_colors - 1 - cl_id : cl_id;
+
+      if (diag_block_size == 1) {
+
+#       pragma omp for
+        for (cs_lnum_t ll = color_index[cl]; ll < color_index[cl+1]; ll++) {
+
+          cs_lnum_t ii = color_rows[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0 = rhs[ii];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+          vx[ii] = vx0 * ad_inv[ii];
+
+        }
+
+      }
+      else {
+
+#       pragma omp for
+        for (cs_lnum_t ll = color_index[cl]; ll < color_index[cl+1]; ll++) {
+
+          cs_lnum_t ii = color_rows[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+              vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          }
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+            vx[ii*db_size[1] + kk] = _vx[kk];
+
+        }
+
+      }
+
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using multicolor Gauss-Seidel.
+ *
+ * Unlike the process-local variants, results do not depend on the number
+ * of threads used, though they depend on the coloring (i.e. the ordering).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_mc_gauss_seidel_msr(cs_sles_it_t              *c,
+                     const cs_matrix_t         *a,
+                     int                        diag_block_size,
+                     cs_halo_rotation_t         rotation_mode,
+                     cs_sles_it_convergence_t  *convergence,
+                     const cs_real_t           *rhs,
+                     cs_real_t                 *restrict vx,
+                     size_t                     aux_size,
+                     void                      *aux_vectors)
+{
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  unsigned n_iter = 0;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  const bool symmetric
+    = (c->type == CS_SLES_MC_SYM_GAUSS_SEIDEL) ? true : false;
+
+  assert(c->setup_data != NULL && c->setup_data->color_index != NULL);
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk: forward step */
+
+    _mc_gauss_seidel_sweep(c, a, diag_block_size, false, rhs, vx);
+
+    if (symmetric) {
+
+      /* Synchronize ghost cells again */
+
+      if (halo != NULL)
+        cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+      /* Compute Vx <- Vx - (A-diag).Rk: backward step */
+
+      _mc_gauss_seidel_sweep(c, a, diag_block_size, true, rhs, vx);
+
+    }
+
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1818,6 +2082,8 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_MC_GAUSS_SEIDEL:
+  case CS_SLES_MC_SYM_GAUSS_SEIDEL:
     break;
 
   case CS_SLES_PCG:
@@ -1923,6 +2189,20 @@ cs_multigrid_smoother_setup(void               *context,
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
   }
 
+  else if (   c->type == CS_SLES_MC_GAUSS_SEIDEL
+           || c->type == CS_SLES_MC_SYM_GAUSS_SEIDEL) {
+    /* Force to Jacobi type in case matrix type is not adapted */
+    if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+      c->type = CS_SLES_JACOBI;
+    cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
+    if (c->type != CS_SLES_JACOBI) {
+      _mc_build_colors(c, a);
+      if (verbosity > 1)
+        bft_printf(_("  Multicolor Gauss-Seidel: %d colors\n"),
+                   c->setup_data->n_colors);
+    }
+  }
+
   else
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, false);
 
@@ -1985,6 +2265,11 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _ts_b_gauss_seidel_msr;
     break;
 
+  case CS_SLES_MC_GAUSS_SEIDEL:
+  case CS_SLES_MC_SYM_GAUSS_SEIDEL:
+    c->solve = _mc_gauss_seidel_msr;
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
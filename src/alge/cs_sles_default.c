@@ -103,6 +103,33 @@ static const int _n_max_iter_default = 10000;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Indicate if an iterative solver or smoother type requires
+ * an MSR matrix (i.e. is of Gauss-Seidel type).
+ *
+ * parameters:
+ *   type <-- iterative solver or smoother type
+ *
+ * returns:
+ *   true if an MSR matrix is required, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_needs_msr(cs_sles_it_type_t  type)
+{
+  switch(type) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_MC_GAUSS_SEIDEL:
+  case CS_SLES_MC_SYM_GAUSS_SEIDEL:
+    return true;
+  default:
+    return false;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default definition of a sparse linear equation solver
@@ -676,6 +703,7 @@ cs_sles_solve_native(int                  f_id,
   const cs_mesh_t *m = cs_glob_mesh;
 
   bool need_msr = false;
+  bool prefer_native = false;
 
   /* Check if this system has already been setup */
 
@@ -744,15 +772,21 @@ cs_sles_solve_native(int                  f_id,
     if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
       cs_sles_it_t *c = cs_sles_get_context(sc);
       cs_sles_it_type_t s_type = cs_sles_it_get_type(c);
-      if (   s_type >= CS_SLES_P_GAUSS_SEIDEL
-          && s_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
+      if (_needs_msr(s_type))
         need_msr = true;
       else {
         pc = cs_sles_it_get_pc(c);
         if (pc != NULL) {
-          if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
+          const char *pc_type = cs_sles_pc_get_type(pc);
+          if (strcmp(pc_type, "multigrid") == 0)
             mg = cs_sles_pc_get_context(pc);
+          else if (   strcmp(pc_type, "symmetric_gauss_seidel") == 0
+                   || strcmp(pc_type, "ilu0") == 0)
+            need_msr = true;
         }
+        /* Use face-based coefficients directly if too few products are
+           expected to amortize a conversion */
+        prefer_native = cs_sles_it_prefer_native_matrix(c);
       }
     }
     else if (strcmp(cs_sles_get_type(sc), "cs_multigrid_t") == 0)
@@ -760,8 +794,7 @@ cs_sles_solve_native(int                  f_id,
 
     if (mg != NULL) {
       cs_sles_it_type_t fs_type = cs_multigrid_get_fine_solver_type(mg);
-      if (   fs_type >= CS_SLES_P_GAUSS_SEIDEL
-          && fs_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
+      if (_needs_msr(fs_type))
         need_msr = true;
     }
 
@@ -775,6 +808,10 @@ cs_sles_solve_native(int                  f_id,
       a = cs_matrix_msr(symmetric,
                         diag_block_size,
                         extra_diag_block_size);
+    else if (prefer_native)
+      a = cs_matrix_native(symmetric,
+                           diag_block_size,
+                           extra_diag_block_size);
     else
       a = cs_matrix_default(symmetric,
                             diag_block_size,
@@ -42,6 +42,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -104,6 +108,12 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Maximum number of dot products handled in a single pass over the rows
+   for s-step solvers, and associated row block size */
+
+#define CS_SLES_IT_DOT_BATCH 64
+#define CS_SLES_IT_DOT_BLOCK_SIZE 256
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -118,6 +128,11 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Number of basis vectors generated per global reduction
+   for s-step (communication-avoiding) solvers */
+
+static int _s_step = 3;
+
 /* Sparse linear equation solver type names */
 
 const char *cs_sles_it_type_name[]
@@ -131,9 +146,14 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("s-step GMRES"),
+     N_("s-step BiCGstab"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Multicolor Gauss-Seidel"),
+     N_("Multicolor symmetric Gauss-Seidel"),
 };
 
 /*=============================================================================
@@ -362,20 +382,12 @@ _conjugate_gradient(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha =  - ro_0 * d_ro_1;
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+    /* Update solution and residue, fused with residue norm computation */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] += (alpha * zk[ii]);
-    }
+    residue = sqrt(_axpy2_dot_xx(c, alpha, dk, vx, alpha, zk, rk));
 
     /* Convergence test */
 
-    residue = sqrt(_dot_product_xx(c, rk));
     cvg = _convergence_test(c, n_iter, residue, convergence);
 
     /* Current Iteration */
@@ -424,6 +436,10 @@ _conjugate_gradient(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha =  - ro_0 * d_ro_1;
 
+    /* Unlike the first iteration, the residue norm is not fused with this
+       update: it is computed with rk.gk after preconditioning, in the same
+       pass and reduction, so fusing it would only add a reduction */
+
 #   pragma omp parallel if(n_rows > CS_THR_MIN)
     {
 #     pragma omp for nowait
@@ -558,7 +574,10 @@ _flexible_conjugate_gradient(cs_sles_it_t              *c,
     if (cvg != CS_SLES_ITERATING)
       break;
 
-    /* Complete descent parameter computation and matrix.vector product */
+    /* Complete descent parameter computation and matrix.vector product;
+       updates are not fused with dot products (see _axpy_dots), as all
+       products required by the next iteration except rk.rk involve
+       vk = M.rk and wk = A.vk, and are computed with a single reduction */
 
     if (n_iter > 0) {
 
@@ -944,21 +963,12 @@ _conjugate_gradient_sr(cs_sles_it_t              *c,
 
     rk_gkm1 = ro_0;
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+    /* Update solution and residue, fused with residue norm computation */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] += (alpha * zk[ii]);
-    }
+    residue = sqrt(_axpy2_dot_xx(c, alpha, dk, vx, alpha, zk, rk));
 
     /* Convergence test */
 
-    residue = sqrt(_dot_product_xx(c, rk));
-
     cvg = _convergence_test(c, n_iter, residue, convergence);
 
   }
@@ -1133,20 +1143,13 @@ _conjugate_gradient_npc(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha =  - ro_0 * d_ro_1;
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+    /* Update solution and residue, fused with residue norm computation */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] += (alpha * zk[ii]);
-    }
+    rk_rk = _axpy2_dot_xx(c, alpha, dk, vx, alpha, zk, rk);
 
     /* Convergence test */
 
-    residue = sqrt(_dot_product(c, rk, rk));
+    residue = sqrt(rk_rk);
 
     cvg = _convergence_test(c, n_iter, residue, convergence);
 
@@ -1157,23 +1160,10 @@ _conjugate_gradient_npc(cs_sles_it_t              *c,
 
   while (cvg == CS_SLES_ITERATING) {
 
-    /* compute residue and prepare descent parameter */
-
-    _dot_products_xx_xy(c, rk, rk, &residue, &rk_rk);
-
-    residue = sqrt(residue);
-
-    /* Convergence test for end of previous iteration */
-
-    if (n_iter > 1)
-      cvg = _convergence_test(c, n_iter, residue, convergence);
-
-    if (cvg != CS_SLES_ITERATING)
-      break;
-
     n_iter += 1;
 
-    /* Complete descent parameter computation and matrix.vector product */
+    /* Complete descent parameter computation and matrix.vector product
+       (residue was computed along with the previous update) */
 
     beta = rk_rk / rk_rkm1;
     rk_rkm1 = rk_rk;
@@ -1189,16 +1179,15 @@ _conjugate_gradient_npc(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha =  - ro_0 * d_ro_1;
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+    /* Update solution and residue, fused with residue norm computation */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] += (alpha * zk[ii]);
-    }
+    rk_rk = _axpy2_dot_xx(c, alpha, dk, vx, alpha, zk, rk);
+
+    /* Convergence test */
+
+    residue = sqrt(rk_rk);
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
 
   }
 
@@ -1322,21 +1311,12 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
 
     rk_rkm1 = ro_0;
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+    /* Update solution and residue, fused with residue norm computation */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] += (alpha * zk[ii]);
-    }
+    residue = sqrt(_axpy2_dot_xx(c, alpha, dk, vx, alpha, zk, rk));
 
     /* Convergence test */
 
-    residue = sqrt(_dot_product_xx(c, rk));
-
     cvg = _convergence_test(c, n_iter, residue, convergence);
 
   }
@@ -1995,6 +1975,214 @@ _breakdown(cs_sles_it_t                 *c,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant (Ghysels and Vanroose) requires a single global reduction
+ * per iteration, which is non-blocking (when available) and overlapped
+ * with the preconditioning and matrix.vector product, at the cost of
+ * additional vector updates and a possibly lower numerical stability.
+ * As with the parallel-optimized PCG variant, the preconditioner and
+ * matrix.vector product are computed for n+1 iterations instead of n.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              int                        diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  alpha = 0., beta = 0., gamma_km1 = 0., residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue (with r = b - A.x sign convention here) */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  /* Preconditioning and associated matrix.vector product */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);  /* wk = A.uk */
+
+  /* Direction vectors are combined with beta = 0 at the first iteration,
+     so they must not contain uninitialized (possibly NaN) values */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    zk[ii] = 0.;
+    qk[ii] = 0.;
+    sk[ii] = 0.;
+    pk[ii] = 0.;
+  }
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Start global reduction for r.r, r.u, and u.w */
+
+    double s[3];
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+
+    double _s[3];
+#if (MPI_VERSION >= 3)
+    MPI_Request request = MPI_REQUEST_NULL;
+#endif
+
+    if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+      MPI_Iallreduce(s, _s, 3, MPI_DOUBLE, MPI_SUM, c->comm, &request);
+#else
+      MPI_Allreduce(s, _s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    /* Overlap reduction with preconditioning and matrix.vector product */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);  /* nk = A.mk */
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+      for (int i = 0; i < 3; i++)
+        s[i] = _s[i];
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    residue = sqrt(s[0]);
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Descent parameters */
+
+    const double gamma_k = s[1];
+    double delta = s[2];
+
+    if (n_iter > 1) {
+      beta = gamma_k / gamma_km1;
+      delta -= beta * gamma_k / alpha;
+    }
+
+    if (_breakdown(c, convergence, "delta", delta, DBL_MIN,
+                   residue, n_iter, &cvg))
+      break;
+
+    alpha = gamma_k / delta;
+    gamma_km1 = gamma_k;
+
+    /* Update directions, solution, and residue */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + (beta * zk[ii]);
+      qk[ii] = mk[ii] + (beta * qk[ii]);
+      sk[ii] = wk[ii] + (beta * sk[ii]);
+      pk[ii] = uk[ii] + (beta * pk[ii]);
+      vx[ii] += alpha * pk[ii];
+      rk[ii] -= alpha * sk[ii];
+      uk[ii] -= alpha * qk[ii];
+      wk[ii] -= alpha * zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned Bi-CGSTAB.
  *
@@ -2102,10 +2290,8 @@ _bi_cgstab(cs_sles_it_t              *c,
       residue = sqrt(beta);
       c->setup_data->initial_residue = residue;
     }
-    else {
-      _dot_products_xx_xy(c, rk, res0, &residue, &beta);
+    else /* rk.rk and rk.res0 computed along with previous update */
       residue = sqrt(residue);
-    }
 
     /* Convergence test */
     cvg = _convergence_test(c, n_iter, residue, convergence);
@@ -2181,18 +2367,11 @@ _bi_cgstab(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha = ro_0 * d_ro_1;
 
-    /* Final update of vx and rk */
-
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * zk[ii]);
+    /* Final update of vx and rk, fused with dot products
+       for next iteration's beta and residue */
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        rk[ii] -= (alpha * vk[ii]);
-    }
+    _axpy2_dot_xx_xy(c, alpha, zk, vx, -alpha, vk, rk, res0,
+                     &residue, &beta);
 
     /* Convergence test at beginning of next iteration so
        as to group dot products for better parallel performance */
@@ -2738,23 +2917,24 @@ _gmres(cs_sles_it_t              *c,
 
       cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
 
-      for (jj = 0; jj < ii + 1; jj++) {
-
-        /* compute h(k,i) = <w,vi> = <dk,vi> */
-        _h_matrix[ii*krylov_size + jj]
-          = _dot_product(c, dk, (_krylov_vectors + jj*n_rows));
+      /* compute h(k,i) = <w,vi> = <dk,vi>, then w = dk <- w - h(i,k)*vi;
+         each update is fused with the following dot product */
 
-        /* compute w = dk <- w - h(i,k)*vi */
+      _h_matrix[ii*krylov_size] = _dot_product(c, dk, _krylov_vectors);
 
-        cs_axpy(n_rows,
-                -_h_matrix[ii*krylov_size+jj],
-                (_krylov_vectors + jj*n_rows),
-                dk);
+      for (jj = 0; jj < ii; jj++)
+        _h_matrix[ii*krylov_size + jj + 1]
+          = _axpy_dot(c,
+                      -_h_matrix[ii*krylov_size + jj],
+                      (_krylov_vectors + jj*n_rows),
+                      dk,
+                      (_krylov_vectors + (jj+1)*n_rows));
 
-      }
-
-      /* compute h(i+1,i) = sqrt<w,w> */
-      dot_prod = sqrt(_dot_product(c, dk, dk));
+      /* compute h(i+1,i) = sqrt<w,w> (fused with last update) */
+      dot_prod = sqrt(_axpy_dot_xx(c,
+                                   -_h_matrix[ii*krylov_size + ii],
+                                   (_krylov_vectors + ii*n_rows),
+                                   dk));
       _h_matrix[ii*krylov_size + ii + 1] = dot_prod;
 
       if (dot_prod < epsi) scaltest = 1;
@@ -2797,11 +2977,7 @@ _gmres(cs_sles_it_t              *c,
 
         /* compute residue = | Ax - b |_1 */
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (jj = 0; jj < n_rows; jj++)
-          bk[jj] -= rhs[jj];
-
-        residue = sqrt(_dot_product_xx(c, bk));
+        residue = sqrt(_axpy_dot_xx(c, -1., rhs, bk));
 
         cvg = _convergence_test(c, n_iter, residue, convergence);
 
@@ -2827,36 +3003,1122 @@ _gmres(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
- *
- * On entry, vx is considered initialized.
+ * Sum local values over all ranks of a solver's communicator.
  *
  * parameters:
- *   c               <-- pointer to solver context info
- *   a               <-- linear equation matrix
- *   diag_block_size <-- diagonal block size
- *   rotation_mode   <-- halo update option for rotational periodicity
- *   convergence     <-- convergence information structure
- *   rhs             <-- right hand side
- *   vx              <-> system solution
- *   aux_size        <-- number of elements in aux_vectors (in bytes)
- *   aux_vectors     --- optional working area (unused here)
- *
- * returns:
- *   convergence state
+ *   c  <-- pointer to solver context info
+ *   n  <-- number of values
+ *   s  <-> values to sum (local in, global out)
  *----------------------------------------------------------------------------*/
 
-static cs_sles_convergence_state_t
-_p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
-                            const cs_matrix_t         *a,
-                            int                        diag_block_size,
-                            cs_halo_rotation_t         rotation_mode,
-                            cs_sles_it_convergence_t  *convergence,
-                            const cs_real_t           *rhs,
-                            cs_real_t                 *restrict vx)
+static void
+_sum_reduce(const cs_sles_it_t  *c,
+            int                  n,
+            double               s[])
 {
-  cs_sles_convergence_state_t cvg;
-  double  res2, residue;
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+
+#if defined(HAVE_MPI_IN_PLACE)
+
+    MPI_Allreduce(MPI_IN_PLACE, s, n, MPI_DOUBLE, MPI_SUM, c->comm);
+
+#else
+
+    double _sum[CS_SLES_IT_DOT_BATCH];
+
+    for (int s_id = 0; s_id < n; s_id += CS_SLES_IT_DOT_BATCH) {
+      int _n = CS_MIN(n - s_id, CS_SLES_IT_DOT_BATCH);
+      MPI_Allreduce(s + s_id, _sum, _n, MPI_DOUBLE, MPI_SUM, c->comm);
+      memcpy(s + s_id, _sum, _n*sizeof(double));
+    }
+
+#endif
+
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate reproducible sum accumulators for a given number of dot
+ * products, if the reproducible BLAS reduction mode is active and the
+ * solver is distributed.
+ *
+ * In other cases, local dot products are summed over ranks as doubles,
+ * which is also reproducible in serial mode.
+ *
+ * parameters:
+ *   c  <-- pointer to solver context info
+ *   n  <-- number of dot products
+ *
+ * returns:
+ *   pointer to allocated accumulators, or NULL
+ *----------------------------------------------------------------------------*/
+
+static cs_blas_rsum_t *
+_rsum_dot_accumulators(const cs_sles_it_t  *c,
+                       int                  n)
+{
+  cs_blas_rsum_t *acc = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (   c->comm != MPI_COMM_NULL
+      && cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE)
+    BFT_MALLOC(acc, n, cs_blas_rsum_t);
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+
+#endif /* defined(HAVE_MPI) */
+
+  return acc;
+}
+
+/*----------------------------------------------------------------------------
+ * Sum local dot products over all ranks of a solver's communicator.
+ *
+ * If reproducible sum accumulators are given, they are summed, and
+ * converted to the resulting values; otherwise, local values are summed.
+ *
+ * parameters:
+ *   c    <-- pointer to solver context info
+ *   n    <-- number of values
+ *   s    <-> values to sum (local in, global out)
+ *   acc  <-> matching accumulators, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_reduce_dots(const cs_sles_it_t  *c,
+                 int                  n,
+                 double               s[],
+                 cs_blas_rsum_t       acc[])
+{
+#if defined(HAVE_MPI)
+
+  if (acc != NULL) {
+    cs_blas_rsum_allreduce(n, acc, c->comm);
+    for (int i = 0; i < n; i++)
+      s[i] = cs_blas_rsum_value(acc + i);
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  CS_UNUSED(acc);
+
+  _sum_reduce(c, n, s);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute local dot products between two sets of vectors.
+ *
+ * Results are stored column by column: s[j*n_x + i] = x_i.y_j, or
+ * only for i <= j (packed upper triangle) if x and y are the same set.
+ *
+ * All products of a batch of up to CS_SLES_IT_DOT_BATCH values are
+ * computed in a single pass over the rows, handled by blocks small
+ * enough for the matching parts of all vectors to remain in cache.
+ * Each thread sums a fixed (static) range of blocks in block order, and
+ * thread partial sums are added in thread order, so the summation order
+ * only depends on the number of threads, as for cs_dot.
+ * Compensated or reproducible sums are delegated to cs_dot.
+ *
+ * If accumulators are given, products are accumulated with cs_dot_rsum
+ * instead (in batches of CS_BLAS_RSUM_MAX_DOTS), so that their sums
+ * over ranks do not depend on the partitioning, and s is not used.
+ *
+ * parameters:
+ *   n_rows   <-- number of rows
+ *   n_x      <-- number of vectors in first set
+ *   x        <-- first set of vectors
+ *   n_y      <-- number of vectors in second set
+ *   y        <-- second set of vectors (x for packed symmetric products)
+ *   stride   <-- stride between successive vectors of a set
+ *   s        --> local dot products
+ *   acc      --> local reproducible sum accumulators, or NULL
+ *
+ * returns:
+ *   number of values computed
+ *----------------------------------------------------------------------------*/
+
+static int
+_local_dot_products(cs_lnum_t         n_rows,
+                    int               n_x,
+                    const cs_real_t  *x,
+                    int               n_y,
+                    const cs_real_t  *y,
+                    size_t            stride,
+                    double            s[],
+                    cs_blas_rsum_t    acc[])
+{
+  const int n_dots = (x == y) ? n_y*(n_y+1)/2 : n_x*n_y;
+
+  if (acc != NULL) {
+
+    const cs_real_t *b_x[CS_BLAS_RSUM_MAX_DOTS], *b_y[CS_BLAS_RSUM_MAX_DOTS];
+
+    int k = 0, n_k = 0;
+
+    for (int j = 0; j < n_y; j++) {
+      int i_end = (x == y) ? j+1 : n_x;
+      for (int i = 0; i < i_end; i++) {
+        b_x[n_k] = x + i*stride;
+        b_y[n_k] = y + j*stride;
+        n_k++;
+        if (n_k == CS_BLAS_RSUM_MAX_DOTS || k + n_k == n_dots) {
+          cs_dot_rsum(n_rows, n_k, b_x, b_y, acc + k);
+          k += n_k;
+          n_k = 0;
+        }
+      }
+    }
+
+    return n_dots;
+  }
+
+  if (cs_blas_get_reduce_algorithm() != CS_BLAS_REDUCE_SUPERBLOCK) {
+    int k = 0;
+    for (int j = 0; j < n_y; j++) {
+      int i_end = (x == y) ? j+1 : n_x;
+      for (int i = 0; i < i_end; i++)
+        s[k++] = cs_dot(n_rows, x + i*stride, y + j*stride);
+    }
+    return k;
+  }
+
+  const cs_lnum_t block_size = CS_SLES_IT_DOT_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n_rows + block_size - 1) / block_size;
+
+  int n_t = 1, n_t_max = 1;
+
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
+
+  double *t_s_all;
+  BFT_MALLOC(t_s_all, n_t_max*CS_SLES_IT_DOT_BATCH, double);
+
+  int j = 0, i = 0;
+
+  for (int k_s = 0; k_s < n_dots; k_s += CS_SLES_IT_DOT_BATCH) {
+
+    const int n_k = CS_MIN(n_dots - k_s, CS_SLES_IT_DOT_BATCH);
+
+    /* Vector pairs for this batch */
+
+    const cs_real_t *b_x[CS_SLES_IT_DOT_BATCH], *b_y[CS_SLES_IT_DOT_BATCH];
+
+    for (int k = 0; k < n_k; k++) {
+      b_x[k] = x + i*stride;
+      b_y[k] = y + j*stride;
+      s[k_s + k] = 0.;
+      i++;
+      if (i >= ((x == y) ? j+1 : n_x)) {
+        i = 0;
+        j++;
+      }
+    }
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+      int t_id = 0;
+
+#if defined(HAVE_OPENMP)
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        n_t = omp_get_num_threads();
+#endif
+
+      double *t_s = t_s_all + t_id*CS_SLES_IT_DOT_BATCH;
+
+      for (int k = 0; k < n_k; k++)
+        t_s[k] = 0.;
+
+#     pragma omp for schedule(static)
+      for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+        const cs_lnum_t s_id = b_id*block_size;
+        const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_rows);
+
+        for (int k = 0; k < n_k; k++) {
+          const cs_real_t *restrict _x = b_x[k];
+          const cs_real_t *restrict _y = b_y[k];
+          double b_s = 0.;
+          for (cs_lnum_t ii = s_id; ii < e_id; ii++)
+            b_s += _x[ii]*_y[ii];
+          t_s[k] += b_s;
+        }
+
+      }
+
+    }
+
+    for (int t_id = 0; t_id < n_t; t_id++) {
+      const double *t_s = t_s_all + t_id*CS_SLES_IT_DOT_BATCH;
+      for (int k = 0; k < n_k; k++)
+        s[k_s + k] += t_s[k];
+    }
+
+  }
+
+  BFT_FREE(t_s_all);
+
+  return n_dots;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute successive scaled powers of the preconditioned operator applied
+ * to a vector: v_(k+1) = A.M^-1.v_k / sigma.
+ *
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   a             <-- matrix
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   n_rows        <-- number of rows
+ *   sigma         <-- operator scaling factor
+ *   n_powers      <-- number of powers to compute
+ *   stride        <-- stride between successive vectors
+ *   v             <-> vectors (v_0 input, v_1 to v_n_powers output)
+ *   gk            --- work vector (size: n_cols)
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_powers(cs_sles_it_t        *c,
+               const cs_matrix_t   *a,
+               cs_halo_rotation_t   rotation_mode,
+               cs_lnum_t            n_rows,
+               double               sigma,
+               int                  n_powers,
+               size_t               stride,
+               cs_real_t           *restrict v,
+               cs_real_t           *restrict gk)
+{
+  const double d_sigma = 1. / sigma;
+
+  for (int k = 0; k < n_powers; k++) {
+
+    cs_real_t *restrict v_k = v + k*stride;
+    cs_real_t *restrict v_kp1 = v + (k+1)*stride;
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            v_k,
+                            gk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, gk, v_kp1);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      v_kp1[ii] *= d_sigma;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the Cholesky factor R of a small symmetric positive-definite
+ * dense matrix G, such that G = R^t.R.
+ *
+ * parameters:
+ *   n  <-- matrix size
+ *   g  <-- dense symmetric matrix (g(i,j) = g[i + j*n])
+ *   r  --> upper triangular factor (r(i,j) = r[i + j*n]), lower part zero
+ *
+ * returns:
+ *   smallest pivot found (the factorization is incomplete if <= 0)
+ *----------------------------------------------------------------------------*/
+
+static double
+_cholesky_upper(int            n,
+                const double  *g,
+                double        *r)
+{
+  double min_pivot = HUGE_VAL;
+
+  for (int i = 0; i < n*n; i++)
+    r[i] = 0.;
+
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i <= j; i++) {
+      double v = g[i + j*n];
+      for (int k = 0; k < i; k++)
+        v -= r[k + i*n] * r[k + j*n];
+      if (i < j)
+        r[i + j*n] = v / r[i + i*n];
+      else {
+        min_pivot = CS_MIN(min_pivot, v);
+        if (v <= 0.)
+          return v;
+        r[j + j*n] = sqrt(v);
+      }
+    }
+  }
+
+  return min_pivot;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned s-step
+ * (communication-avoiding) GMRES.
+ *
+ * Each outer step generates s Krylov basis vectors using successive
+ * (scaled) applications of the preconditioned operator, then
+ * orthonormalizes them against the current basis using block classical
+ * Gram-Schmidt and a Cholesky QR factorization, requiring a single global
+ * reduction for the s vectors. The Hessenberg matrix is then recovered
+ * from the change of basis, and the least-squares problem updated using
+ * Givens rotations, with no additional communication.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_gmres_s_step(cs_sles_it_t              *c,
+              const cs_matrix_t         *a,
+              int                        diag_block_size,
+              cs_halo_rotation_t         rotation_mode,
+              cs_sles_it_convergence_t  *convergence,
+              const cs_real_t           *rhs,
+              cs_real_t                 *restrict vx,
+              size_t                     aux_size,
+              void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+
+  assert(diag_block_size == 1);
+
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  residue, sigma = 1.;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict gk, *restrict qk;
+
+  const int s = _s_step;
+  const int krylov_size_max = 75;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  /* Restart length (multiple of s) */
+
+  int krylov_size =  (krylov_size_max < (int)sqrt(n_rows)*1.5) ?
+                      krylov_size_max : (int)sqrt(n_rows)*1.5 + 1;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size;
+    MPI_Allreduce(&krylov_size,
+                  &_krylov_size,
+                  1,
+                  MPI_INT,
+                  MPI_MIN,
+                  c->comm);
+    krylov_size = _krylov_size;
+  }
+#endif
+
+  const int m = CS_MAX(((krylov_size - 1) / s) * s, s);
+  const int ld = m + 1;
+
+  const size_t wa_size
+    = CS_SIMD_SIZE(cs_matrix_get_n_columns(a) * diag_block_size);
+
+  {
+    const size_t n_wa = 2 + (m + 1);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    qk = _aux_vectors + wa_size*2;
+  }
+
+  /* Small dense work arrays: unrotated and rotated Hessenberg matrices,
+     Givens coefficients, right-hand side and solution of least-squares
+     problem, block orthogonalization coefficients */
+
+  double *h, *hr, *givens_coeff, *g, *y, *c_top, *gram, *rb, *m_b;
+  BFT_MALLOC(h, ld*m, double);
+  BFT_MALLOC(hr, ld*m, double);
+  BFT_MALLOC(givens_coeff, 2*ld, double);
+  BFT_MALLOC(g, ld, double);
+  BFT_MALLOC(y, ld, double);
+  BFT_MALLOC(c_top, (m+1)*s + s*s, double);
+  BFT_MALLOC(gram, s*s, double);
+  BFT_MALLOC(rb, s*s, double);
+  BFT_MALLOC(m_b, ld*(s+1), double);
+
+  cs_blas_rsum_t *acc = _rsum_dot_accumulators(c, (m+1)*s + s*s);
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Residue r0 = b - A.x0, and first operator application
+       (also used to estimate the operator scale) */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = rhs[ii] - rk[ii];
+
+    cs_real_t *restrict q_0 = qk;
+    cs_real_t *restrict q_1 = qk + wa_size;
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            rk,
+                            gk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, gk, q_1);
+
+    double s_rz[2];
+    const cs_real_t *v_rz[2] = {rk, q_1};
+
+    if (! _dot_products_reproducible(c, 2, v_rz, v_rz, s_rz)) {
+      s_rz[0] = cs_dot_xx(n_rows, rk);
+      s_rz[1] = cs_dot_xx(n_rows, q_1);
+      _sum_reduce(c, 2, s_rz);
+    }
+
+    residue = sqrt(s_rz[0]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    const double beta = residue;
+    sigma = (s_rz[0] > 0 && s_rz[1] > 0) ? sqrt(s_rz[1] / s_rz[0]) : 1.;
+
+    {
+      const double d_beta = 1. / beta, d_bs = 1. / (beta*sigma);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        q_0[ii] = rk[ii] * d_beta;
+        q_1[ii] *= d_bs;
+      }
+    }
+
+    for (int i = 0; i < ld*m; i++)
+      h[i] = 0.;
+
+    g[0] = beta;
+    for (int i = 1; i < ld; i++)
+      g[i] = 0.;
+
+    int j = 0;
+
+    while (j < m) {
+
+      /* Generate remaining basis vectors of block:
+         v_0 = q_j, v_(k+1) = A.M^-1.v_k / sigma */
+
+      if (j == 0)
+        _matrix_powers(c, a, rotation_mode, n_rows, sigma, s-1,
+                       wa_size, qk + wa_size, gk);
+      else
+        _matrix_powers(c, a, rotation_mode, n_rows, sigma, s,
+                       wa_size, qk + j*wa_size, gk);
+
+      /* Single fused reduction for Q_(0:j)^t.W and W^t.W,
+         with W = v_1 ... v_s */
+
+      cs_real_t *restrict w = qk + (j+1)*wa_size;
+
+      int n_c = _local_dot_products(n_rows, j+1, qk, s, w, wa_size,
+                                    c_top, acc);
+      int n_g = _local_dot_products(n_rows, s, w, s, w, wa_size,
+                                    c_top + n_c,
+                                    (acc != NULL) ? acc + n_c : NULL);
+      _sum_reduce_dots(c, n_c + n_g, c_top, acc);
+
+      /* Gram matrix of W orthogonalized against Q_(0:j) */
+
+      {
+        int k = n_c;
+        for (int k1 = 0; k1 < s; k1++) {
+          for (int k0 = 0; k0 <= k1; k0++) {
+            double v = c_top[k++];
+            for (int i = 0; i < j+1; i++)
+              v -= c_top[k0*(j+1) + i] * c_top[k1*(j+1) + i];
+            gram[k0 + k1*s] = v;
+            gram[k1 + k0*s] = v;
+          }
+        }
+      }
+
+      double pivot = _cholesky_upper(s, gram, rb);
+
+      if (_breakdown(c, convergence, "Cholesky QR pivot", pivot,
+                     1.e-30, residue, n_iter, &cvg))
+        break;
+
+      /* Block Gram-Schmidt and Cholesky QR: W <- (W - Q.C).Rb^-1 */
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        for (int k1 = 0; k1 < s; k1++) {
+          double v = w[k1*wa_size + ii];
+          for (int i = 0; i < j+1; i++)
+            v -= qk[i*wa_size + ii] * c_top[k1*(j+1) + i];
+          for (int k0 = 0; k0 < k1; k0++)
+            v -= w[k0*wa_size + ii] * rb[k0 + k1*s];
+          w[k1*wa_size + ii] = v / rb[k1 + k1*s];
+        }
+      }
+
+      /* Coordinates of v_k in Q_(0:j+s): column 0 is e_j, columns
+         1 to s are [C ; Rb]. With U = rows j to j+s-1 of columns 0 to s-1
+         (upper triangular) and T = rows 0 to j-1 of the same columns,
+         A.M^-1.Q_(j:j+s-1) = (sigma.V_(1:s) - A.M^-1.Q_(0:j-1).T).U^-1,
+         which provides the new Hessenberg columns. */
+
+      const int n_r = j + s + 1;
+
+      for (int k = 0; k < s; k++) {
+        double *m_k = m_b + k*ld;
+        for (int i = 0; i < j+1; i++)
+          m_k[i] = sigma * c_top[k*(j+1) + i];
+        for (int i = 0; i < s; i++)
+          m_k[j+1+i] = sigma * rb[i + k*s];
+        /* T column k (first column of T is zero) */
+        if (k > 0) {
+          for (int l = 0; l < j; l++) {
+            double t_lk = c_top[(k-1)*(j+1) + l];
+            for (int i = 0; i < l+2; i++)
+              m_k[i] -= h[l*ld + i] * t_lk;
+          }
+        }
+      }
+
+      for (int k = 0; k < s; k++) {
+        double *h_k = h + (j+k)*ld;
+        const double u_kk = (k == 0) ? 1. : rb[(k-1) + (k-1)*s];
+        for (int i = 0; i < n_r; i++) {
+          double v = m_b[k*ld + i];
+          for (int l = 0; l < k; l++) {
+            /* U(l,k): row j+l, column k */
+            double u_lk = (l == 0) ? c_top[(k-1)*(j+1) + j]
+                                   : rb[(l-1) + (k-1)*s];
+            v -= h[(j+l)*ld + i] * u_lk;
+          }
+          h_k[i] = v / u_kk;
+        }
+        for (int i = j+k+2; i < ld; i++)
+          h_k[i] = 0.;
+      }
+
+      /* Update least-squares problem with Givens rotations */
+
+      for (int k = j*ld; k < (j+s)*ld; k++)
+        hr[k] = h[k];
+
+      _givens_rot_update(hr, ld, g, givens_coeff, j, j+s);
+
+      j += s;
+      n_iter += s;
+
+      double res_est = CS_ABS(g[j]);
+
+      if (   res_est < convergence->precision * convergence->r_norm
+          || n_iter >= convergence->n_iterations_max)
+        break;
+
+    }
+
+    /* Update solution: x <- x + M^-1.Q.y */
+
+    if (j > 0) {
+
+      _solve_diag_sup_halo(hr, j, ld, g, y);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        double v = 0.;
+        for (int k = 0; k < j; k++)
+          v += qk[k*wa_size + ii] * y[k];
+        rk[ii] = v;
+      }
+
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              rk,
+                              gk);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += gk[ii];
+
+    }
+
+  }
+
+  BFT_FREE(m_b);
+  BFT_FREE(rb);
+  BFT_FREE(gram);
+  BFT_FREE(acc);
+  BFT_FREE(c_top);
+  BFT_FREE(y);
+  BFT_FREE(g);
+  BFT_FREE(givens_coeff);
+  BFT_FREE(hr);
+  BFT_FREE(h);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply the change of basis matrix of an s-step BiCGStab basis to
+ * coordinates: y = B.x, where A.M^-1.Y_k = sigma.Y_(k+1) within both
+ * the P (2s+1 vectors) and R (2s vectors) parts of the basis.
+ *
+ * parameters:
+ *   s      <-- s-step size
+ *   sigma  <-- operator scaling factor
+ *   x      <-- input coordinates (size 4s+1)
+ *   y      --> output coordinates (size 4s+1)
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_s_step_basis_shift(int           s,
+                    double        sigma,
+                    const double  x[],
+                    double        y[])
+{
+  const int r_s = 2*s + 1;
+
+  y[0] = 0.;
+  for (int i = 0; i < 2*s; i++)
+    y[i+1] = sigma * x[i];
+
+  y[r_s] = 0.;
+  for (int i = 0; i < 2*s - 1; i++)
+    y[r_s + i+1] = sigma * x[r_s + i];
+}
+
+/*----------------------------------------------------------------------------
+ * Compute x^t.G.y for a small dense symmetric matrix G.
+ *
+ * parameters:
+ *   n  <-- matrix size
+ *   g  <-- dense matrix (g(i,j) = g[i + j*n])
+ *   x  <-- first vector
+ *   y  <-- second vector
+ *
+ * returns:
+ *   x^t.G.y
+ *----------------------------------------------------------------------------*/
+
+static inline double
+_g_dot(int           n,
+       const double  g[],
+       const double  x[],
+       const double  y[])
+{
+  double s = 0.;
+
+  for (int j = 0; j < n; j++) {
+    double gy = 0.;
+    for (int i = 0; i < n; i++)
+      gy += g[i + j*n] * x[i];
+    s += gy * y[j];
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned s-step
+ * (communication-avoiding) BiCGStab.
+ *
+ * Each outer step builds bases for the search direction and residual
+ * Krylov subspaces (2s+1 and 2s vectors), then computes their Gram matrix
+ * and products with the shadow residual in a single global reduction.
+ * The s following BiCGStab iterations are then computed on the
+ * coordinates in that basis, without communication.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_bi_cgstab_s_step(cs_sles_it_t              *c,
+                  const cs_matrix_t         *a,
+                  int                        diag_block_size,
+                  cs_halo_rotation_t         rotation_mode,
+                  cs_sles_it_convergence_t  *convergence,
+                  const cs_real_t           *rhs,
+                  cs_real_t                 *restrict vx,
+                  size_t                     aux_size,
+                  void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  residue, sigma = 1.;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict res0, *restrict rk, *restrict pk, *restrict gk;
+  cs_real_t  *restrict yk;
+
+  const int s = _s_step;
+  const int n_b = 4*s + 1;   /* basis size */
+  const int r_s = 2*s + 1;   /* start of R part of basis */
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  const size_t wa_size
+    = CS_SIMD_SIZE(cs_matrix_get_n_columns(a) * diag_block_size);
+
+  {
+    const size_t n_wa = 4 + n_b;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    res0 = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    pk = _aux_vectors + wa_size*2;
+    gk = _aux_vectors + wa_size*3;
+    yk = _aux_vectors + wa_size*4;
+  }
+
+  /* Small dense work arrays: Gram matrix, products with shadow residual,
+     and coordinates in basis */
+
+  double *gram, *s_buf, *g, *p_c, *r_c, *x_c, *q_c, *bp_c, *bq_c;
+  BFT_MALLOC(gram, n_b*n_b, double);
+  BFT_MALLOC(s_buf, n_b*(n_b+1)/2 + n_b, double);
+
+  cs_blas_rsum_t *acc = _rsum_dot_accumulators(c, n_b*(n_b+1)/2 + n_b);
+  BFT_MALLOC(g, 7*n_b, double);
+  p_c = g + n_b;
+  r_c = g + 2*n_b;
+  x_c = g + 3*n_b;
+  q_c = g + 4*n_b;
+  bp_c = g + 5*n_b;
+  bq_c = g + 6*n_b;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    rk[ii] = rhs[ii] - rk[ii];
+    res0[ii] = rk[ii];
+    pk[ii] = rk[ii];
+    yk[ii] = rk[ii];
+  }
+
+  /* First operator application, also used to estimate operator scale */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          gk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, gk, yk + wa_size);
+
+  {
+    double s_rz[2];
+    const cs_real_t *v_rz[2] = {rk, yk + wa_size};
+
+    if (! _dot_products_reproducible(c, 2, v_rz, v_rz, s_rz)) {
+      s_rz[0] = cs_dot_xx(n_rows, rk);
+      s_rz[1] = cs_dot_xx(n_rows, yk + wa_size);
+      _sum_reduce(c, 2, s_rz);
+    }
+
+    residue = sqrt(s_rz[0]);
+    sigma = (s_rz[0] > 0 && s_rz[1] > 0) ? sqrt(s_rz[1] / s_rz[0]) : 1.;
+
+    const double d_sigma = 1. / sigma;
+    cs_real_t *restrict y_1 = yk + wa_size;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y_1[ii] *= d_sigma;
+  }
+
+  c->setup_data->initial_residue = residue;
+
+  cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  bool first_pass = true;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Build basis: Y = [P_0 ... P_2s, R_0 ... R_(2s-1)] */
+
+    if (first_pass)
+      _matrix_powers(c, a, rotation_mode, n_rows, sigma, 2*s - 1,
+                     wa_size, yk + wa_size, gk);
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        yk[ii] = pk[ii];
+      _matrix_powers(c, a, rotation_mode, n_rows, sigma, 2*s,
+                     wa_size, yk, gk);
+    }
+
+    {
+      cs_real_t *restrict y_r = yk + r_s*wa_size;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        y_r[ii] = rk[ii];
+
+      _matrix_powers(c, a, rotation_mode, n_rows, sigma, 2*s - 1,
+                     wa_size, y_r, gk);
+    }
+
+    /* Single fused reduction for Gram matrix and shadow residual products */
+
+    {
+      int n_gram = _local_dot_products(n_rows, n_b, yk, n_b, yk, wa_size,
+                                       s_buf, acc);
+      _local_dot_products(n_rows, n_b, yk, 1, res0, wa_size, s_buf + n_gram,
+                          (acc != NULL) ? acc + n_gram : NULL);
+      _sum_reduce_dots(c, n_gram + n_b, s_buf, acc);
+
+      int k = 0;
+      for (int j = 0; j < n_b; j++) {
+        for (int i = 0; i <= j; i++) {
+          gram[i + j*n_b] = s_buf[k];
+          gram[j + i*n_b] = s_buf[k];
+          k++;
+        }
+      }
+      for (int i = 0; i < n_b; i++)
+        g[i] = s_buf[n_gram + i];
+    }
+
+    /* Convergence test for end of previous outer iteration */
+
+    residue = sqrt(CS_MAX(gram[r_s + r_s*n_b], 0.));
+
+    if (!first_pass) {
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg != CS_SLES_ITERATING)
+        break;
+    }
+    first_pass = false;
+
+    /* Inner iterations on coordinates */
+
+    for (int i = 0; i < n_b; i++) {
+      p_c[i] = 0.;
+      r_c[i] = 0.;
+      x_c[i] = 0.;
+    }
+    p_c[0] = 1.;
+    r_c[r_s] = 1.;
+
+    bool check_residue = false;
+
+    for (int j = 0; j < s; j++) {
+
+      _s_step_basis_shift(s, sigma, p_c, bp_c);
+
+      double g_r = 0., g_bp = 0.;
+      for (int i = 0; i < n_b; i++) {
+        g_r += g[i] * r_c[i];
+        g_bp += g[i] * bp_c[i];
+      }
+
+      if (_breakdown(c, convergence, "rho", g_bp, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      const double alpha = g_r / g_bp;
+
+      for (int i = 0; i < n_b; i++)
+        q_c[i] = r_c[i] - alpha * bp_c[i];
+
+      _s_step_basis_shift(s, sigma, q_c, bq_c);
+
+      const double omega_num = _g_dot(n_b, gram, q_c, bq_c);
+      const double omega_den = _g_dot(n_b, gram, bq_c, bq_c);
+
+      if (_breakdown(c, convergence, "omega", omega_den, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      const double omega = omega_num / omega_den;
+
+      if (_breakdown(c, convergence, "omega", omega, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      for (int i = 0; i < n_b; i++) {
+        x_c[i] += alpha * p_c[i] + omega * q_c[i];
+        q_c[i] -= omega * bq_c[i];      /* new residue coordinates */
+      }
+
+      double g_rn = 0.;
+      for (int i = 0; i < n_b; i++)
+        g_rn += g[i] * q_c[i];
+
+      const double beta = (g_rn / g_r) * (alpha / omega);
+
+      for (int i = 0; i < n_b; i++) {
+        p_c[i] = q_c[i] + beta * (p_c[i] - omega * bp_c[i]);
+        r_c[i] = q_c[i];
+      }
+
+      n_iter += 1;
+
+      /* Residue estimate from Gram matrix */
+
+      double res_est = sqrt(CS_MAX(_g_dot(n_b, gram, r_c, r_c), 0.));
+
+      if (   res_est < convergence->precision * convergence->r_norm
+          || n_iter >= convergence->n_iterations_max) {
+        check_residue = true;
+        break;
+      }
+
+    }
+
+    /* Update solution, residue, and search direction */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      double v_x = 0., v_r = 0., v_p = 0.;
+      for (int k = 0; k < n_b; k++) {
+        const double y_k = yk[k*wa_size + ii];
+        v_x += x_c[k] * y_k;
+        v_r += r_c[k] * y_k;
+        v_p += p_c[k] * y_k;
+      }
+      gk[ii] = v_x;
+      rk[ii] = v_r;
+      pk[ii] = v_p;
+    }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            gk,
+                            yk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] += yk[ii];
+
+    /* Final convergence test if the estimate indicates completion */
+
+    if (check_residue) {
+      residue = sqrt(_dot_product_xx(c, rk));
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+    }
+
+  }
+
+  BFT_FREE(g);
+  BFT_FREE(acc);
+  BFT_FREE(s_buf);
+  BFT_FREE(gram);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
+                            const cs_matrix_t         *a,
+                            int                        diag_block_size,
+                            cs_halo_rotation_t         rotation_mode,
+                            cs_sles_it_convergence_t  *convergence,
+                            const cs_real_t           *rhs,
+                            cs_real_t                 *restrict vx)
+{
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
 
   unsigned n_iter = 0;
 
@@ -3716,6 +4978,9 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_BICGSTAB:
   case CS_SLES_BICGSTAB2:
   case CS_SLES_PCR3:
+  case CS_SLES_PIPELINED_PCG:
+  case CS_SLES_GMRES_S_STEP:
+  case CS_SLES_BICGSTAB_S_STEP:
     c->fallback_cvg = CS_SLES_BREAKDOWN;
     break;
   default:
@@ -3988,6 +5253,25 @@ cs_sles_it_setup(void               *context,
     }
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
+  case CS_SLES_GMRES_S_STEP:
+    if (diag_block_size == 1)
+      c->solve = _gmres_s_step;
+    else
+      bft_error
+        (__FILE__, __LINE__, 0,
+         _("Linear solver \"%s\"\n"
+           "requires a diagonal block size of 1 (%d here)."),
+         _(cs_sles_it_type_name[c->type]), diag_block_size);
+    break;
+
+  case CS_SLES_BICGSTAB_S_STEP:
+    c->solve = _bi_cgstab_s_step;
+    break;
+
   case CS_SLES_FCG:
     c->solve = _flexible_conjugate_gradient;
     break;
@@ -4255,6 +5539,8 @@ cs_sles_it_free(void  *context)
 
   if (c->setup_data != NULL) {
     BFT_FREE(c->setup_data->_ad_inv);
+    BFT_FREE(c->setup_data->color_index);
+    BFT_FREE(c->setup_data->color_rows);
     BFT_FREE(c->setup_data);
   }
 
@@ -4309,6 +5595,80 @@ cs_sles_it_get_last_initial_residue(const cs_sles_it_t  *context)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether a native (face-based) matrix should be used
+ *        directly for the next resolution with an iterative solver,
+ *        rather than a matrix converted to another (MSR or CSR) format.
+ *
+ * With a native matrix, coefficients are used as provided, with no
+ * conversion cost, but each matrix.vector product is more expensive
+ * (using interior face groups for threading). So this is preferred when
+ * the number of matrix.vector products expected based on the previous
+ * resolution is lower than the minimum number of products required to
+ * amortize a coefficients conversion (as defined by
+ * \ref cs_matrix_set_tuning_runs).
+ *
+ * Solvers requiring an MSR matrix (such as Gauss-Seidel variants), or
+ * using a preconditioner other than diagonal or polynomial, always return
+ * false, as does a solver with no previous resolution.
+ *
+ * \param[in]  context  pointer to iterative solver info and context
+ *
+ * \return  true if a native matrix is preferred, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_prefer_native_matrix(const cs_sles_it_t  *context)
+{
+  if (context->n_solves < 1)
+    return false;
+
+  /* Number of products per iteration */
+
+  int n_it_products = 1;
+
+  switch(context->type) {
+  case CS_SLES_BICGSTAB:
+    n_it_products = 2;
+    break;
+  case CS_SLES_BICGSTAB2:
+    n_it_products = 4;
+    break;
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_MC_GAUSS_SEIDEL:
+  case CS_SLES_MC_SYM_GAUSS_SEIDEL:
+    return false;
+  default:
+    break;
+  }
+
+  /* Additional products due to preconditioning */
+
+  const char *pc_type = cs_sles_pc_get_type(context->pc);
+
+  if (strcmp(pc_type, "polynomial_degree_1") == 0)
+    n_it_products *= 2;
+  else if (strcmp(pc_type, "polynomial_degree_2") == 0)
+    n_it_products *= 3;
+  else if (   strcmp(pc_type, "none") != 0
+           && strcmp(pc_type, "jacobi") != 0)
+    return false;
+
+  /* Compare to threshold (including initial residual computation) */
+
+  int n_min_products;
+  cs_matrix_get_tuning_runs(&n_min_products, NULL);
+
+  unsigned n_products = 1 + context->n_iterations_last*n_it_products;
+
+  return (n_products < (unsigned)n_min_products) ? true : false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return a preconditioner context for an iterative sparse linear
@@ -4604,6 +5964,45 @@ cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return number of basis vectors generated per global reduction
+ *        in s-step (communication-avoiding) GMRES and BiCGStab solvers.
+ *
+ * \returns  s-step size
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_s_step(void)
+{
+  return _s_step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set number of basis vectors generated per global reduction
+ *        in s-step (communication-avoiding) GMRES and BiCGStab solvers.
+ *
+ * Larger values reduce the number of global reductions, but the
+ * monomial basis used becomes ill-conditioned quickly, so values
+ * higher than 4 or 5 are not recommended.
+ *
+ * \param[in]  s  s-step size (1 to 8)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_s_step(int  s)
+{
+  if (s < 1 || s > 8)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: s-step size must be in range [1, 8] (%d here)."),
+              __func__, s);
+
+  _s_step = s;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log the current global settings relative to parallelism.
@@ -4618,8 +6017,9 @@ cs_sles_it_log_parallel_options(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("\n"
                     "Iterative linear solvers parallel parameters:\n"
-                    "  PCG single-reduction threshold:     %d\n"),
-                 _pcg_sr_threshold);
+                    "  PCG single-reduction threshold:     %d\n"
+                    "  s-step solvers basis size:          %d\n"),
+                 _pcg_sr_threshold, _s_step);
 #endif
 }
 
@@ -69,12 +69,22 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate
+                                    gradient (single non-blocking
+                                    reduction per iteration) */
+  CS_SLES_GMRES_S_STEP,        /*!< s-step (communication-avoiding)
+                                    preconditioned GMRES */
+  CS_SLES_BICGSTAB_S_STEP,     /*!< s-step (communication-avoiding)
+                                    preconditioned BiCGstab */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
                                     excluding smoother only*/
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_MC_GAUSS_SEIDEL,     /*!< Multicolor Gauss-Seidel smoother */
+  CS_SLES_MC_SYM_GAUSS_SEIDEL, /*!< Multicolor symmetric Gauss-Seidel
+                                    smoother */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -299,6 +309,26 @@ cs_sles_it_get_type(const cs_sles_it_t  *context);
 double
 cs_sles_it_get_last_initial_residue(const cs_sles_it_t  *context);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether a native (face-based) matrix should be used directly
+ * for the next resolution with an iterative solver, rather than a matrix
+ * converted to another (MSR or CSR) format.
+ *
+ * This is the case when the number of matrix.vector products expected
+ * based on the previous resolution is lower than the minimum number of
+ * products required to amortize a coefficients conversion (as defined
+ * by cs_matrix_set_tuning_runs()).
+ *
+ * parameters:
+ *   context <-- pointer to iterative solver info and context
+ *
+ * returns:
+ *   true if a native matrix is preferred, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_prefer_native_matrix(const cs_sles_it_t  *context);
+
 /*----------------------------------------------------------------------------
  * Return a preconditioner context for an iterative sparse linear
  * equation solver.
@@ -480,6 +510,32 @@ cs_sles_it_get_pcg_single_reduction(void);
 void
 cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold);
 
+/*----------------------------------------------------------------------------
+ * Return number of basis vectors generated per global reduction
+ * in s-step (communication-avoiding) GMRES and BiCGStab solvers.
+ *
+ * returns:
+ *   s-step size
+ *----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_s_step(void);
+
+/*----------------------------------------------------------------------------
+ * Set number of basis vectors generated per global reduction
+ * in s-step (communication-avoiding) GMRES and BiCGStab solvers.
+ *
+ * Larger values reduce the number of global reductions, but the
+ * monomial basis used becomes ill-conditioned quickly, so values
+ * higher than 4 or 5 are not recommended.
+ *
+ * parameters:
+ *   s <-- s-step size (1 to 8)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_s_step(int  s);
+
 /*----------------------------------------------------------------------------
  * Log the current global settings relative to parallelism.
  *----------------------------------------------------------------------------*/
@@ -236,6 +236,9 @@ cs_sles_it_setup_priv(cs_sles_it_t       *c,
     sd->_ad_inv = NULL;
     sd->pc_context = NULL;
     sd->pc_apply = NULL;
+    sd->n_colors = 0;
+    sd->color_index = NULL;
+    sd->color_rows = NULL;
   }
 
   sd->n_rows = cs_matrix_get_n_rows(a) * diag_block_size;
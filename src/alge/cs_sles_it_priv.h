@@ -137,6 +137,12 @@ typedef struct _cs_sles_it_setup_t {
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+  int                  n_colors;         /* number of row colors for
+                                            multicolor Gauss-Seidel */
+  cs_lnum_t           *color_index;      /* index of rows per color
+                                            (size: n_colors + 1) */
+  cs_lnum_t           *color_rows;       /* rows for each color */
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -243,6 +249,61 @@ struct _cs_sles_it_convergence_t {
  * Inline static function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute dot products x[i].y[i] with reproducible accumulation,
+ * summing results over all ranks, if the reproducible BLAS reduction mode
+ * is active and the solver is distributed.
+ *
+ * In other cases, nothing is done, and the caller should use the regular
+ * path (which is also reproducible in serial mode).
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   n_dots <-- number of dot products
+ *   x      <-- first vectors of each dot product
+ *   y      <-- second vectors of each dot product
+ *   s      --> resulting dot products
+ *
+ * returns:
+ *   true if the dot products were computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static bool
+_dot_products_reproducible(const cs_sles_it_t  *c,
+                           int                  n_dots,
+                           const cs_real_t     *x[],
+                           const cs_real_t     *y[],
+                           double               s[])
+{
+#if defined(HAVE_MPI)
+
+  if (   c->comm != MPI_COMM_NULL
+      && cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+
+    cs_blas_rsum_t acc[CS_BLAS_RSUM_MAX_DOTS];
+
+    cs_dot_rsum(c->setup_data->n_rows, n_dots, x, y, acc);
+    cs_blas_rsum_allreduce(n_dots, acc, c->comm);
+
+    for (int i = 0; i < n_dots; i++)
+      s[i] = cs_blas_rsum_value(acc + i);
+
+    return true;
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n_dots);
+  CS_UNUSED(x);
+  CS_UNUSED(y);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -260,7 +321,14 @@ _dot_product(const cs_sles_it_t  *c,
              const cs_real_t     *x,
              const cs_real_t     *y)
 {
-  double s = cs_dot(c->setup_data->n_rows, x, y);
+  const cs_real_t *_x[1] = {x}, *_y[1] = {y};
+
+  double s;
+
+  if (_dot_products_reproducible(c, 1, _x, _y, &s))
+    return s;
+
+  s = cs_dot(c->setup_data->n_rows, x, y);
 
 #if defined(HAVE_MPI)
 
@@ -290,8 +358,13 @@ inline static double
 _dot_product_xx(const cs_sles_it_t  *c,
                 const cs_real_t     *x)
 {
+  const cs_real_t *_x[1] = {x};
+
   double s;
 
+  if (_dot_products_reproducible(c, 1, _x, _x, &s))
+    return s;
+
   s = cs_dot_xx(c->setup_data->n_rows, x);
 
 #if defined(HAVE_MPI)
@@ -325,8 +398,16 @@ _dot_products_xx_xy(const cs_sles_it_t  *c,
                     double              *s1,
                     double              *s2)
 {
+  const cs_real_t *_x[2] = {x, x}, *_y[2] = {x, y};
+
   double s[2];
 
+  if (_dot_products_reproducible(c, 2, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   cs_dot_xx_xy(c->setup_data->n_rows, x, y, s, s+1);
 
 #if defined(HAVE_MPI)
@@ -364,8 +445,16 @@ _dot_products_xy_yz(const cs_sles_it_t  *c,
                     double              *s1,
                     double              *s2)
 {
+  const cs_real_t *_x[2] = {x, y}, *_y[2] = {y, z};
+
   double s[2];
 
+  if (_dot_products_reproducible(c, 2, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   cs_dot_xy_yz(c->setup_data->n_rows, x, y, z, s, s+1);
 
 #if defined(HAVE_MPI)
@@ -405,8 +494,17 @@ _dot_products_xx_xy_yz(const cs_sles_it_t  *c,
                        double              *s2,
                        double              *s3)
 {
+  const cs_real_t *_x[3] = {x, x, y}, *_y[3] = {x, y, z};
+
   double s[3];
 
+  if (_dot_products_reproducible(c, 3, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    *s3 = s[2];
+    return;
+  }
+
   cs_dot_xx_xy_yz(c->setup_data->n_rows, x, y, z, s, s+1, s+2);
 
 #if defined(HAVE_MPI)
@@ -453,8 +551,19 @@ _dot_products_xx_yy_xy_xz_yz(const cs_sles_it_t  *c,
                              double              *xz,
                              double              *yz)
 {
+  const cs_real_t *_x[5] = {x, y, x, x, y}, *_y[5] = {x, y, y, z, z};
+
   double s[5];
 
+  if (_dot_products_reproducible(c, 5, _x, _y, s)) {
+    *xx = s[0];
+    *yy = s[1];
+    *xy = s[2];
+    *xz = s[3];
+    *yz = s[4];
+    return;
+  }
+
   cs_dot_xx_yy_xy_xz_yz(c->setup_data->n_rows, x, y, z, s, s+1, s+2, s+3, s+4);
 
 #if defined(HAVE_MPI)
@@ -500,8 +609,18 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
                           double              *s3,
                           double              *s4)
 {
+  const cs_real_t *_x[4] = {v, w, q, r}, *_y[4] = {r, v, v, r};
+
   double s[4];
 
+  if (_dot_products_reproducible(c, 4, _x, _y, s)) {
+    *s1 = s[0];
+    *s2 = s[1];
+    *s3 = s[2];
+    *s4 = s[3];
+    return;
+  }
+
   /* Use two separate call as cs_blas.c does not yet hav matching call */
 
   cs_dot_xy_yz(c->setup_data->n_rows, w, v, q, s+1, s+2);
@@ -523,6 +642,219 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
   *s4 = s[3];
 }
 
+/*----------------------------------------------------------------------------
+ * Update y <- a.x + y and optionally w <- b.z + w, and compute dot
+ * products of updated vectors in a single pass, summing results over
+ * all ranks.
+ *
+ * The fused kernel is selected based on the arguments:
+ *   z == NULL, 1 product:  s = y.y (dx[0] == dy[0]) or s = y.dy[0]
+ *   z != NULL, 1 product:  s = w.w
+ *   z != NULL, 2 products: s[0] = w.w, s[1] = w.dy[1]
+ *
+ * With reproducible parallel sums, fused kernels are not used, and
+ * vector updates are followed by separate dot products.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   a      <-- multiplier for x
+ *   x      <-- vector in y <- a.x + y
+ *   y      <-> vector in y <- a.x + y
+ *   b      <-- multiplier for z
+ *   z      <-- vector in w <- b.z + w, or NULL
+ *   w      <-> vector in w <- b.z + w, or NULL
+ *   n_dots <-- number of dot products
+ *   dx     <-- first vectors of each dot product
+ *   dy     <-- second vectors of each dot product
+ *   s      --> resulting dot products
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_axpy_dots(const cs_sles_it_t  *c,
+           double               a,
+           const cs_real_t     *x,
+           cs_real_t           *y,
+           double               b,
+           const cs_real_t     *z,
+           cs_real_t           *w,
+           int                  n_dots,
+           const cs_real_t     *dx[],
+           const cs_real_t     *dy[],
+           double               s[])
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  /* Fused kernels may not be used with reproducible parallel sums */
+
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_axpy(n_rows, a, x, y);
+    if (z != NULL)
+      cs_axpy(n_rows, b, z, w);
+    if (! _dot_products_reproducible(c, n_dots, dx, dy, s)) {
+      for (int i = 0; i < n_dots; i++)
+        s[i] = (dx[i] == dy[i]) ?
+          cs_dot_xx(n_rows, dx[i]) : cs_dot(n_rows, dx[i], dy[i]);
+    }
+    return;
+  }
+
+  if (z == NULL) {
+    if (dx[0] == dy[0])
+      s[0] = cs_axpy_dot_xx(n_rows, a, x, y);
+    else
+      s[0] = cs_axpy_dot(n_rows, a, x, y, dy[0]);
+  }
+  else if (n_dots == 1)
+    s[0] = cs_axpy2_dot_xx(n_rows, a, x, y, b, z, w);
+  else
+    cs_axpy2_dot_xx_xy(n_rows, a, x, y, b, z, w, dy[1], s, s+1);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    double _sum[2];
+    MPI_Allreduce(s, _sum, n_dots, MPI_DOUBLE, MPI_SUM, c->comm);
+    for (int i = 0; i < n_dots; i++)
+      s[i] = _sum[i];
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Update y <- a.x + y and compute dot product y.z in a single pass,
+ * summing result over all ranks.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   a      <-- multiplier for x
+ *   x      <-- vector in y <- a.x + y
+ *   y      <-> vector in y <- a.x + y and s = y.z
+ *   z      <-- vector in s = y.z
+ *
+ * returns:
+ *   result of s = y.z
+ *----------------------------------------------------------------------------*/
+
+inline static double
+_axpy_dot(const cs_sles_it_t  *c,
+          double               a,
+          const cs_real_t     *x,
+          cs_real_t           *y,
+          const cs_real_t     *z)
+{
+  const cs_real_t *_x[1] = {y}, *_y[1] = {z};
+
+  double s;
+
+  _axpy_dots(c, a, x, y, 0, NULL, NULL, 1, _x, _y, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Update y <- a.x + y and compute dot product y.y in a single pass,
+ * summing result over all ranks.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   a      <-- multiplier for x
+ *   x      <-- vector in y <- a.x + y
+ *   y      <-> vector in y <- a.x + y and s = y.y
+ *
+ * returns:
+ *   result of s = y.y
+ *----------------------------------------------------------------------------*/
+
+inline static double
+_axpy_dot_xx(const cs_sles_it_t  *c,
+             double               a,
+             const cs_real_t     *x,
+             cs_real_t           *y)
+{
+  const cs_real_t *_x[1] = {y};
+
+  double s;
+
+  _axpy_dots(c, a, x, y, 0, NULL, NULL, 1, _x, _x, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Update y <- a.x + y and w <- b.z + w, and compute dot product w.w
+ * in a single pass, summing result over all ranks.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   a      <-- multiplier for x
+ *   x      <-- vector in y <- a.x + y
+ *   y      <-> vector in y <- a.x + y
+ *   b      <-- multiplier for z
+ *   z      <-- vector in w <- b.z + w
+ *   w      <-> vector in w <- b.z + w and s = w.w
+ *
+ * returns:
+ *   result of s = w.w
+ *----------------------------------------------------------------------------*/
+
+inline static double
+_axpy2_dot_xx(const cs_sles_it_t  *c,
+              double               a,
+              const cs_real_t     *x,
+              cs_real_t           *y,
+              double               b,
+              const cs_real_t     *z,
+              cs_real_t           *w)
+{
+  const cs_real_t *_x[1] = {w};
+
+  double s;
+
+  _axpy_dots(c, a, x, y, b, z, w, 1, _x, _x, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Update y <- a.x + y and w <- b.z + w, and compute dot products w.w
+ * and w.v in a single pass, summing result over all ranks.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   a      <-- multiplier for x
+ *   x      <-- vector in y <- a.x + y
+ *   y      <-> vector in y <- a.x + y
+ *   b      <-- multiplier for z
+ *   z      <-- vector in w <- b.z + w
+ *   w      <-> vector in w <- b.z + w, s1 = w.w and s2 = w.v
+ *   v      <-- vector in s2 = w.v
+ *   s1     --> result of s1 = w.w
+ *   s2     --> result of s2 = w.v
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_axpy2_dot_xx_xy(const cs_sles_it_t  *c,
+                 double               a,
+                 const cs_real_t     *x,
+                 cs_real_t           *y,
+                 double               b,
+                 const cs_real_t     *z,
+                 cs_real_t           *w,
+                 const cs_real_t     *v,
+                 double              *s1,
+                 double              *s2)
+{
+  const cs_real_t *_x[2] = {w, w}, *_y[2] = {w, v};
+
+  double s[2];
+
+  _axpy_dots(c, a, x, y, b, z, w, 2, _x, _y, s);
+
+  *s1 = s[0];
+  *s2 = s[1];
+}
+
 /*----------------------------------------------------------------------------
  * Block Jacobi utilities.
  * Compute forward and backward to solve an LU 3*3 system.
@@ -55,6 +55,7 @@
 #include "cs_log.h"
 #include "cs_halo.h"
 #include "cs_map.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
@@ -213,6 +214,8 @@ BEGIN_C_DECLS
   - Jacobi
   - polynomial of degree 1
   - polynomial of degree 2
+  - symmetric Gauss-Seidel
+  - ILU(0)
 
   Polynomial preconditioning is explained here:
   \a D being the diagonal part of matrix \a A and \a X its extra-diagonal
@@ -237,6 +240,26 @@ BEGIN_C_DECLS
   for additional parameter setting functions, only degrees 1
   and 2 are provided here.
 
+  Symmetric Gauss-Seidel and ILU(0) (incomplete LU factorization without
+  fill-in) preconditioners are also provided, for matrices using the
+  MSR storage, with a diagonal block size of 1 or 3. In parallel, they are
+  applied in a block-Jacobi manner, each rank using only its local rows
+  (couplings with ghost cells are ignored). The triangular solves are
+  parallelized with OpenMP using level scheduling: rows are grouped in
+  levels such that rows of a given level only depend on rows of previous
+  levels, so the rows of each level may be processed by separate threads.
+  Results are thus independent of the number of threads.
+
+  Considering the splitting \f$A=L+D+U\f$ of the local part of the matrix,
+  the symmetric Gauss-Seidel preconditioner is
+  \f$M=(D+L)D^{-1}(D+U)\f$. It does not require any specific setup
+  apart from diagonal inversion. The ILU(0) preconditioner is
+  \f$M=\tilde{L}\tilde{U}\f$, where the factors have the same sparsity
+  as \f$A\f$; they are computed (and stored) at setup, so it is more
+  costly in setup time and memory, but usually more efficient.
+  With 3x3 diagonal blocks, the factors use full 3x3 blocks for all
+  entries.
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -296,6 +319,43 @@ typedef struct {
 
 } cs_sles_pc_poly_t;
 
+/* Structure for symmetric Gauss-Seidel or ILU(0) preconditioner */
+/*---------------------------------------------------------------*/
+
+typedef struct {
+
+  int                  ilu_type;          /* 0: symmetric Gauss-Seidel,
+                                             1: ILU(0) */
+  int                  b_size;            /* Diagonal block size (1 or 3) */
+  cs_lnum_t            n_rows;            /* Number of associated rows */
+  cs_lnum_t            n_b_rows;          /* Number of associated block
+                                             rows */
+
+  const cs_matrix_t   *a;                 /* Pointer to associated matrix */
+
+  cs_lnum_t           *row_index;         /* Row index for local columns
+                                             (size: n_b_rows + 1) */
+  cs_lnum_t           *u_index;           /* Start of upper part for each
+                                             row (size: n_b_rows) */
+  cs_lnum_t           *col_id;            /* Local column ids (lower part
+                                             in ascending order first,
+                                             then upper part) */
+
+  cs_real_t           *ad_inv;            /* Inverse of diagonal blocks
+                                             (of U for ILU(0)) */
+  cs_real_t           *x_val;             /* Extra-diagonal blocks: L.D^-1
+                                             and U for symmetric
+                                             Gauss-Seidel, L and U for
+                                             ILU(0) */
+
+  int                  n_levels[2];       /* Number of levels for forward
+                                             and backward substitution */
+  cs_lnum_t           *level_index[2];    /* Levels index (size:
+                                             n_levels + 1) */
+  cs_lnum_t           *level_rows[2];     /* Rows for each level */
+
+} cs_sles_pc_ilu_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -661,6 +721,730 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create a symmetric Gauss-Seidel or ILU(0) preconditioner structure.
+ *
+ * parameters:
+ *   ilu_type <-- 0 for symmetric Gauss-Seidel, 1 for ILU(0)
+ *
+ * returns:
+ *   pointer to newly created preconditioner object.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_ilu_t *
+_sles_pc_ilu_create(int  ilu_type)
+{
+  cs_sles_pc_ilu_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu_t);
+
+  pc->ilu_type = ilu_type;
+  pc->b_size = 1;
+
+  pc->n_rows = 0;
+  pc->n_b_rows = 0;
+
+  pc->a = NULL;
+
+  pc->row_index = NULL;
+  pc->u_index = NULL;
+  pc->col_id = NULL;
+
+  pc->ad_inv = NULL;
+  pc->x_val = NULL;
+
+  for (int i = 0; i < 2; i++) {
+    pc->n_levels[i] = 0;
+    pc->level_index[i] = NULL;
+    pc->level_rows[i] = NULL;
+  }
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of symmetric Gauss-Seidel or ILU(0)
+ * preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu_get_type(const void  *context,
+                      bool         logging)
+{
+  const cs_sles_pc_ilu_t  *c = context;
+
+  assert(c->ilu_type == 0 || c->ilu_type == 1);
+
+  if (logging == false) {
+    static const char *t[] = {"symmetric_gauss_seidel",
+                              "ilu0"};
+    return t[c->ilu_type];
+  }
+  else {
+    static const char *t[] = {N_("symmetric Gauss-Seidel"),
+                              N_("ILU(0)")};
+    return _(t[c->ilu_type]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Invert a diagonal block (of size 1 or 3) in place.
+ *
+ * parameters:
+ *   b_size <-- block size
+ *   a      <-> block to invert
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_ilu_block_inverse(int         b_size,
+                   cs_real_t   a[])
+{
+  if (b_size == 1)
+    a[0] = 1.0 / a[0];
+  else
+    cs_math_33_inv_cramer_in_place((cs_real_t (*)[3])a);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the product of blocks: m = m1.m2, with blocks of size 1 or 3.
+ *
+ * m may not be identical to m1 or m2.
+ *
+ * parameters:
+ *   b_size <-- block size
+ *   m1     <-- first block
+ *   m2     <-- second block
+ *   m      --> product block
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_ilu_block_product(int                        b_size,
+                   const cs_real_t  *restrict m1,
+                   const cs_real_t  *restrict m2,
+                   cs_real_t        *restrict m)
+{
+  for (int ii = 0; ii < b_size; ii++) {
+    for (int jj = 0; jj < b_size; jj++) {
+      cs_real_t s = 0;
+      for (int kk = 0; kk < b_size; kk++)
+        s += m1[ii*b_size + kk] * m2[kk*b_size + jj];
+      m[ii*b_size + jj] = s;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Subtract the product of blocks: m = m - m1.m2, with blocks of size 1 or 3.
+ *
+ * parameters:
+ *   b_size <-- block size
+ *   m1     <-- first block
+ *   m2     <-- second block
+ *   m      <-> updated block
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_ilu_block_product_sub(int                        b_size,
+                       const cs_real_t  *restrict m1,
+                       const cs_real_t  *restrict m2,
+                       cs_real_t        *restrict m)
+{
+  for (int ii = 0; ii < b_size; ii++) {
+    for (int jj = 0; jj < b_size; jj++) {
+      cs_real_t s = 0;
+      for (int kk = 0; kk < b_size; kk++)
+        s += m1[ii*b_size + kk] * m2[kk*b_size + jj];
+      m[ii*b_size + jj] -= s;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build levels for forward or backward substitution.
+ *
+ * Rows of a given level only depend on rows of previous levels, and
+ * appear in increasing order inside a level.
+ *
+ * parameters:
+ *   c   <-> pointer to preconditioner context
+ *   dir <-- 0 for forward, 1 for backward substitution
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu_build_levels(cs_sles_pc_ilu_t  *c,
+                  int                dir)
+{
+  const cs_lnum_t n_b_rows = c->n_b_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+
+  cs_lnum_t *level;
+  BFT_MALLOC(level, n_b_rows, cs_lnum_t);
+
+  cs_lnum_t n_levels = 0;
+
+  if (dir == 0) {
+    for (cs_lnum_t ii = 0; ii < n_b_rows; ii++) {
+      cs_lnum_t l = 0;
+      for (cs_lnum_t jj = row_index[ii]; jj < u_index[ii]; jj++)
+        l = CS_MAX(l, level[col_id[jj]] + 1);
+      level[ii] = l;
+      n_levels = CS_MAX(n_levels, l + 1);
+    }
+  }
+  else {
+    for (cs_lnum_t ii = n_b_rows - 1; ii > -1; ii--) {
+      cs_lnum_t l = 0;
+      for (cs_lnum_t jj = u_index[ii]; jj < row_index[ii+1]; jj++)
+        l = CS_MAX(l, level[col_id[jj]] + 1);
+      level[ii] = l;
+      n_levels = CS_MAX(n_levels, l + 1);
+    }
+  }
+
+  /* Build index and rows list (counting sort) */
+
+  c->n_levels[dir] = n_levels;
+
+  BFT_REALLOC(c->level_index[dir], n_levels + 1, cs_lnum_t);
+  BFT_REALLOC(c->level_rows[dir], n_b_rows, cs_lnum_t);
+
+  cs_lnum_t *l_index = c->level_index[dir];
+  cs_lnum_t *l_rows = c->level_rows[dir];
+
+  for (cs_lnum_t l = 0; l < n_levels + 1; l++)
+    l_index[l] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_b_rows; ii++)
+    l_index[level[ii] + 1] += 1;
+
+  for (cs_lnum_t l = 0; l < n_levels; l++)
+    l_index[l+1] += l_index[l];
+
+  for (cs_lnum_t ii = 0; ii < n_b_rows; ii++) {
+    cs_lnum_t l = level[ii];
+    l_rows[l_index[l]] = ii;
+    l_index[l] += 1;
+  }
+
+  for (cs_lnum_t l = n_levels; l > 0; l--)
+    l_index[l] = l_index[l-1];
+  l_index[0] = 0;
+
+  BFT_FREE(level);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute ILU(0) factorization.
+ *
+ * On input, ad_inv contains the diagonal blocks, and x_val the
+ * extra-diagonal blocks of the local matrix. On output, ad_inv contains the
+ * inverse of the diagonal blocks of U, and x_val the extra-diagonal blocks
+ * of L (with a unit diagonal) and U.
+ *
+ * Rows are handled using the forward substitution levels, as a row
+ * only depends on (already factored) rows of its lower part.
+ *
+ * parameters:
+ *   c <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu_factorize(cs_sles_pc_ilu_t  *c)
+{
+  const int b_size = c->b_size;
+  const int b_size_2 = b_size*b_size;
+  const cs_lnum_t n_b_rows = c->n_b_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict level_index = c->level_index[0];
+  const cs_lnum_t *restrict level_rows = c->level_rows[0];
+
+  cs_real_t *restrict ad_inv = c->ad_inv;
+  cs_real_t *restrict x_val = c->x_val;
+
+# pragma omp parallel if(n_b_rows > CS_THR_MIN)
+  {
+    cs_lnum_t *marker;
+    BFT_MALLOC(marker, n_b_rows, cs_lnum_t);
+
+    for (cs_lnum_t ii = 0; ii < n_b_rows; ii++)
+      marker[ii] = -1;
+
+    for (int l = 0; l < c->n_levels[0]; l++) {
+
+#     pragma omp for
+      for (cs_lnum_t ll = level_index[l]; ll < level_index[l+1]; ll++) {
+
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t l_ik[9];
+
+        for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+          marker[col_id[jj]] = jj;
+
+        /* Lower part, in increasing column order */
+
+        for (cs_lnum_t kk = row_index[ii]; kk < u_index[ii]; kk++) {
+
+          const cs_lnum_t k = col_id[kk];
+
+          _ilu_block_product(b_size,
+                             x_val + kk*b_size_2,
+                             ad_inv + k*b_size_2,
+                             l_ik);
+          for (int m = 0; m < b_size_2; m++)
+            x_val[kk*b_size_2 + m] = l_ik[m];
+
+          for (cs_lnum_t jj = u_index[k]; jj < row_index[k+1]; jj++) {
+            const cs_lnum_t j = col_id[jj];
+            if (j == ii)
+              _ilu_block_product_sub(b_size,
+                                     l_ik,
+                                     x_val + jj*b_size_2,
+                                     ad_inv + ii*b_size_2);
+            else if (marker[j] > -1)
+              _ilu_block_product_sub(b_size,
+                                     l_ik,
+                                     x_val + jj*b_size_2,
+                                     x_val + marker[j]*b_size_2);
+          }
+
+        }
+
+        _ilu_block_inverse(b_size, ad_inv + ii*b_size_2);
+
+        for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+          marker[col_id[jj]] = -1;
+
+      }
+
+    }
+
+    BFT_FREE(marker);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of a symmetric Gauss-Seidel or ILU(0) preconditioner.
+ *
+ * Only local columns of the matrix are used, so in parallel, this
+ * amounts to a block-Jacobi preconditioner, with one block per rank.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   int                 verbosity)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
+
+  cs_matrix_type_t m_type = cs_matrix_get_type(a);
+
+  if (   m_type != CS_MATRIX_MSR && m_type != CS_MATRIX_SELL
+      && m_type != CS_MATRIX_BSR)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s preconditioner for system \"%s\" requires a matrix\n"
+                "using MSR storage, and not %s storage."),
+              _sles_pc_ilu_get_type(c, true), name,
+              cs_matrix_type_name[m_type]);
+
+  if (   (db_size[0] != 1 && db_size[0] != 3)
+      || (eb_size[0] != 1 && eb_size[0] != db_size[0]))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s preconditioner for system \"%s\" is not available\n"
+                "for diagonal and extra-diagonal block sizes %d and %d."),
+              _sles_pc_ilu_get_type(c, true), name,
+              db_size[0], eb_size[0]);
+
+  const cs_lnum_t *a_row_index, *a_col_id;
+  const cs_real_t *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, &a_x_val);
+
+  const cs_real_t *a_d_val = cs_matrix_get_diagonal(a);
+
+  const int b_size = db_size[0];
+  const int b_size_2 = b_size*b_size;
+  const cs_lnum_t n_b_rows = cs_matrix_get_n_rows(a);
+
+  c->a = a;
+  c->b_size = b_size;
+  c->n_b_rows = n_b_rows;
+  c->n_rows = n_b_rows*b_size;
+
+  /* Build local structure, with lower part first (MSR column ids
+     are sorted for each row, so the lower part is in increasing
+     column order), ignoring ghost columns */
+
+  BFT_REALLOC(c->row_index, n_b_rows + 1, cs_lnum_t);
+  BFT_REALLOC(c->u_index, n_b_rows, cs_lnum_t);
+
+  cs_lnum_t *restrict row_index = c->row_index;
+  cs_lnum_t *restrict u_index = c->u_index;
+
+  row_index[0] = 0;
+  for (cs_lnum_t ii = 0; ii < n_b_rows; ii++) {
+    cs_lnum_t n_l = 0, n_u = 0;
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      if (a_col_id[jj] < ii)
+        n_l++;
+      else if (a_col_id[jj] > ii && a_col_id[jj] < n_b_rows)
+        n_u++;
+    }
+    u_index[ii] = row_index[ii] + n_l;
+    row_index[ii+1] = u_index[ii] + n_u;
+  }
+
+  const cs_lnum_t nnz = row_index[n_b_rows];
+
+  BFT_REALLOC(c->col_id, nnz, cs_lnum_t);
+  BFT_REALLOC(c->x_val, nnz*b_size_2, cs_real_t);
+  BFT_REALLOC(c->ad_inv, n_b_rows*b_size_2, cs_real_t);
+
+  cs_lnum_t *restrict col_id = c->col_id;
+  cs_real_t *restrict x_val = c->x_val;
+  cs_real_t *restrict ad_inv = c->ad_inv;
+
+# pragma omp parallel for if(n_b_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_b_rows; ii++) {
+
+    cs_lnum_t l_id = row_index[ii], u_id = u_index[ii];
+
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      cs_lnum_t j = a_col_id[jj];
+      cs_lnum_t k;
+      if (j < ii)
+        k = l_id++;
+      else if (j > ii && j < n_b_rows)
+        k = u_id++;
+      else
+        continue;
+      col_id[k] = j;
+      cs_real_t *restrict _x_val = x_val + k*b_size_2;
+      if (eb_size[0] == 1) {
+        for (int m = 0; m < b_size_2; m++)
+          _x_val[m] = 0;
+        for (int m = 0; m < b_size; m++)
+          _x_val[m*b_size + m] = a_x_val[jj];
+      }
+      else {
+        for (int m = 0; m < b_size; m++) {
+          for (int n = 0; n < b_size; n++)
+            _x_val[m*b_size + n]
+              = a_x_val[jj*eb_size[3] + m*eb_size[2] + n];
+        }
+      }
+    }
+
+    for (int m = 0; m < b_size; m++) {
+      for (int n = 0; n < b_size; n++)
+        ad_inv[ii*b_size_2 + m*b_size + n]
+          = a_d_val[ii*db_size[3] + m*db_size[2] + n];
+    }
+
+  }
+
+  /* Substitution levels */
+
+  _ilu_build_levels(c, 0);
+  _ilu_build_levels(c, 1);
+
+  /* Factorization */
+
+  if (c->ilu_type == 1)
+    _ilu_factorize(c);
+
+  else {
+
+    /* Symmetric Gauss-Seidel: M = (D+L).D^-1.(D+U) = (I + L.D^-1).(D+U),
+       so L.D^-1 is stored instead of L */
+
+#   pragma omp parallel for if(n_b_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_rows; ii++)
+      _ilu_block_inverse(b_size, ad_inv + ii*b_size_2);
+
+#   pragma omp parallel for if(n_b_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_rows; ii++) {
+      cs_real_t l_ik[9];
+      for (cs_lnum_t kk = row_index[ii]; kk < u_index[ii]; kk++) {
+        _ilu_block_product(b_size,
+                           x_val + kk*b_size_2,
+                           ad_inv + col_id[kk]*b_size_2,
+                           l_ik);
+        for (int m = 0; m < b_size_2; m++)
+          x_val[kk*b_size_2 + m] = l_ik[m];
+      }
+    }
+
+  }
+
+  if (verbosity > 1)
+    bft_printf(_("  %s preconditioner for \"%s\":\n"
+                 "    forward substitution levels:  %d\n"
+                 "    backward substitution levels: %d\n"),
+               _sles_pc_ilu_get_type(c, true), name,
+               c->n_levels[0], c->n_levels[1]);
+}
+
+/*----------------------------------------------------------------------------
+ * Forward and backward substitution for a symmetric Gauss-Seidel or
+ * ILU(0) preconditioner, with a diagonal block size of 1.
+ *
+ * parameters:
+ *   c <-- pointer to preconditioner context
+ *   x <-> input/output vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu_fw_and_bw(const cs_sles_pc_ilu_t  *c,
+               cs_real_t               *restrict x)
+{
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_real_t *restrict ad_inv = c->ad_inv;
+  const cs_real_t *restrict x_val = c->x_val;
+
+# pragma omp parallel if(c->n_b_rows > CS_THR_MIN)
+  {
+    /* Forward substitution: (I + L).y = x */
+
+    const cs_lnum_t *restrict level_index = c->level_index[0];
+    const cs_lnum_t *restrict level_rows = c->level_rows[0];
+
+    for (int l = 0; l < c->n_levels[0]; l++) {
+#     pragma omp for
+      for (cs_lnum_t ll = level_index[l]; ll < level_index[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s = x[ii];
+        for (cs_lnum_t jj = row_index[ii]; jj < u_index[ii]; jj++)
+          s -= x_val[jj] * x[col_id[jj]];
+        x[ii] = s;
+      }
+    }
+
+    /* Backward substitution: (D + U).x = y */
+
+    level_index = c->level_index[1];
+    level_rows = c->level_rows[1];
+
+    for (int l = 0; l < c->n_levels[1]; l++) {
+#     pragma omp for
+      for (cs_lnum_t ll = level_index[l]; ll < level_index[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s = x[ii];
+        for (cs_lnum_t jj = u_index[ii]; jj < row_index[ii+1]; jj++)
+          s -= x_val[jj] * x[col_id[jj]];
+        x[ii] = s * ad_inv[ii];
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Forward and backward substitution for a symmetric Gauss-Seidel or
+ * ILU(0) preconditioner, with a diagonal block size of 3.
+ *
+ * parameters:
+ *   c <-- pointer to preconditioner context
+ *   x <-> input/output vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu_fw_and_bw_33(const cs_sles_pc_ilu_t  *c,
+                  cs_real_t               *restrict x)
+{
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_real_t *restrict ad_inv = c->ad_inv;
+  const cs_real_t *restrict x_val = c->x_val;
+
+# pragma omp parallel if(c->n_b_rows > CS_THR_MIN)
+  {
+    /* Forward substitution: (I + L).y = x */
+
+    const cs_lnum_t *restrict level_index = c->level_index[0];
+    const cs_lnum_t *restrict level_rows = c->level_rows[0];
+
+    for (int l = 0; l < c->n_levels[0]; l++) {
+#     pragma omp for
+      for (cs_lnum_t ll = level_index[l]; ll < level_index[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s[3] = {x[ii*3], x[ii*3+1], x[ii*3+2]};
+        for (cs_lnum_t jj = row_index[ii]; jj < u_index[ii]; jj++) {
+          const cs_real_t *restrict m = x_val + jj*9;
+          const cs_real_t *restrict _x = x + col_id[jj]*3;
+          s[0] -= m[0]*_x[0] + m[1]*_x[1] + m[2]*_x[2];
+          s[1] -= m[3]*_x[0] + m[4]*_x[1] + m[5]*_x[2];
+          s[2] -= m[6]*_x[0] + m[7]*_x[1] + m[8]*_x[2];
+        }
+        x[ii*3]   = s[0];
+        x[ii*3+1] = s[1];
+        x[ii*3+2] = s[2];
+      }
+    }
+
+    /* Backward substitution: (D + U).x = y */
+
+    level_index = c->level_index[1];
+    level_rows = c->level_rows[1];
+
+    for (int l = 0; l < c->n_levels[1]; l++) {
+#     pragma omp for
+      for (cs_lnum_t ll = level_index[l]; ll < level_index[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s[3] = {x[ii*3], x[ii*3+1], x[ii*3+2]};
+        for (cs_lnum_t jj = u_index[ii]; jj < row_index[ii+1]; jj++) {
+          const cs_real_t *restrict m = x_val + jj*9;
+          const cs_real_t *restrict _x = x + col_id[jj]*3;
+          s[0] -= m[0]*_x[0] + m[1]*_x[1] + m[2]*_x[2];
+          s[1] -= m[3]*_x[0] + m[4]*_x[1] + m[5]*_x[2];
+          s[2] -= m[6]*_x[0] + m[7]*_x[1] + m[8]*_x[2];
+        }
+        const cs_real_t *restrict d = ad_inv + ii*9;
+        x[ii*3]   = d[0]*s[0] + d[1]*s[1] + d[2]*s[2];
+        x[ii*3+1] = d[3]*s[0] + d[4]*s[1] + d[5]*s[2];
+        x[ii*3+2] = d[6]*s[0] + d[7]*s[1] + d[8]*s[2];
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of a symmetric Gauss-Seidel or ILU(0)
+ * preconditioner.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu_apply(void                *context,
+                   cs_halo_rotation_t   rotation_mode,
+                   const cs_real_t     *x_in,
+                   cs_real_t           *x_out)
+{
+  CS_UNUSED(rotation_mode);
+
+  cs_sles_pc_ilu_t  *c = context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+
+  /* Substitutions may be done in place, as each row only depends
+     on rows of previous levels */
+
+  if (x_in != NULL) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      x_out[ii] = x_in[ii];
+  }
+
+  if (c->b_size == 3)
+    _ilu_fw_and_bw_33(c, x_out);
+  else
+    _ilu_fw_and_bw(c, x_out);
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of a symmetric Gauss-Seidel or ILU(0)
+ * preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_free(void  *context)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  c->n_rows = 0;
+  c->n_b_rows = 0;
+
+  c->a = NULL;
+
+  BFT_FREE(c->row_index);
+  BFT_FREE(c->u_index);
+  BFT_FREE(c->col_id);
+
+  BFT_FREE(c->ad_inv);
+  BFT_FREE(c->x_val);
+
+  for (int i = 0; i < 2; i++) {
+    c->n_levels[i] = 0;
+    BFT_FREE(c->level_index[i]);
+    BFT_FREE(c->level_rows[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of a symmetric Gauss-Seidel or ILU(0)
+ * preconditioner context based on the copy of another.
+ *
+ * The new context copies the settings of the copied context, but not
+ * its setup data and logged info, such as performance data.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu_clone(const void  *context)
+{
+  const cs_sles_pc_ilu_t *c = (const cs_sles_pc_ilu_t *)context;
+
+  return _sles_pc_ilu_create(c->ilu_type);
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of a symmetric Gauss-Seidel or ILU(0)
+ * preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_destroy (void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_ilu_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1123,6 +1907,66 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a symmetric Gauss-Seidel preconditioner.
+ *
+ * This preconditioner requires a matrix using the MSR storage, with
+ * a diagonal block size of 1 or 3. In parallel, couplings with ghost
+ * cells are ignored (block-Jacobi type application).
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_sgs_create(void)
+{
+  cs_sles_pc_ilu_t *pci = _sles_pc_ilu_create(0);
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * This preconditioner requires a matrix using the MSR storage, with
+ * a diagonal block size of 1 or 3. In parallel, couplings with ghost
+ * cells are ignored (block-Jacobi type application).
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu_t *pci = _sles_pc_ilu_create(1);
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
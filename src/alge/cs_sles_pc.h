@@ -508,6 +508,34 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a symmetric Gauss-Seidel preconditioner.
+ *
+ * This preconditioner requires a matrix using the MSR storage, with
+ * a diagonal block size of 1 or 3.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_sgs_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * This preconditioner requires a matrix using the MSR storage, with
+ * a diagonal block size of 1 or 3.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -58,6 +58,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -139,6 +143,9 @@ typedef struct {
   const char     *type_name;      /* Pointer to type field in section header */
   void           *data;           /* Pointer to data in section header */
 
+  size_t          z_size;         /* Size of compressed body, or 0 */
+  unsigned char  *z_data;         /* Decompressed body values */
+
   long long       offset;         /* Current position in file */
   int             swap_endian;    /* Swap big-endian and little-endian ? */
 
@@ -656,6 +663,9 @@ _open_input(const char  *filename,
   inp.type_name = NULL;
   inp.data = NULL;
 
+  inp.z_size = 0;
+  inp.z_data = NULL;
+
   inp.offset = 0;
   inp.swap_endian = 0;
 
@@ -755,6 +765,7 @@ _close_input(_cs_io_t  *inp,
     inp->buffer_size = 0;
     inp->filename = NULL;
     MEM_FREE(inp->buffer);
+    MEM_FREE(inp->z_data);
   }
 }
 
@@ -1178,6 +1189,125 @@ _type_size_from_name(const char  *type_name)
   return type_size;
 }
 
+/*----------------------------------------------------------------------------
+ * Read and decompress a compressed section body.
+ *
+ * The body contains the body size and number of chunks, followed by the
+ * number of values, compressed size, and codec id of each chunk, then by
+ * the compressed chunks. Decompressed values are pointed to by inp->data,
+ * as if embedded in the header.
+ *
+ * parameters:
+ *   inp <-> pointer to input object
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_compressed_body(_cs_io_t  *inp)
+{
+  size_t k;
+  size_t z_head[2];
+  size_t n_chunks = 0, max_z_size = 0, s_id = 0;
+  size_t *z_table = NULL;
+  unsigned char *z_buf = NULL, *tmp = NULL;
+  unsigned char header_buf[16];
+
+  const size_t type_size = inp->type_size;
+
+  /* Position read pointer and read chunk table */
+
+  long long offset = _file_tell(inp);
+  size_t ba = inp->body_align;
+  offset += (ba - (offset % ba)) % ba;
+  _file_seek(inp, offset, SEEK_SET);
+
+  _file_read(header_buf, 8, 2, inp);
+  _convert_size(header_buf, z_head, 2);
+
+  n_chunks = z_head[1];
+
+  MEM_MALLOC(z_buf, n_chunks*24, unsigned char);
+  MEM_MALLOC(z_table, n_chunks*3, size_t);
+
+  _file_read(z_buf, 8, n_chunks*3, inp);
+  _convert_size(z_buf, z_table, n_chunks*3);
+
+  MEM_FREE(z_buf);
+
+  for (k = 0; k < n_chunks; k++) {
+    if (z_table[k*3 + 1] > max_z_size)
+      max_z_size = z_table[k*3 + 1];
+    s_id += z_table[k*3];
+  }
+
+  if (s_id != inp->n_vals)
+    _error(__FILE__, __LINE__, 0,
+           _("Compressed section \"%s\" of file \"%s\" is corrupted."),
+           inp->name, inp->filename);
+
+  /* Read and decompress chunks */
+
+  MEM_REALLOC(inp->z_data, inp->n_vals*type_size, unsigned char);
+  MEM_MALLOC(z_buf, max_z_size, unsigned char);
+
+  s_id = 0;
+
+  for (k = 0; k < n_chunks; k++) {
+
+    size_t n_c_vals = z_table[k*3];
+    size_t size = n_c_vals*type_size;
+    unsigned char *dest = inp->z_data + s_id*type_size;
+    int errcode = 0;
+
+    _file_read(z_buf, 1, z_table[k*3 + 1], inp);
+
+    if (z_table[k*3 + 2] == 0) {
+      if (z_table[k*3 + 1] == size)
+        memcpy(dest, z_buf, size);
+      else
+        errcode = 1;
+    }
+
+#if defined(HAVE_ZLIB)
+
+    else if (z_table[k*3 + 2] == 1) {
+      size_t i, j;
+      uLongf d_size = size;
+      MEM_REALLOC(tmp, size, unsigned char);
+      if (   uncompress(tmp, &d_size, z_buf, z_table[k*3 + 1]) == Z_OK
+          && d_size == size) {
+        for (j = 0; j < type_size; j++) {
+          for (i = 0; i < n_c_vals; i++)
+            dest[i*type_size + j] = tmp[j*n_c_vals + i];
+        }
+      }
+      else
+        errcode = 1;
+    }
+
+#endif
+
+    else
+      errcode = 1;
+
+    if (errcode != 0)
+      _error(__FILE__, __LINE__, 0,
+             _("Error decompressing section \"%s\" of file \"%s\"\n"
+               "(corrupted data or codec %d not available)."),
+             inp->name, inp->filename, (int)(z_table[k*3 + 2]));
+
+    s_id += n_c_vals;
+  }
+
+  MEM_FREE(tmp);
+  MEM_FREE(z_buf);
+  MEM_FREE(z_table);
+
+  inp->z_size = z_head[0];
+  inp->data = inp->z_data;
+
+  _file_seek(inp, offset + z_head[0], SEEK_SET);
+}
+
 /*----------------------------------------------------------------------------
  * Read section header.
  *
@@ -1244,6 +1374,7 @@ _read_section_header(_cs_io_t  *inp)
   inp->n_loc_vals = header_vals[4];
   inp->type_size = 0;
   inp->data = NULL;
+  inp->z_size = 0;
   inp->type_name = (char *)(inp->buffer + 48);
   inp->name = (char *)(inp->buffer + 56);
 
@@ -1256,6 +1387,13 @@ _read_section_header(_cs_io_t  *inp)
 
     inp->type_size = _type_size_from_name(inp->type_name);
 
+    /* Compressed values are handled as if embedded in header */
+
+    if (inp->data == NULL && inp->type_name[2] == 'z') {
+      inp->buffer[48 + 2] = '\0';
+      _read_compressed_body(inp);
+    }
+
     if (inp->data == NULL)
       body_size = inp->type_size*inp->n_vals;
 
@@ -1288,7 +1426,10 @@ _read_section_values(_cs_io_t    *inp,
 
   assert(inp->n_vals > 0);
 
-  if (inp->data != NULL)
+  if (inp->z_size > 0)
+    printf(_("      Compressed body:     %lu bytes\n"),
+           (unsigned long)(inp->z_size));
+  else if (inp->data != NULL)
     printf(_("      Values in header\n"));
 
   /* Compute number of values to skip */
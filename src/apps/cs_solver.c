@@ -59,6 +59,7 @@
 #include "cs_fan.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
+#include "cs_field_operator.h"
 #include "cs_file.h"
 #include "cs_fp_exception.h"
 #include "cs_gradient.h"
@@ -467,6 +468,7 @@ cs_run(void)
 
     cs_gradient_perio_finalize();
     cs_gradient_finalize();
+    cs_field_gradient_cache_finalize();
 
     /* Finalize synthetic inlet condition generation */
 
@@ -489,6 +491,10 @@ cs_run(void)
   bft_printf(_("\n Destroying structures and ending computation\n"));
   bft_printf_flush();
 
+  /* Complete pending asynchronous checkpoint writes */
+
+  cs_restart_checkpoint_wait();
+
   /* Final stage for CDO/HHO schemes */
 
   cs_cdo_finalize(cs_glob_domain);
@@ -196,6 +196,8 @@ endif
 
 call log_iteration_clipping_field(iflid, iclmin(1), iclmax(1), vmin, vmax, iclmin(1), iclmax(1))
 
+call field_update_state(iflid)
+
 !--------
 ! Formats
 !--------
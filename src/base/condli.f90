@@ -3458,7 +3458,15 @@ deallocate(velipb)
 if (associated(rijipb)) deallocate(rijipb)
 
 !===============================================================================
-! 16. Update of boundary temperature when saved and not a variable.
+! 16. Mark boundary condition coefficients of variables as modified
+!===============================================================================
+
+do ivar = 1, nvar
+  call field_update_bc_state(ivarfl(ivar))
+enddo
+
+!===============================================================================
+! 17. Update of boundary temperature when saved and not a variable.
 !===============================================================================
 
 if (itherm.eq.2 .and. itempb.ge.0) then
@@ -3500,7 +3508,7 @@ if (itherm.eq.2 .and. itempb.ge.0) then
 endif
 
 !===============================================================================
-! 17. Formats
+! 18. Formats
 !===============================================================================
 
 #if defined(_CS_LANG_FR)
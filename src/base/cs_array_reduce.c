@@ -44,6 +44,8 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_blas.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -2808,7 +2810,9 @@ _cs_real_sstats_nd_w(cs_lnum_t         n,
  * are also computed, and added at the end of the statistics arrays
  * (which must be size dim+1).
  *
- * The algorithm here is similar to that used for BLAS.
+ * The algorithm here is similar to that used for BLAS; when the
+ * reproducible BLAS reduction mode is active, the result does not depend
+ * on the number of threads.
  *
  * \param[in]   n_elts      number of local elements
  * \param[in]   dim         local array dimension (max: 9)
@@ -2829,8 +2833,12 @@ cs_array_reduce_sum_l(cs_lnum_t         n_elts,
   /* If all values are defined on same list */
 
   if (v_elt_list == NULL) {
-    if (dim == 1)
-      vsum[0] = _cs_real_sum_1d(n_elts, v);
+    if (dim == 1) {
+      if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE)
+        vsum[0] = cs_sum(n_elts, v);
+      else
+        vsum[0] = _cs_real_sum_1d(n_elts, v);
+    }
     else if (dim == 3)
       bft_error(__FILE__, __LINE__, 0,
                 _("_cs_real_sum_3d not implemented yet\n"));
@@ -293,6 +293,14 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       conv_diff_mg = true;
   }
 
+  /* Determine if the matrix may be built in the same face loops as the
+     implicit part of the right hand side (unsteady non-symmetric case) */
+
+  bool fused_matrix = false;
+  if (   !conv_diff_mg && iconvp > 0 && imucpp == 0 && idtvar >= 0
+      && f_id > -1 && (var_cal_opt->idften & CS_ISOTROPIC_DIFFUSION))
+    fused_matrix = true;
+
   /* Allocate temporary arrays */
 
   BFT_MALLOC(dam, n_cells_ext, cs_real_t);
@@ -403,7 +411,7 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                        dam_diff,
                                        xam_diff);
   }
-  else {
+  else if (!fused_matrix) {
     cs_matrix_wrapper_scalar(iconvp,
                              idiffp,
                              ndircp,
@@ -528,30 +536,70 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
      has to impose 1 on mass accumulation. */
   imasac = 1;
 
-  cs_balance_scalar(idtvar,
-                    f_id,
-                    imucpp,
-                    imasac,
-                    inc,
-                    iccocg,
-                    var_cal_opt,
-                    pvar,
-                    pvara,
-                    coefap,
-                    coefbp,
-                    cofafp,
-                    cofbfp,
-                    i_massflux,
-                    b_massflux,
-                    i_visc,
-                    b_visc,
-                    viscel,
-                    xcpp,
-                    weighf,
-                    weighb,
-                    icvflb,
-                    icvfli,
-                    smbrp);
+  /* The matrix is built in the same face traversals as the balance
+     when possible; the convection-diffusion operator falls back to
+     the separate matrix building otherwise. */
+
+  if (fused_matrix) {
+    cs_var_cal_opt_t var_cal_opt_loc;
+    f = cs_field_by_id(f_id);
+    cs_field_get_key_struct(f, cs_field_key_id("var_cal_opt"),
+                            &var_cal_opt_loc);
+    var_cal_opt_loc.thetav = thetap;
+
+    cs_convection_diffusion_scalar_matrix(idtvar,
+                                          f_id,
+                                          var_cal_opt_loc,
+                                          icvflb,
+                                          inc,
+                                          iccocg,
+                                          imasac,
+                                          pvar,
+                                          pvara,
+                                          icvfli,
+                                          coefap,
+                                          coefbp,
+                                          cofafp,
+                                          cofbfp,
+                                          i_massflux,
+                                          b_massflux,
+                                          i_visc,
+                                          b_visc,
+                                          smbrp,
+                                          thetap,
+                                          rovsdt,
+                                          i_viscm,
+                                          b_viscm,
+                                          dam,
+                                          (cs_real_2_t *)xam);
+
+    cs_matrix_scalar_penalize_diag(ndircp, dam);
+  }
+  else
+    cs_balance_scalar(idtvar,
+                      f_id,
+                      imucpp,
+                      imasac,
+                      inc,
+                      iccocg,
+                      var_cal_opt,
+                      pvar,
+                      pvara,
+                      coefap,
+                      coefbp,
+                      cofafp,
+                      cofbfp,
+                      i_massflux,
+                      b_massflux,
+                      i_visc,
+                      b_visc,
+                      viscel,
+                      xcpp,
+                      weighf,
+                      weighb,
+                      icvflb,
+                      icvfli,
+                      smbrp);
 
   if (iswdyp >= 1) {
 #   pragma omp parallel for
@@ -1067,6 +1115,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   cs_sles_free_native(f_id, var_name);
 
+  /* Solved field values were updated */
+  if (f_id > -1)
+    cs_field_update_state(cs_field_by_id(f_id));
+
   /*  Free memory */
   BFT_FREE(dam);
   BFT_FREE(xam);
@@ -1927,6 +1979,10 @@ cs_equation_iterative_solve_vector(int                   idtvar,
 
   cs_sles_free_native(f_id, var_name);
 
+  /* Solved field values were updated */
+  if (f_id > -1)
+    cs_field_update_state(cs_field_by_id(f_id));
+
   /* Free memory */
   BFT_FREE(dam);
   BFT_FREE(xam);
@@ -2689,6 +2745,10 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
 
   cs_sles_free_native(f_id, var_name);
 
+  /* Solved field values were updated */
+  if (f_id > -1)
+    cs_field_update_state(cs_field_by_id(f_id));
+
   /* Free memory */
   BFT_FREE(dam);
   BFT_FREE(xam);
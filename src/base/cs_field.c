@@ -92,6 +92,9 @@ BEGIN_C_DECLS
        Explicit coefficient for convection
   \var cs_field_bc_coeffs_t::bc
        Implicit coefficient for convection
+  \var cs_field_bc_coeffs_t::state_id
+       Coefficients modification counter, incremented by functions modifying
+       coefficients, or explicitly using \ref cs_field_update_bc_state
 
   \struct cs_field_t
 
@@ -127,6 +130,9 @@ BEGIN_C_DECLS
         Boundary condition coefficients, for variable type fields
   \var  cs_field_t::is_owner
         Ownership flag for values
+  \var  cs_field_t::state_id
+        Values modification counter, incremented by functions modifying
+        values, or explicitly using \ref cs_field_update_state
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -506,6 +512,8 @@ _field_create(const char   *name,
 
   f->is_owner = true;
 
+  f->state_id = 0;
+
   /* Mark key values as not set */
 
   for (key_id = 0; key_id < _n_keys_max; key_id++) {
@@ -1720,6 +1728,8 @@ cs_field_allocate_values(cs_field_t  *f)
     if (f->n_time_vals > 1)
       f->val_pre = f->vals[1];
   }
+
+  f->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1756,6 +1766,8 @@ cs_field_map_values(cs_field_t   *f,
     f->val_pre = val_pre;
     f->vals[1] = val_pre;
   }
+
+  f->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1860,6 +1872,8 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
         f->bc_coeffs->hext = NULL;
       }
 
+      f->bc_coeffs->state_id = 0;
+
     }
 
     else {
@@ -1903,6 +1917,8 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
         BFT_FREE(f->bc_coeffs->hext);
       }
 
+      f->bc_coeffs->state_id += 1;
+
     }
 
   }
@@ -2111,6 +2127,8 @@ cs_field_init_bc_coeffs(cs_field_t  *f)
       }
     }
 
+    f->bc_coeffs->state_id += 1;
+
   }
 
   else
@@ -2143,6 +2161,8 @@ cs_field_set_values(cs_field_t  *f,
 # pragma omp parallel for if (_n_vals > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
     f->val[ii] = c;
+
+  f->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2206,6 +2226,51 @@ cs_field_current_to_previous(cs_field_t  *f)
     }
 
   }
+
+  f->state_id += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Mark field values as modified.
+ *
+ * This increments the field's state counter, so that quantities
+ * derived from the field values (such as cached gradients) are not reused.
+ * It must be called when values are modified directly, outside of the
+ * field API functions.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_update_state(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  f->state_id += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Mark field boundary condition coefficients as modified.
+ *
+ * This increments the boundary condition coefficients' state counter,
+ * so that quantities depending on them (such as cached gradients) are
+ * not reused. It must be called when coefficients are modified directly,
+ * outside of the field API functions.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_update_bc_state(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->bc_coeffs != NULL)
+    f->bc_coeffs->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -117,6 +117,8 @@ typedef struct {
   cs_real_t         *hint;         /* coefficient for internal coupling */
   cs_real_t         *hext;         /* coefficient for internal coupling */
 
+  int                state_id;     /* Coefficients modification counter */
+
 } cs_field_bc_coeffs_t;
 
 /* Field descriptor */
@@ -155,6 +157,8 @@ typedef struct {
 
   bool                    is_owner;     /* Ownership flag for values */
 
+  int                     state_id;     /* Values modification counter */
+
 } cs_field_t;
 
 /*----------------------------------------------------------------------------
@@ -354,6 +358,35 @@ cs_field_set_values(cs_field_t  *f,
 void
 cs_field_current_to_previous(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Mark field values as modified.
+ *
+ * This increments the field's state counter, so that quantities
+ * derived from the field values (such as cached gradients) are not reused.
+ * It must be called when values are modified directly, outside of the
+ * field API functions.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_update_state(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Mark field boundary condition coefficients as modified.
+ *
+ * This increments the boundary condition coefficients' state counter.
+ * It must be called when coefficients are modified directly, outside of
+ * the field API functions.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_update_bc_state(cs_field_t  *f);
+
 /*----------------------------------------------------------------------------
  * Destroy all defined fields.
  *----------------------------------------------------------------------------*/
@@ -61,6 +61,7 @@
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_internal_coupling.h"
+#include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -100,10 +101,55 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Gradient cache key: a cached gradient is reused only if all
+   members are identical (the structure is zeroed before being filled,
+   so it may be compared using memcmp) */
+
+typedef struct {
+
+  int               state_id;    /* Field state when computed */
+  int               bc_state_id; /* Boundary condition coefficients state */
+  int               w_state_id;  /* Weighting field state, or -1 */
+  int               nt_cur;      /* Time step number when computed */
+  int               op_type;     /* 0: scalar, 1: potential,
+                                    2: vector, 3: tensor */
+  int               inc;         /* 0 for increment, 1 otherwise */
+  int               recompute_cocg; /* 1 if COCG quantities recomputed */
+  int               imrgra;      /* Gradient reconstruction options */
+  int               nswrgr;
+  int               imligr;
+  double            epsrgr;
+  double            climgr;
+  double            extrag;
+
+  cs_lnum_t         n_vals;      /* Number of gradient values */
+
+} _gradient_cache_key_t;
+
+/* Gradient cache entry */
+
+typedef struct {
+
+  _gradient_cache_key_t   key;   /* Associated key */
+  bool                    valid; /* Is the entry valid ? */
+  cs_real_t              *grad;  /* Cached gradient values */
+
+} _gradient_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Field gradient cache (2 entries per field, for current and previous
+   time values) */
+
+static bool                _gradient_cache_active = false;
+static int                 _n_gradient_cache = 0;
+static _gradient_cache_t  *_gradient_cache = NULL;
+
+static unsigned long long  _gradient_cache_n_requests = 0;
+static unsigned long long  _gradient_cache_n_hits = 0;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -352,6 +398,138 @@ _local_extrema_scalar(const cs_real_t *restrict pvar,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return the gradient cache entry matching a field gradient request,
+ * and build the associated key.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   op_type        <-- 0: scalar, 1: potential, 2: vector, 3: tensor
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   var_cal_opt    <-- field calculation options
+ *   f_weight       <-- pointer to weighting field, or NULL
+ *   key            --> associated cache key
+ *
+ * returns:
+ *   pointer to cache entry, or NULL if the cache is not used
+ *----------------------------------------------------------------------------*/
+
+static _gradient_cache_t *
+_gradient_cache_entry(const cs_field_t         *f,
+                      bool                      use_previous_t,
+                      int                       op_type,
+                      int                       inc,
+                      bool                      recompute_cocg,
+                      const cs_var_cal_opt_t   *var_cal_opt,
+                      const cs_field_t         *f_weight,
+                      _gradient_cache_key_t    *key)
+{
+  if (_gradient_cache_active == false)
+    return NULL;
+
+  if (f->location_id != CS_MESH_LOCATION_CELLS || f->bc_coeffs == NULL)
+    return NULL;
+
+  int n_fields = cs_field_n_fields();
+
+  if (_n_gradient_cache < 2*n_fields) {
+    BFT_REALLOC(_gradient_cache, 2*n_fields, _gradient_cache_t);
+    for (int i = _n_gradient_cache; i < 2*n_fields; i++) {
+      _gradient_cache[i].valid = false;
+      _gradient_cache[i].grad = NULL;
+    }
+    _n_gradient_cache = 2*n_fields;
+  }
+
+  memset(key, 0, sizeof(_gradient_cache_key_t));
+
+  key->state_id = f->state_id;
+  key->bc_state_id = f->bc_coeffs->state_id;
+  key->w_state_id = (f_weight != NULL) ? f_weight->state_id : -1;
+  key->nt_cur = cs_glob_time_step->nt_cur;
+  key->op_type = op_type;
+  key->inc = inc;
+  key->recompute_cocg = (recompute_cocg) ? 1 : 0;
+  key->imrgra = var_cal_opt->imrgra;
+  key->nswrgr = var_cal_opt->nswrgr;
+  key->imligr = var_cal_opt->imligr;
+  key->epsrgr = var_cal_opt->epsrgr;
+  key->climgr = var_cal_opt->climgr;
+  key->extrag = var_cal_opt->extrag;
+  key->n_vals = cs_glob_mesh->n_cells_with_ghosts * f->dim * 3;
+
+  _gradient_cache_n_requests += 1;
+
+  return _gradient_cache + 2*f->id + ((use_previous_t) ? 1 : 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Copy a cached gradient if it matches the given key.
+ *
+ * parameters:
+ *   gc   <-- pointer to cache entry, or NULL
+ *   key  <-- key of requested gradient
+ *   grad --> gradient values (unchanged if not found)
+ *
+ * returns:
+ *   true if a matching cached gradient was found, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_load(const _gradient_cache_t      *gc,
+                     const _gradient_cache_key_t  *key,
+                     cs_real_t                    *grad)
+{
+  if (gc == NULL)
+    return false;
+
+  if (   gc->valid == false
+      || memcmp(&(gc->key), key, sizeof(_gradient_cache_key_t)) != 0)
+    return false;
+
+  const cs_lnum_t n_vals = key->n_vals;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    grad[i] = gc->grad[i];
+
+  _gradient_cache_n_hits += 1;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Save a computed gradient to the cache.
+ *
+ * parameters:
+ *   gc   <-> pointer to cache entry, or NULL
+ *   key  <-- key of computed gradient
+ *   grad <-- gradient values
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_save(_gradient_cache_t            *gc,
+                     const _gradient_cache_key_t  *key,
+                     const cs_real_t              *grad)
+{
+  if (gc == NULL)
+    return;
+
+  const cs_lnum_t n_vals = key->n_vals;
+
+  if (gc->grad == NULL || gc->key.n_vals != n_vals)
+    BFT_REALLOC(gc->grad, n_vals, cs_real_t);
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    gc->grad[i] = grad[i];
+
+  memcpy(&(gc->key), key, sizeof(_gradient_cache_key_t));
+  gc->valid = true;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -558,13 +736,15 @@ cs_field_gradient_scalar(const cs_field_t          *f,
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
+  const cs_field_t *f_weight = NULL;
+
   if (f->type & CS_FIELD_VARIABLE && var_cal_opt.iwgrec == 1) {
     if (var_cal_opt.idiff > 0) {
       /* Weighted gradient coefficients */
       int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(f, key_id);
       if (diff_id > -1) {
-        cs_field_t *f_weight = cs_field_by_id(diff_id);
+        f_weight = cs_field_by_id(diff_id);
         c_weight = f_weight->val;
         w_stride = f_weight->dim;
       }
@@ -585,6 +765,15 @@ cs_field_gradient_scalar(const cs_field_t          *f,
 
   cs_real_t *var = (use_previous_t) ? f->val_pre : f->val;
 
+  _gradient_cache_key_t c_key;
+  _gradient_cache_t *gc = _gradient_cache_entry(f, use_previous_t, 0, inc,
+                                                recompute_cocg,
+                                                &var_cal_opt, f_weight,
+                                                &c_key);
+
+  if (_gradient_cache_load(gc, &c_key, (cs_real_t *)grad))
+    return;
+
   cs_gradient_perio_init_rij(f, &tr_dim, grad);
 
   cs_gradient_scalar(f->name,
@@ -608,6 +797,8 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  _gradient_cache_save(gc, &c_key, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -656,12 +847,14 @@ cs_field_gradient_potential(const cs_field_t          *f,
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
+  const cs_field_t *f_weight = NULL;
+
   if (f->type & CS_FIELD_VARIABLE && var_cal_opt.iwgrec == 1) {
     if (var_cal_opt.idiff > 0) {
       int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(f, key_id);
       if (diff_id > -1) {
-        cs_field_t *f_weight = cs_field_by_id(diff_id);
+        f_weight = cs_field_by_id(diff_id);
         c_weight = f_weight->val;
         w_stride = f_weight->dim;
       }
@@ -680,6 +873,17 @@ cs_field_gradient_potential(const cs_field_t          *f,
     }
   }
 
+  /* Only gradients without hydrostatic pressure handling are cached */
+
+  _gradient_cache_key_t c_key;
+  _gradient_cache_t *gc = NULL;
+
+  if (hyd_p_flag == 0) {
+    gc = _gradient_cache_entry(f, use_previous_t, 1, inc, recompute_cocg,
+                               &var_cal_opt, f_weight, &c_key);
+    if (_gradient_cache_load(gc, &c_key, (cs_real_t *)grad))
+      return;
+  }
 
   cs_gradient_scalar(f->name,
                      gradient_type,
@@ -702,6 +906,8 @@ cs_field_gradient_potential(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  _gradient_cache_save(gc, &c_key, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -739,13 +945,15 @@ cs_field_gradient_vector(const cs_field_t          *f,
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
+  const cs_field_t *f_weight = NULL;
+
   if (f->type & CS_FIELD_VARIABLE && var_cal_opt.iwgrec == 1) {
     if (var_cal_opt.idiff > 0) {
       /* Weighted gradient coefficients */
       int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(f, key_id);
       if (diff_id > -1) {
-        cs_field_t *f_weight = cs_field_by_id(diff_id);
+        f_weight = cs_field_by_id(diff_id);
         c_weight = f_weight->val;
       }
     }
@@ -765,6 +973,15 @@ cs_field_gradient_vector(const cs_field_t          *f,
   cs_real_3_t *var = (use_previous_t) ? (cs_real_3_t *)(f->val_pre)
                                       : (cs_real_3_t *)(f->val);
 
+  _gradient_cache_key_t c_key;
+  _gradient_cache_t *gc = _gradient_cache_entry(f, use_previous_t, 2, inc,
+                                                false,
+                                                &var_cal_opt, f_weight,
+                                                &c_key);
+
+  if (_gradient_cache_load(gc, &c_key, (cs_real_t *)grad))
+    return;
+
   cs_gradient_vector(f->name,
                      gradient_type,
                      halo_type,
@@ -780,6 +997,8 @@ cs_field_gradient_vector(const cs_field_t          *f,
                      c_weight,
                      cpl,
                      grad);
+
+  _gradient_cache_save(gc, &c_key, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -817,6 +1036,15 @@ cs_field_gradient_tensor(const cs_field_t          *f,
   cs_real_6_t *var = (use_previous_t) ? (cs_real_6_t *)(f->val_pre)
                                       : (cs_real_6_t *)(f->val);
 
+  _gradient_cache_key_t c_key;
+  _gradient_cache_t *gc = _gradient_cache_entry(f, use_previous_t, 3, inc,
+                                                false,
+                                                &var_cal_opt, NULL,
+                                                &c_key);
+
+  if (_gradient_cache_load(gc, &c_key, (cs_real_t *)grad))
+    return;
+
   cs_gradient_tensor(f->name,
                      gradient_type,
                      halo_type,
@@ -830,6 +1058,8 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                      (const cs_real_66_t *)(f->bc_coeffs->b),
                      var,
                      grad);
+
+  _gradient_cache_save(gc, &c_key, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -961,6 +1191,8 @@ cs_field_set_volume_average(cs_field_t     *f,
   for (cs_lnum_t c_id = 0 ; c_id < n_cells ; c_id++) {
     val[c_id] += shift;
   }
+
+  cs_field_update_state(f);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1015,6 +1247,84 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate caching of field gradients.
+ *
+ * When active, the gradient computed by \ref cs_field_gradient_scalar,
+ * \ref cs_field_gradient_potential (without hydrostatic pressure),
+ * \ref cs_field_gradient_vector and \ref cs_field_gradient_tensor is saved
+ * for each field and time value, and a subsequent request is served from
+ * the cache if neither the field's state counter, nor the time step,
+ * gradient options, boundary condition coefficients state and weighting
+ * field state have changed.
+ *
+ * Field values or boundary condition coefficients modified directly
+ * (i.e. not through the field API) must then be marked using
+ * \ref cs_field_update_state or \ref cs_field_update_bc_state
+ * so that stale gradients are not reused.
+ *
+ * Cached gradients are freed when the cache is deactivated.
+ *
+ * \param[in]  active  true to activate gradient caching, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_set_active(bool  active)
+{
+  _gradient_cache_active = active;
+
+  if (active == false) {
+    for (int i = 0; i < _n_gradient_cache; i++)
+      BFT_FREE(_gradient_cache[i].grad);
+    BFT_FREE(_gradient_cache);
+    _n_gradient_cache = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate all cached field gradients.
+ *
+ * This is required when the mesh or its geometric quantities change.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_clear(void)
+{
+  for (int i = 0; i < _n_gradient_cache; i++)
+    _gradient_cache[i].valid = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log field gradient cache statistics and free cached gradients.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void)
+{
+  if (_gradient_cache_n_requests > 0) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Field gradient cache:\n\n"
+                    "  Number of requests:  %12llu\n"
+                    "  Number of hits:      %12llu\n"),
+                  _gradient_cache_n_requests,
+                  _gradient_cache_n_hits);
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    cs_log_separator(CS_LOG_PERFORMANCE);
+  }
+
+  cs_field_gradient_cache_set_active(false);
+
+  _gradient_cache_n_requests = 0;
+  _gradient_cache_n_hits = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -207,6 +207,52 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate caching of field gradients.
+ *
+ * When active, the gradient computed by \ref cs_field_gradient_scalar,
+ * \ref cs_field_gradient_potential (without hydrostatic pressure),
+ * \ref cs_field_gradient_vector and \ref cs_field_gradient_tensor is saved
+ * for each field and time value, and a subsequent request is served from
+ * the cache if neither the field's state counter, nor the time step,
+ * gradient options, boundary condition coefficients state and weighting
+ * field state have changed.
+ *
+ * Field values or boundary condition coefficients modified directly
+ * (i.e. not through the field API) must then be marked using
+ * \ref cs_field_update_state or \ref cs_field_update_bc_state
+ * so that stale gradients are not reused.
+ *
+ * Cached gradients are freed when the cache is deactivated.
+ *
+ * \param[in]  active  true to activate gradient caching, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_set_active(bool  active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate all cached field gradients.
+ *
+ * This is required when the mesh or its geometric quantities change.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_clear(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log field gradient cache statistics and free cached gradients.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
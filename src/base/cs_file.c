@@ -77,6 +77,22 @@
 #include <limits.h>
 #endif
 
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_PTHREAD_CREATE) \
+                             && defined(HAVE_PWRITE)
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#define CS_FILE_ASYNC_IO 1
+#endif
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) \
+                       && defined(HAVE_SYS_STAT_H) && defined(HAVE_UNISTD_H)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define CS_FILE_MMAP_IO 1
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -142,6 +158,8 @@ BEGIN_C_DECLS
        Serial standard C IO (funnelled through rank 0 in parallel)
   \var CS_FILE_STDIO_PARALLEL
        Per-process standard C IO (for reading only)
+  \var CS_FILE_MMAP
+       Per-process access to a file mapped to memory (for reading only)
   \var CS_FILE_MPI_INDEPENDENT
        Non-collective MPI-IO with independent file open and close
        (for reading only)
@@ -175,10 +193,40 @@ BEGIN_C_DECLS
 /* MPI tag for file operations */
 #define CS_FILE_MPI_TAG  (int)('C'+'S'+'_'+'F'+'I'+'L'+'E')
 
+/* Default maximum size of data staged for asynchronous writes */
+#define CS_FILE_ASYNC_DEFAULT_STAGED_SIZE  (256*1024*1024)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
+/* Asynchronous write target (shared between a file descriptor and the
+   background I/O thread, which owns it once the file is closed) */
+
+typedef struct _cs_file_async_t {
+
+  char                     *name;     /* File name */
+  FILE                     *sh;       /* Serial file handle, or NULL */
+  int                       fd;       /* File descriptor used for positioned
+                                         writes (-1 if not opened yet) */
+  int                       errcode;  /* First error code for this file */
+  struct _cs_file_async_t  *next;     /* Next active target */
+
+} _cs_file_async_t;
+
+/* Asynchronous write operation */
+
+typedef struct _cs_file_async_op_t {
+
+  _cs_file_async_t            *target;  /* Associated target */
+  cs_file_off_t                offset;  /* Write offset */
+  size_t                       size;    /* Size of data (bytes) */
+  const unsigned char         *buf;     /* Data, or NULL for close */
+  unsigned char               *_buf;    /* Staged data if owner, or NULL */
+  struct _cs_file_async_op_t  *next;    /* Next queued operation */
+
+} _cs_file_async_op_t;
+
 /* File descriptor */
 
 struct _cs_file_t {
@@ -192,6 +240,9 @@ struct _cs_file_t {
 
   FILE              *sh;           /* Serial file handle */
 
+  unsigned char     *map;          /* Memory-mapped file contents, or NULL */
+  cs_file_off_t      map_size;     /* Size of mapped file */
+
 #if defined(HAVE_MPI)
   MPI_Comm           comm;         /* Associated MPI communicator */
   MPI_Comm           io_comm;      /* Associated MPI-IO communicator */
@@ -204,6 +255,8 @@ struct _cs_file_t {
   cs_file_off_t      offset;       /* File offset */
 #endif
 
+  _cs_file_async_t  *async;        /* Asynchronous write target, or NULL */
+
 };
 
 /* Associated typedef documentation (for cs_file.h) */
@@ -268,6 +321,33 @@ static MPI_Info _mpi_io_hints_w = MPI_INFO_NULL;
 
 #endif
 
+/* Asynchronous writes: staged operations are processed in order by a
+   single background thread, which never calls MPI. Staging buffers and
+   associated structures use malloc() and free() directly rather than
+   BFT_MALLOC, as memory tracking is not thread-safe. */
+
+#if defined(CS_FILE_ASYNC_IO)
+
+static pthread_mutex_t  _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   _async_cond_push = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t   _async_cond_pop = PTHREAD_COND_INITIALIZER;
+static pthread_t        _async_thread;
+
+static bool                  _async_thread_active = false;
+static bool                  _async_thread_stop = false;
+static _cs_file_async_op_t  *_async_head = NULL;
+static _cs_file_async_op_t  *_async_tail = NULL;
+static _cs_file_async_t     *_async_targets = NULL;
+static int                   _async_n_ops = 0;
+static int                   _async_n_errors = 0;
+static int                   _async_errcode = 0;
+static char                  _async_error_name[256] = "";
+static size_t                _async_staged_size = 0;
+
+#endif
+
+static size_t  _async_max_staged_size = CS_FILE_ASYNC_DEFAULT_STAGED_SIZE;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -280,6 +360,7 @@ const char  *cs_file_access_name[]
   = {N_("default"),
      N_("standard input and output, serial access"),
      N_("standard input and output, parallel access"),
+     N_("memory-mapped file, parallel access"),
      N_("non-collective MPI-IO, independent file open/close"),
      N_("non-collective MPI-IO, collective file open/close"),
      N_("collective MPI-IO")};
@@ -332,17 +413,23 @@ _access_method(cs_file_access_t  m,
 
   /* Restrict to possible values */
 
+#if !defined(CS_FILE_MMAP_IO)
+  if (_m == CS_FILE_MMAP)
+    _m = CS_FILE_STDIO_PARALLEL;
+#endif
+
 #if defined(HAVE_MPI)
 #  if !defined(HAVE_MPI_IO)
   _m = CS_MAX(_m, CS_FILE_STDIO_PARALLEL);
 #  endif
-  if (cs_glob_mpi_comm == MPI_COMM_NULL)
+  if (cs_glob_mpi_comm == MPI_COMM_NULL && _m != CS_FILE_MMAP)
     _m = CS_FILE_STDIO_SERIAL;
 #else
-  _m = CS_FILE_STDIO_SERIAL;
+  if (_m != CS_FILE_MMAP)
+    _m = CS_FILE_STDIO_SERIAL;
 #endif
 
-  if (w && _m == CS_FILE_STDIO_PARALLEL)
+  if (w && (_m == CS_FILE_STDIO_PARALLEL || _m == CS_FILE_MMAP))
     _m = CS_FILE_STDIO_SERIAL;
 
   return _m;
@@ -637,6 +724,139 @@ _file_read(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Map a file to memory for reading.
+ *
+ * The whole file is mapped (read-only and shared) by each process, so
+ * pages are only loaded when accessed, and are shared through the page
+ * cache by processes on the same node.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_map(cs_file_t  *f)
+{
+  int retval = 0;
+
+#if defined(CS_FILE_MMAP_IO)
+
+  struct stat s;
+
+  int fd = open(f->name, O_RDONLY);
+
+  if (fd < 0 || fstat(fd, &s) != 0)
+    retval = errno;
+
+  else if (s.st_size > 0) {
+    void *p = mmap(NULL, s.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+      retval = errno;
+    else {
+      f->map = p;
+      f->map_size = s.st_size;
+    }
+  }
+
+  /* The mapping remains valid once the descriptor is closed */
+
+  if (fd > -1)
+    close(fd);
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error mapping file \"%s\" to memory:\n\n"
+                "  %s"), f->name, strerror(retval));
+
+#else
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Error mapping file \"%s\" to memory:\n\n"
+              "  memory-mapped files are not available."), f->name);
+  retval = -1;
+
+#endif /* defined(CS_FILE_MMAP_IO) */
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Unmap a file mapped to memory.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_unmap(cs_file_t  *f)
+{
+  int retval = 0;
+
+#if defined(CS_FILE_MMAP_IO)
+
+  if (f->map != NULL && munmap(f->map, f->map_size) != 0) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error unmapping file \"%s\":\n\n"
+                "  %s"), f->name, strerror(errno));
+    retval = errno;
+  }
+
+#endif /* defined(CS_FILE_MMAP_IO) */
+
+  f->map = NULL;
+  f->map_size = 0;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read data to a buffer from a file mapped to memory.
+ *
+ * Data is copied directly from the mapping, with endianness conversion
+ * if required, so no intermediate buffer is used.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   buf    --> pointer to location receiving data
+ *   offset <-- position of data in file
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_map_read(cs_file_t      *f,
+               void           *buf,
+               cs_file_off_t   offset,
+               size_t          size,
+               size_t          ni)
+{
+  if (ni == 0)
+    return 0;
+
+  if (offset < 0 || offset + (cs_file_off_t)(size*ni) > f->map_size) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("Premature end of file \"%s\""), f->name);
+    return 0;
+  }
+
+  if (f->swap_endian == true && size > 1)
+    _swap_endian(buf, f->map + offset, size, ni);
+  else
+    memcpy(buf, f->map + offset, size*ni);
+
+  return ni;
+}
+
 /*----------------------------------------------------------------------------
  * Write data to a file using standard C IO.
  *
@@ -1155,6 +1375,432 @@ _file_write_block_p(cs_file_t  *f,
   return retval;
 }
 
+#if defined(CS_FILE_ASYNC_IO)
+
+/*----------------------------------------------------------------------------
+ * Record an asynchronous write error.
+ *
+ * The queue mutex must be locked by the caller.
+ *
+ * parameters:
+ *   t       <-> asynchronous write target
+ *   errcode <-- associated error code
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_record_error(_cs_file_async_t  *t,
+                    int                errcode)
+{
+  if (t->errcode == 0)
+    t->errcode = errcode;
+
+  if (_async_n_errors == 0) {
+    _async_errcode = errcode;
+    strncpy(_async_error_name, t->name, sizeof(_async_error_name) - 1);
+    _async_error_name[sizeof(_async_error_name) - 1] = '\0';
+  }
+
+  _async_n_errors += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Process an asynchronous write or close operation.
+ *
+ * This function is called by the I/O thread (or by the main thread if
+ * the I/O thread could not be started), with the queue mutex unlocked.
+ * It must not call MPI or BFT functions. The operation's buffer is freed,
+ * and the target is destroyed on close.
+ *
+ * parameters:
+ *   op <-> pointer to asynchronous operation
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_process(_cs_file_async_op_t  *op)
+{
+  int errcode = 0;
+
+  _cs_file_async_t *t = op->target;
+  const bool close_op = (op->buf == NULL);
+
+  /* Write data, opening the file on first write if necessary */
+
+  if (close_op == false) {
+
+    if (t->fd < 0 && t->errcode == 0) {
+      t->fd = open(t->name, O_WRONLY);
+      if (t->fd < 0)
+        errcode = errno;
+    }
+
+    if (t->fd > -1 && t->errcode == 0) {
+
+      const unsigned char *p = op->buf;
+      size_t n = op->size;
+      off_t offset = op->offset;
+
+      while (n > 0) {
+        ssize_t n_written = pwrite(t->fd, p, n, offset);
+        if (n_written < 0) {
+          if (errno == EINTR)
+            continue;
+          errcode = errno;
+          break;
+        }
+        else if (n_written == 0) {
+          errcode = EIO;
+          break;
+        }
+        p += n_written;
+        n -= n_written;
+        offset += n_written;
+      }
+
+    }
+
+    free(op->_buf);
+    op->_buf = NULL;
+
+  }
+
+  /* Close file */
+
+  else {
+
+    if (t->sh != NULL) {
+      if (fclose(t->sh) != 0)
+        errcode = errno;
+    }
+    else if (t->fd > -1) {
+      if (close(t->fd) != 0)
+        errcode = errno;
+    }
+
+    t->sh = NULL;
+    t->fd = -1;
+
+  }
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (errcode != 0)
+    _async_record_error(t, errcode);
+
+  if (close_op) {
+    _cs_file_async_t **_t = &_async_targets;
+    while (*_t != t)
+      _t = &((*_t)->next);
+    *_t = t->next;
+    free(t->name);
+    free(t);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------
+ * Main function of the background I/O thread.
+ *
+ * Operations are processed in submission order until the thread is
+ * requested to stop and the queue is empty.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_thread_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (true) {
+
+    _cs_file_async_op_t *op = NULL;
+
+    while (_async_head == NULL && _async_thread_stop == false)
+      pthread_cond_wait(&_async_cond_push, &_async_mutex);
+
+    if (_async_head == NULL)
+      break;
+
+    op = _async_head;
+    _async_head = op->next;
+    if (_async_head == NULL)
+      _async_tail = NULL;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    const size_t staged_size = (op->_buf != NULL) ? op->size : 0;
+
+    _async_process(op);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    _async_staged_size -= staged_size;
+    _async_n_ops -= 1;
+    free(op);
+
+    pthread_cond_broadcast(&_async_cond_pop);
+
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Submit an operation to the asynchronous write queue.
+ *
+ * The I/O thread is started on first use. If staged data would exceed the
+ * maximum staging size, this function blocks until enough previously
+ * staged data has been written.
+ *
+ * If the data is not staged (i.e. _buf is NULL), it is only referenced
+ * by the queued operation, so this function waits for the queue to be
+ * empty before returning.
+ *
+ * parameters:
+ *   t      <-> asynchronous write target
+ *   offset <-- write offset
+ *   buf    <-- data to write, or NULL to close
+ *   _buf   <-- staged data (same as buf, ownership transferred),
+ *              or NULL if buf is not staged
+ *   size   <-- size of data (bytes)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_push(_cs_file_async_t     *t,
+            cs_file_off_t         offset,
+            const unsigned char  *buf,
+            unsigned char        *_buf,
+            size_t                size)
+{
+  _cs_file_async_op_t *op = malloc(sizeof(_cs_file_async_op_t));
+
+  if (op == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error queuing asynchronous write for file \"%s\"."),
+              t->name);
+
+  op->target = t;
+  op->offset = offset;
+  op->size = size;
+  op->buf = buf;
+  op->_buf = _buf;
+  op->next = NULL;
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (_async_thread_active == false) {
+    if (pthread_create(&_async_thread, NULL, _async_thread_main, NULL) == 0)
+      _async_thread_active = true;
+  }
+
+  /* Fall back to synchronous writes if no thread is available */
+
+  if (_async_thread_active == false) {
+    pthread_mutex_unlock(&_async_mutex);
+    _async_process(op);
+    free(op);
+    return;
+  }
+
+  if (_async_max_staged_size > 0 && _buf != NULL) {
+    while (   _async_staged_size > 0
+           && _async_staged_size + size > _async_max_staged_size)
+      pthread_cond_wait(&_async_cond_pop, &_async_mutex);
+  }
+
+  if (_async_tail != NULL)
+    _async_tail->next = op;
+  else
+    _async_head = op;
+  _async_tail = op;
+
+  if (_buf != NULL)
+    _async_staged_size += size;
+  _async_n_ops += 1;
+
+  pthread_cond_signal(&_async_cond_push);
+
+  /* Unstaged data must be written before returning */
+
+  if (buf != NULL && _buf == NULL) {
+    while (_async_n_ops > 0)
+      pthread_cond_wait(&_async_cond_pop, &_async_mutex);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for all queued asynchronous operations to complete.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_drain(void)
+{
+  pthread_mutex_lock(&_async_mutex);
+
+  while (_async_n_ops > 0)
+    pthread_cond_wait(&_async_cond_pop, &_async_mutex);
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a file with a given name is open for asynchronous writing.
+ *
+ * parameters:
+ *   name <-- file name
+ *
+ * returns:
+ *   true if an asynchronous write target with that name is active
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_target_is_active(const char  *name)
+{
+  bool retval = false;
+
+  pthread_mutex_lock(&_async_mutex);
+
+  for (_cs_file_async_t *t = _async_targets; t != NULL; t = t->next) {
+    if (strcmp(t->name, name) == 0) {
+      retval = true;
+      break;
+    }
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return retval;
+}
+
+#endif /* defined(CS_FILE_ASYNC_IO) */
+
+/*----------------------------------------------------------------------------
+ * Stage data for asynchronous writing at a given offset.
+ *
+ * Data is copied (and byte-swapped if required), so the caller's buffer
+ * may be modified or freed as soon as this function returns.
+ *
+ * If the data is larger than the maximum staging size, it is written
+ * synchronously instead (after previously staged data, which is waited
+ * for), without being copied unless it must be byte-swapped.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   offset <-- write offset
+ *   buf    <-- pointer to location containing data
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to write
+ *   swap   <-- swap bytes of staged data if true
+ *
+ * returns:
+ *   the (local) number of items (not bytes) staged for writing;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_write_async(cs_file_t      *f,
+                  cs_file_off_t   offset,
+                  const void     *buf,
+                  size_t          size,
+                  size_t          ni,
+                  bool            swap)
+{
+  size_t retval = 0;
+
+#if defined(CS_FILE_ASYNC_IO)
+
+  unsigned char *copybuf = NULL;
+
+  if (ni == 0)
+    return 0;
+
+  const size_t n_bytes = size*ni;
+
+  /* Data fitting in the staging bound is staged (possibly waiting for
+     previously staged data to be written); larger data is not */
+
+  pthread_mutex_lock(&_async_mutex);
+  const bool stage = (   _async_max_staged_size == 0
+                      || n_bytes <= _async_max_staged_size);
+  pthread_mutex_unlock(&_async_mutex);
+
+  if (stage || (swap == true && size > 1)) {
+
+    copybuf = malloc(n_bytes);
+
+    if (copybuf == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error staging %llu bytes for asynchronous write\n"
+                  "of file \"%s\"."),
+                (unsigned long long)n_bytes, f->name);
+
+    memcpy(copybuf, buf, n_bytes);
+
+    if (swap == true && size > 1)
+      _swap_endian(copybuf, copybuf, size, ni);
+
+  }
+
+  if (stage)
+    _async_push(f->async, offset, copybuf, copybuf, n_bytes);
+
+  else {
+    _async_push(f->async,
+                offset,
+                (copybuf != NULL) ? copybuf : buf,
+                NULL,
+                n_bytes);
+    free(copybuf);
+  }
+
+  retval = ni;
+
+#else
+
+  CS_UNUSED(f);
+  CS_UNUSED(offset);
+  CS_UNUSED(buf);
+  CS_UNUSED(size);
+  CS_UNUSED(ni);
+  CS_UNUSED(swap);
+
+  assert(0);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Close a file open for asynchronous writing.
+ *
+ * The file is actually closed by the I/O thread once previously staged
+ * data has been written.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_close_async(cs_file_t  *f)
+{
+#if defined(CS_FILE_ASYNC_IO)
+  _async_push(f->async, 0, NULL, NULL, 0);
+#endif
+
+  f->async = NULL;
+}
+
 #if defined(HAVE_MPI_IO)
 
 /*----------------------------------------------------------------------------
@@ -1808,6 +2454,9 @@ cs_file_open(const char        *name,
   BFT_MALLOC(f, 1, cs_file_t);
 
   f->sh = NULL;
+  f->map = NULL;
+  f->map_size = 0;
+  f->async = NULL;
 
 #if defined(HAVE_MPI)
   f->comm = MPI_COMM_NULL;
@@ -1847,23 +2496,31 @@ cs_file_open(const char        *name,
         f->io_comm = MPI_COMM_NULL;
       }
     }
-    if (f->comm == MPI_COMM_NULL)
+    if (f->comm == MPI_COMM_NULL && f->method != CS_FILE_MMAP)
       f->method = CS_FILE_STDIO_SERIAL;
   }
 #else
-  f->method = CS_FILE_STDIO_SERIAL;
+  if (f->method != CS_FILE_MMAP)
+    f->method = CS_FILE_STDIO_SERIAL;
 #endif
 
   /* Use MPI IO ? */
 
 #if !defined(HAVE_MPI_IO)
-  if (f->method > CS_FILE_STDIO_PARALLEL)
+  if (f->method >= CS_FILE_MPI_INDEPENDENT)
     bft_error(__FILE__, __LINE__, 0,
               _("Error opening file:\n%s\n"
                 "MPI-IO is requested, but not available."),
               name);
 #endif
 
+  /* Complete pending asynchronous writes to a file of the same name */
+
+#if defined(CS_FILE_ASYNC_IO)
+  if (_async_target_is_active(f->name))
+    _async_drain();
+#endif
+
   /* Open file. In case of failure, destroy the allocated structure;
      this is only useful with a non-default error handler,
      as the program is terminated by default */
@@ -1871,6 +2528,9 @@ cs_file_open(const char        *name,
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
+  else if (f->method == CS_FILE_MMAP)
+    errcode = _file_map(f);
+
 #if defined(HAVE_MPI_IO)
   if (f->method == CS_FILE_MPI_INDEPENDENT) {
     f->io_comm = MPI_COMM_SELF;
@@ -1992,9 +2652,15 @@ cs_file_free(cs_file_t  *f)
 {
   cs_file_t  *_f = f;
 
-  if (_f->sh != NULL)
+  if (_f->async != NULL)
+    _file_close_async(_f);
+
+  else if (_f->sh != NULL)
     _file_close(_f);
 
+  else if (_f->map != NULL)
+    _file_unmap(_f);
+
 #if defined(HAVE_MPI_IO)
   else if (_f->fh != MPI_FILE_NULL)
     _mpi_file_close(_f);
@@ -2123,9 +2789,14 @@ cs_file_read_global(cs_file_t  *f,
     }
   }
 
+  /* With a memory-mapped file, each rank simply copies the data */
+
+  else if (f->method == CS_FILE_MMAP)
+    retval = _file_map_read(f, buf, f->offset, size, ni);
+
 #if defined(HAVE_MPI_IO)
 
-  else if ((f->method > CS_FILE_STDIO_PARALLEL)) {
+  else if ((f->method >= CS_FILE_MPI_INDEPENDENT)) {
 
     MPI_Status status;
     int errcode = MPI_SUCCESS, count = 0;
@@ -2170,7 +2841,7 @@ cs_file_read_global(cs_file_t  *f,
 #endif /* defined(HAVE_MPI_IO) */
 
 #if defined(HAVE_MPI)
-  if (f->comm != MPI_COMM_NULL) {
+  if (f->comm != MPI_COMM_NULL && f->method != CS_FILE_MMAP) {
     long _retval = retval;
     MPI_Bcast(buf, size*ni, MPI_BYTE, 0, f->comm);
     MPI_Bcast(&_retval, 1, MPI_LONG, 0, f->comm);
@@ -2182,7 +2853,9 @@ cs_file_read_global(cs_file_t  *f,
 
   f->offset += (cs_file_off_t)ni * (cs_file_off_t)size;
 
-  if (f->swap_endian == true && size > 1)
+  /* Memory-mapped data is already converted while copied */
+
+  if (f->swap_endian == true && size > 1 && f->method != CS_FILE_MMAP)
     _swap_endian(buf, buf, size, retval);
 
   return retval;
@@ -2218,6 +2891,15 @@ cs_file_write_global(cs_file_t   *f,
   unsigned char *copybuf = _copybuf;
   const void *_buf = buf;
 
+  /* Stage data for asynchronous writing if active (root rank only) */
+
+  if (f->async != NULL) {
+    if (f->rank == 0)
+      _file_write_async(f, f->offset, buf, size, ni, f->swap_endian);
+    f->offset += (cs_file_off_t)ni * (cs_file_off_t)size;
+    return retval;
+  }
+
   /* Copy contents to ensure buffer constedness if necessary */
 
   if (   f->rank == 0
@@ -2371,6 +3053,14 @@ cs_file_read_block(cs_file_t  *f,
                                 _global_num_end);
     break;
 
+  case CS_FILE_MMAP:
+    retval = _file_map_read(f,
+                            buf,
+                            f->offset + (_global_num_start - 1) * size,
+                            size,
+                            (_global_num_end - _global_num_start));
+    break;
+
 #if defined(HAVE_MPI_IO)
 
   case CS_FILE_MPI_INDEPENDENT:
@@ -2415,12 +3105,87 @@ cs_file_read_block(cs_file_t  *f,
 
   f->offset += ((global_num_end_last - 1) * size * stride);
 
-  if (f->swap_endian == true && size > 1)
+  /* Memory-mapped data is already converted while copied */
+
+  if (f->swap_endian == true && size > 1 && f->method != CS_FILE_MMAP)
     _swap_endian(buf, buf, size, retval);
 
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read data distributed by blocks, avoiding copies where possible.
+ *
+ * This function behaves as \ref cs_file_read_block, except that when a file
+ * is mapped to memory (\ref CS_FILE_MMAP access method), requires no
+ * endianness conversion, and the local block is suitably aligned, a pointer
+ * to the mapped data is returned instead of copying it to buf. Such a view
+ * is read-only, and remains valid until the file is freed.
+ *
+ * \param[in]  f                 cs_file_t descriptor
+ * \param[out] buf               pointer to location receiving data
+ *                               if it must be copied
+ * \param[in]  size              size of each item of data in bytes
+ * \param[in]  stride            number of (interlaced) values per block item
+ * \param[in]  global_num_start  global number of first block item
+ *                               (1 to n numbering)
+ * \param[in]  global_num_end    global number of past-the end block item
+ *                               (1 to n numbering)
+ *
+ * \return pointer to local block data (view of mapped file, or buf)
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_block_view(cs_file_t  *f,
+                        void       *buf,
+                        size_t      size,
+                        size_t      stride,
+                        cs_gnum_t   global_num_start,
+                        cs_gnum_t   global_num_end)
+{
+  const unsigned char *view = NULL;
+
+  if (   f->method == CS_FILE_MMAP
+      && (f->swap_endian == false || size == 1)) {
+
+    cs_file_off_t b_start =   f->offset
+                            + (global_num_start - 1) * stride * size;
+    cs_file_off_t b_end =   f->offset
+                          + (global_num_end - 1) * stride * size;
+
+    if (   f->map != NULL && b_end <= f->map_size
+        && (uintptr_t)(f->map + b_start) % size == 0)
+      view = f->map + b_start;
+
+  }
+
+  /* Fall back to a copy if a view is not possible; otherwise,
+     update the offset as cs_file_read_block would */
+
+  if (view == NULL) {
+    cs_file_read_block(f,
+                       buf,
+                       size,
+                       stride,
+                       global_num_start,
+                       global_num_end);
+    return buf;
+  }
+
+  cs_gnum_t global_num_end_last = global_num_end;
+
+#if defined(HAVE_MPI)
+  if (f->n_ranks > 1)
+    MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+#endif
+
+  f->offset += ((global_num_end_last - 1) * size * stride);
+
+  return view;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Write data to a file, each associated process providing a
@@ -2464,10 +3229,13 @@ cs_file_write_block(cs_file_t   *f,
 
   const size_t bufsize = (global_num_end - global_num_start)*stride*size;
 
-  /* Copy contents to ensure buffer constedness if necessary */
+  /* Copy contents to ensure buffer constedness if necessary
+     (data staged for asynchronous writing is already copied and swapped
+     when needed, so it is handled without an additional copy below) */
 
-  if (   (f->swap_endian == true && size > 1)
-      || (f->n_ranks > 1 && f->method != CS_FILE_STDIO_PARALLEL)) {
+  if (   f->async == NULL
+      && (   (f->swap_endian == true && size > 1)
+          || (f->n_ranks > 1 && f->method != CS_FILE_STDIO_PARALLEL))) {
 
     unsigned char *copybuf = NULL;
 
@@ -2486,7 +3254,8 @@ cs_file_write_block(cs_file_t   *f,
     BFT_FREE(copybuf);
   }
 
-  /* Using Standard IO with no byte-swapping or serialization, write directly */
+  /* Using asynchronous writes or Standard IO with no byte-swapping
+     or serialization, write directly */
 
   else {
 
@@ -2495,7 +3264,15 @@ cs_file_write_block(cs_file_t   *f,
     const cs_gnum_t _global_num_start = (global_num_start-1)*stride + 1;
     const cs_gnum_t _global_num_end = (global_num_end-1)*stride + 1;
 
-    if (_global_num_end > _global_num_start) {
+    if (f->async != NULL)
+      retval = _file_write_async(f,
+                                 f->offset + (_global_num_start - 1) * size,
+                                 buf,
+                                 size,
+                                 (_global_num_end - _global_num_start),
+                                 f->swap_endian);
+
+    else if (_global_num_end > _global_num_start) {
 
       if (f->sh == NULL)
         _file_open(f);
@@ -2575,56 +3352,71 @@ cs_file_write_block_buffer(cs_file_t  *f,
                  size,
                  (_global_num_end - _global_num_start));
 
+  /* Stage data for asynchronous writing if active (each rank's block
+     is written directly at its final position) */
+
+  if (f->async != NULL)
+    retval = _file_write_async(f,
+                               f->offset + (_global_num_start - 1) * size,
+                               buf,
+                               size,
+                               (_global_num_end - _global_num_start),
+                               false);
+
   /* Write to file using chosen method */
 
-  switch(f->method) {
+  else {
 
-  case CS_FILE_STDIO_SERIAL:
-    retval = _file_write_block_s(f,
-                                 buf,
-                                 size,
-                                 _global_num_start,
-                                 _global_num_end);
-    break;
+    switch(f->method) {
 
-  case CS_FILE_STDIO_PARALLEL:
-    retval = _file_write_block_p(f,
-                                 buf,
-                                 size,
-                                 _global_num_start,
-                                 _global_num_end);
-    break;
+    case CS_FILE_STDIO_SERIAL:
+      retval = _file_write_block_s(f,
+                                   buf,
+                                   size,
+                                   _global_num_start,
+                                   _global_num_end);
+      break;
+
+    case CS_FILE_STDIO_PARALLEL:
+      retval = _file_write_block_p(f,
+                                   buf,
+                                   size,
+                                   _global_num_start,
+                                   _global_num_end);
+      break;
 
 #if defined(HAVE_MPI_IO)
 
-  case CS_FILE_MPI_INDEPENDENT:
-  case CS_FILE_MPI_NON_COLLECTIVE:
-      retval = _mpi_file_write_block_noncoll(f,
-                                             buf,
-                                             size,
-                                             _global_num_start,
-                                             _global_num_end);
-      break;
+    case CS_FILE_MPI_INDEPENDENT:
+    case CS_FILE_MPI_NON_COLLECTIVE:
+        retval = _mpi_file_write_block_noncoll(f,
+                                               buf,
+                                               size,
+                                               _global_num_start,
+                                               _global_num_end);
+        break;
 
-  case CS_FILE_MPI_COLLECTIVE:
-    if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
-      retval = _mpi_file_write_block_eo(f,
-                                        buf,
-                                        size,
-                                        _global_num_start,
-                                        _global_num_end);
-    else
-      retval = _mpi_file_write_block_ip(f,
-                                        buf,
-                                        size,
-                                        _global_num_start,
-                                        _global_num_end);
-    break;
+    case CS_FILE_MPI_COLLECTIVE:
+      if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+        retval = _mpi_file_write_block_eo(f,
+                                          buf,
+                                          size,
+                                          _global_num_start,
+                                          _global_num_end);
+      else
+        retval = _mpi_file_write_block_ip(f,
+                                          buf,
+                                          size,
+                                          _global_num_start,
+                                          _global_num_end);
+      break;
 
 #endif /* defined(HAVE_MPI_IO) */
 
-  default:
-    assert(0);
+    default:
+      assert(0);
+    }
+
   }
 
   /* Update offset */
@@ -2680,6 +3472,10 @@ cs_file_seek(cs_file_t       *f,
 
     if (f->sh != NULL)
       f->offset = cs_file_tell(f) + offset;
+    else if (f->async != NULL)
+      f->offset += offset;
+    else if (f->method == CS_FILE_MMAP)
+      f->offset = f->map_size + offset;
 
 #if defined(HAVE_MPI_IO)
     if (f->fh != MPI_FILE_NULL) {
@@ -2777,6 +3573,172 @@ cs_file_tell(cs_file_t  *f)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Switch a file open for writing to asynchronous mode.
+ *
+ * In this mode, data passed to the global and block write functions is
+ * copied to a staging buffer, and actually written by a background I/O
+ * thread, so the caller may continue computing (and modify the source
+ * arrays) while data is being written. Each rank writes its own blocks
+ * directly at their final position, so no serialization through the
+ * root rank is needed. All MPI communication remains on the calling thread.
+ *
+ * The file is actually closed by the I/O thread once its data is
+ * written, and write errors are only reported by cs_file_async_wait().
+ *
+ * This is only possible for files using standard I/O in write mode
+ * (not append), when built with POSIX thread and positioned write
+ * support; otherwise, the file is left unchanged.
+ *
+ * This function is collective on the file's communicator.
+ *
+ * \param[in, out]  f  cs_file_t descriptor
+ *
+ * \return true if asynchronous mode is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async(cs_file_t  *f)
+{
+  bool retval = false;
+
+#if defined(CS_FILE_ASYNC_IO)
+
+  _cs_file_async_t *t = NULL;
+
+  if (f->async != NULL)
+    return true;
+
+  if (f->mode != CS_FILE_MODE_WRITE || f->method > CS_FILE_STDIO_PARALLEL)
+    return false;
+
+  /* Flush data written so far through the serial handle; other ranks
+     may have opened the file in append mode, which is not compatible
+     with positioned writes, so close it in that case */
+
+  if (f->rank == 0 && f->sh != NULL) {
+    if (fflush(f->sh) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error writing file \"%s\":\n\n  %s"),
+                f->name, strerror(errno));
+  }
+  else if (f->sh != NULL)
+    _file_close(f);
+
+  /* Ensure the file is created before other ranks open it */
+
+#if defined(HAVE_MPI)
+  if (f->comm != MPI_COMM_NULL)
+    MPI_Barrier(f->comm);
+#endif
+
+  t = malloc(sizeof(_cs_file_async_t));
+  if (t != NULL)
+    t->name = malloc(strlen(f->name) + 1);
+  if (t == NULL || t->name == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error switching file \"%s\" to asynchronous mode."),
+              f->name);
+
+  strcpy(t->name, f->name);
+  t->sh = f->sh;
+  t->fd = (f->sh != NULL) ? fileno(f->sh) : -1;
+  t->errcode = 0;
+
+  pthread_mutex_lock(&_async_mutex);
+  t->next = _async_targets;
+  _async_targets = t;
+  pthread_mutex_unlock(&_async_mutex);
+
+  f->sh = NULL;
+  f->async = t;
+
+  retval = true;
+
+#else
+
+  CS_UNUSED(f);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of all pending asynchronous writes.
+ *
+ * This is a local operation; errors encountered by the I/O thread since
+ * the previous call are logged and counted, then reset.
+ *
+ * \return number of failed asynchronous operations on this rank
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_async_wait(void)
+{
+  int retval = 0;
+
+#if defined(CS_FILE_ASYNC_IO)
+
+  char name[sizeof(_async_error_name)];
+  int errcode = 0;
+
+  _async_drain();
+
+  pthread_mutex_lock(&_async_mutex);
+
+  retval = _async_n_errors;
+  errcode = _async_errcode;
+  strcpy(name, _async_error_name);
+
+  _async_n_errors = 0;
+  _async_errcode = 0;
+  _async_error_name[0] = '\0';
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  if (retval > 0)
+    bft_printf(_("\n"
+                 "Error writing file \"%s\" asynchronously:\n\n"
+                 "  %s\n"
+                 "(%d failed asynchronous operation(s) on this rank)\n"),
+               name, strerror(errcode), retval);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of data staged for asynchronous writes.
+ *
+ * When staging new data would exceed this size, writes block until
+ * enough previously staged data has been written. A single operation
+ * larger than this size is written synchronously, without staging.
+ *
+ * The default size is 256 MiB.
+ *
+ * \param[in]  max_size  maximum staged size (in bytes), or 0 for unlimited
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_buffer_size(size_t  max_size)
+{
+#if defined(CS_FILE_ASYNC_IO)
+  pthread_mutex_lock(&_async_mutex);
+  _async_max_staged_size = max_size;
+  pthread_mutex_unlock(&_async_mutex);
+#else
+  _async_max_staged_size = max_size;
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump the metadata of a file structure in human readable form.
@@ -2793,6 +3755,7 @@ cs_file_dump(const cs_file_t  *f)
                              "CS_FILE_MODE_APPEND"};
   const char *access_name[] = {"CS_FILE_STDIO_SERIAL",
                                "CS_FILE_STDIO_PARALLEL",
+                               "CS_FILE_MMAP",
                                "CS_FILE_MPI_INDEPENDENT",
                                "CS_FILE_MPI_NON_COLLECTIVE",
                                "CS_FILE_MPI_COLLECTIVE"};
@@ -2810,10 +3773,12 @@ cs_file_dump(const cs_file_t  *f)
              "Rank:                        %d\n"
              "N ranks:                     %d\n"
              "Swap endian:                 %d\n"
-             "Serial handle:               %p\n",
+             "Serial handle:               %p\n"
+             "Memory map:                  %p (%llu bytes)\n",
              f->name, mode_name[f->mode], access_name[f->method-1],
              f->rank, f->n_ranks, (int)(f->swap_endian),
-             (const void *)f->sh);
+             (const void *)f->sh,
+             (const void *)f->map, (unsigned long long)(f->map_size));
 
 #if defined(HAVE_MPI)
   bft_printf("Associated io communicator:  %llu\n",
@@ -2840,6 +3805,26 @@ cs_file_dump(const cs_file_t  *f)
 void
 cs_file_free_defaults(void)
 {
+  /* Complete asynchronous writes and stop I/O thread */
+
+#if defined(CS_FILE_ASYNC_IO)
+
+  cs_file_async_wait();
+
+  if (_async_thread_active) {
+    pthread_mutex_lock(&_async_mutex);
+    _async_thread_stop = true;
+    pthread_cond_signal(&_async_cond_push);
+    pthread_mutex_unlock(&_async_mutex);
+    pthread_join(_async_thread, NULL);
+    _async_thread_active = false;
+    _async_thread_stop = false;
+  }
+
+#endif
+
+  _async_max_staged_size = CS_FILE_ASYNC_DEFAULT_STAGED_SIZE;
+
   _mpi_io_positioning = CS_FILE_MPI_EXPLICIT_OFFSETS;
 
   _default_access_r = CS_FILE_DEFAULT;
@@ -2978,7 +3963,7 @@ cs_file_set_default_access(cs_file_mode_t    mode,
 
   /* Set info objects */
 
-  if (_method > CS_FILE_STDIO_PARALLEL && hints != MPI_INFO_NULL) {
+  if (_method >= CS_FILE_MPI_INDEPENDENT && hints != MPI_INFO_NULL) {
     if (mode == CS_FILE_MODE_READ)
       MPI_Info_dup(hints, &_mpi_io_hints_r);
     else if (mode == CS_FILE_MODE_WRITE || mode == CS_FILE_MODE_APPEND)
@@ -3291,7 +4276,7 @@ cs_file_defaults_info(void)
     cs_file_get_default_access(mode, &method, &hints);
 
 #if defined(HAVE_MPI_IO)
-    if (method > CS_FILE_STDIO_PARALLEL) {
+    if (method >= CS_FILE_MPI_INDEPENDENT) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode + 2]),
@@ -3299,7 +4284,7 @@ cs_file_defaults_info(void)
                       _(cs_file_mpi_positioning_name[_mpi_io_positioning]));
     }
 #endif
-    if (method <= CS_FILE_STDIO_PARALLEL) {
+    if (method <= CS_FILE_MMAP) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode]), _(cs_file_access_name[method]));
@@ -86,6 +86,7 @@ typedef enum {
   CS_FILE_DEFAULT,
   CS_FILE_STDIO_SERIAL,
   CS_FILE_STDIO_PARALLEL,
+  CS_FILE_MMAP,
   CS_FILE_MPI_INDEPENDENT,
   CS_FILE_MPI_NON_COLLECTIVE,
   CS_FILE_MPI_COLLECTIVE
@@ -347,6 +348,37 @@ cs_file_read_block(cs_file_t  *f,
                    cs_gnum_t   global_num_start,
                    cs_gnum_t   global_num_end);
 
+/*----------------------------------------------------------------------------
+ * Read data distributed by blocks, avoiding copies where possible.
+ *
+ * This function behaves as cs_file_read_block(), except that when a file
+ * is mapped to memory (CS_FILE_MMAP access method), requires no endianness
+ * conversion, and the local block is suitably aligned, a pointer to the
+ * mapped data is returned instead of copying it to buf. Such a view is
+ * read-only, and remains valid until the file is freed.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              --> pointer to location receiving data if it
+ *                        must be copied
+ *   size             <-- size of each item of data in bytes
+ *   stride           <-- number of (interlaced) values per block item
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   pointer to local block data (view of mapped file, or buf)
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_block_view(cs_file_t  *f,
+                        void       *buf,
+                        size_t      size,
+                        size_t      stride,
+                        cs_gnum_t   global_num_start,
+                        cs_gnum_t   global_num_end);
+
 /*----------------------------------------------------------------------------
  * Write data to a file, each associated process providing a contiguous part
  * of this data.
@@ -458,6 +490,59 @@ cs_file_seek(cs_file_t       *f,
 cs_file_off_t
 cs_file_tell(cs_file_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Switch a file open for writing to asynchronous mode.
+ *
+ * In this mode, data passed to the global and block write functions is
+ * copied to a staging buffer, and actually written by a background I/O
+ * thread. The file is closed by that thread once its data is written,
+ * and write errors are only reported by cs_file_async_wait().
+ *
+ * This is only possible for files using standard I/O in write mode
+ * (not append), when built with POSIX thread and positioned write
+ * support; otherwise, the file is left unchanged.
+ *
+ * This function is collective on the file's communicator.
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *
+ * returns:
+ *   true if asynchronous mode is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async(cs_file_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of all pending asynchronous writes.
+ *
+ * This is a local operation; errors encountered by the I/O thread since
+ * the previous call are logged and counted, then reset.
+ *
+ * returns:
+ *   number of failed asynchronous operations on this rank
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_async_wait(void);
+
+/*----------------------------------------------------------------------------
+ * Set the maximum size of data staged for asynchronous writes.
+ *
+ * When staging new data would exceed this size, writes block until
+ * enough previously staged data has been written. A single operation
+ * larger than this size is written synchronously, without staging.
+ *
+ * The default size is 256 MiB.
+ *
+ * parameters:
+ *   max_size <-- maximum staged size (in bytes), or 0 for unlimited
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_buffer_size(size_t  max_size);
+
 /*----------------------------------------------------------------------------
  * Dump the metadata of a file structure in human readable form
  *
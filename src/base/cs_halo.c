@@ -62,10 +62,51 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Structure to maintain halo exchange state */
+
+struct _cs_halo_state_t {
+
+  /* Current synchronization parameters */
+
+  const cs_halo_t  *halo;            /* Halo for which requests are defined */
+  cs_halo_type_t    sync_mode;       /* Standard or extended */
+  int               stride;          /* Number of values per element */
+  cs_real_t        *var;             /* Array to which receives are bound */
+
+  int               local_rank_id;   /* Id of local rank in halo, or -1 */
+  bool              active;          /* true if an exchange was started
+                                        but not completed */
+
+  /* Send buffer */
+
+  size_t            send_buffer_size;  /* Current send buffer size */
+  cs_real_t        *send_buffer;       /* Send buffer */
+
+#if defined(HAVE_MPI)
+
+  /* Persistent requests (receives first, sends next) */
+
+  int               n_recv_requests; /* Number of receive requests */
+  int               n_requests;      /* Total number of requests */
+  MPI_Request      *request;         /* Persistent requests */
+  MPI_Status       *status;          /* Associated status */
+
+#endif
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Default halo state for split-phase exchanges */
+
+static cs_halo_state_t  *_halo_state = NULL;
+
 /* Number of defined halos */
 
 static int _cs_glob_n_halos = 0;
@@ -99,6 +140,133 @@ static int _cs_glob_halo_use_barrier = false;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Free persistent requests associated with a halo state, and unbind it
+ * from its halo and array.
+ *
+ * parameters:
+ *   hs <-> pointer to halo state structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_state_unbind(cs_halo_state_t  *hs)
+{
+#if defined(HAVE_MPI)
+
+  for (int i = 0; i < hs->n_requests; i++)
+    MPI_Request_free(&(hs->request[i]));
+
+  hs->n_recv_requests = 0;
+  hs->n_requests = 0;
+
+#endif
+
+  hs->halo = NULL;
+  hs->var = NULL;
+  hs->stride = 0;
+  hs->local_rank_id = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Bind a halo state to a given halo, array, synchronization mode and
+ * stride, building the matching persistent requests if needed.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-- pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *   hs        <-> pointer to halo state structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_state_bind(const cs_halo_t  *halo,
+                 cs_halo_type_t    sync_mode,
+                 cs_real_t         var[],
+                 int               stride,
+                 cs_halo_state_t  *hs)
+{
+  if (   hs->halo == halo && hs->var == var
+      && hs->sync_mode == sync_mode && hs->stride == stride)
+    return;
+
+  _halo_state_unbind(hs);
+
+  hs->halo = halo;
+  hs->sync_mode = sync_mode;
+  hs->var = var;
+  hs->stride = stride;
+  hs->local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+    const int local_rank = cs_glob_rank_id;
+
+    size_t send_buffer_size
+      = halo->n_send_elts[CS_HALO_EXTENDED] * (size_t)stride;
+
+    if (send_buffer_size > hs->send_buffer_size) {
+      hs->send_buffer_size = send_buffer_size;
+      BFT_REALLOC(hs->send_buffer, hs->send_buffer_size, cs_real_t);
+    }
+
+    BFT_REALLOC(hs->request, halo->n_c_domains*2, MPI_Request);
+    BFT_REALLOC(hs->status, halo->n_c_domains*2, MPI_Status);
+
+    /* Receives from distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      cs_lnum_t start = halo->index[2*rank_id];
+      cs_lnum_t length = halo->index[2*rank_id + end_shift] - start;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+        if (length > 0)
+          MPI_Recv_init(var + (halo->n_local_elts + start)*stride,
+                        length*stride,
+                        CS_MPI_REAL,
+                        halo->c_domain_rank[rank_id],
+                        halo->c_domain_rank[rank_id],
+                        cs_glob_mpi_comm,
+                        &(hs->request[hs->n_requests++]));
+      }
+      else
+        hs->local_rank_id = rank_id;
+
+    }
+
+    hs->n_recv_requests = hs->n_requests;
+
+    /* Sends to distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length = halo->send_index[2*rank_id + end_shift] - start;
+
+        if (length > 0)
+          MPI_Send_init(hs->send_buffer + start*stride,
+                        length*stride,
+                        CS_MPI_REAL,
+                        halo->c_domain_rank[rank_id],
+                        local_rank,
+                        cs_glob_mpi_comm,
+                        &(hs->request[hs->n_requests++]));
+
+      }
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------
  * Save rotation terms of a halo to an internal buffer.
  *
@@ -776,6 +944,13 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   BFT_FREE(_halo->send_list);
 
+  /* Unbind default halo state if it refers to this halo */
+
+  if (_halo_state != NULL) {
+    if (_halo_state->halo == _halo)
+      _halo_state_unbind(_halo_state);
+  }
+
   BFT_FREE(*halo);
 
   _cs_glob_n_halos -= 1;
@@ -784,6 +959,8 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   if (_cs_glob_n_halos == 0) {
 
+    cs_halo_state_destroy(&_halo_state);
+
 #if defined(HAVE_MPI)
 
     if (cs_glob_n_ranks > 1) {
@@ -1689,6 +1866,258 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo state structure.
+ *
+ * A halo state may be used to handle a split-phase (start/wait) halo
+ * exchange, allowing other operations on local values to overlap
+ * communication.
+ *
+ * \return  pointer to created cs_halo_state_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_create(void)
+{
+  cs_halo_state_t *hs;
+  BFT_MALLOC(hs, 1, cs_halo_state_t);
+
+  hs->halo = NULL;
+  hs->sync_mode = CS_HALO_STANDARD;
+  hs->stride = 0;
+  hs->var = NULL;
+
+  hs->local_rank_id = -1;
+  hs->active = false;
+
+  hs->send_buffer_size = 0;
+  hs->send_buffer = NULL;
+
+#if defined(HAVE_MPI)
+  hs->n_recv_requests = 0;
+  hs->n_requests = 0;
+  hs->request = NULL;
+  hs->status = NULL;
+#endif
+
+  return hs;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a halo state structure.
+ *
+ * \param[in, out]  halo_state  pointer to pointer to cs_halo_state
+ *                              structure to destroy.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_state_destroy(cs_halo_state_t  **halo_state)
+{
+  if (halo_state == NULL)
+    return;
+
+  cs_halo_state_t *hs = *halo_state;
+
+  if (hs == NULL)
+    return;
+
+  if (hs->active)
+    cs_halo_sync_wait(hs->halo, hs->var, hs);
+
+  _halo_state_unbind(hs);
+
+  BFT_FREE(hs->send_buffer);
+
+#if defined(HAVE_MPI)
+  BFT_FREE(hs->request);
+  BFT_FREE(hs->status);
+#endif
+
+  BFT_FREE(*halo_state);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to default halo state structure.
+ *
+ * \return  pointer to default halo state structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_get_default(void)
+{
+  if (_halo_state == NULL)
+    _halo_state = cs_halo_state_create();
+
+  return _halo_state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start update of array of strided variable (floating-point) halo
+ *        values in case of parallelism or periodicity.
+ *
+ * Values of local elements are packed and sent, and receives into the
+ * ghost elements of the array are posted, but this function does not wait
+ * for exchanges to complete, so the halo (ghost) values of the array
+ * must not be accessed until cs_halo_sync_wait() has been called
+ * with the same halo state. Local values may be read in the meantime.
+ *
+ * Exchanges are based on persistent communication requests, which are
+ * built upon the first call, and reused as long as the halo, array,
+ * synchronization mode and stride remain the same for a given state.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in, out]  var         pointer to variable value array
+ * \param[in]       stride      number of (interlaced) values by entity
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_real_t         var[],
+                   int               stride,
+                   cs_halo_state_t  *halo_state)
+{
+  if (halo == NULL)
+    return;
+
+  cs_halo_state_t *hs
+    = (halo_state != NULL) ? halo_state : cs_halo_state_get_default();
+
+  if (hs->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: a halo exchange using the same state was started\n"
+                "and not completed (cs_halo_sync_wait not called)."),
+              __func__);
+
+  _halo_state_bind(halo, sync_mode, var, stride, hs);
+
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+#if defined(HAVE_MPI)
+
+  if (hs->n_requests > 0) {
+
+    const int local_rank = cs_glob_rank_id;
+    cs_real_t *restrict build_buffer = hs->send_buffer;
+
+    /* Post receives first */
+
+    if (hs->n_recv_requests > 0)
+      MPI_Startall(hs->n_recv_requests, hs->request);
+
+    /* Assemble buffers for halo exchange */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length =   halo->send_index[2*rank_id + end_shift]
+                           - halo->send_index[2*rank_id];
+
+        if (stride == 1) {
+          for (cs_lnum_t i = 0; i < length; i++)
+            build_buffer[start + i] = var[halo->send_list[start + i]];
+        }
+        else {
+          for (cs_lnum_t i = 0; i < length; i++) {
+            for (cs_lnum_t j = 0; j < stride; j++)
+              build_buffer[(start + i)*stride + j]
+                = var[(halo->send_list[start + i])*stride + j];
+          }
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (_cs_glob_halo_use_barrier)
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Start sends */
+
+    if (hs->n_requests > hs->n_recv_requests)
+      MPI_Startall(hs->n_requests - hs->n_recv_requests,
+                   hs->request + hs->n_recv_requests);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity (ghost values for
+     the local rank are disjoint from those being received) */
+
+  if (halo->n_transforms > 0 && hs->local_rank_id > -1) {
+
+    const int local_rank_id = hs->local_rank_id;
+
+    cs_real_t *recv_var
+      = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+    cs_lnum_t start = halo->send_index[2*local_rank_id];
+    cs_lnum_t length =   halo->send_index[2*local_rank_id + end_shift]
+                       - halo->send_index[2*local_rank_id];
+
+    for (cs_lnum_t i = 0; i < length; i++) {
+      for (cs_lnum_t j = 0; j < stride; j++)
+        recv_var[i*stride + j] = var[(halo->send_list[start + i])*stride + j];
+    }
+
+  }
+
+  hs->active = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of a halo update started with
+ *        cs_halo_sync_start().
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in, out]  var         pointer to variable value array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  cs_real_t         var[],
+                  cs_halo_state_t  *halo_state)
+{
+  if (halo == NULL)
+    return;
+
+  cs_halo_state_t *hs
+    = (halo_state != NULL) ? halo_state : cs_halo_state_get_default();
+
+  if (hs->active == false)
+    return;
+
+  assert(hs->halo == halo && hs->var == var);
+  CS_UNUSED(var);
+
+#if defined(HAVE_MPI)
+
+  if (hs->n_requests > 0)
+    MPI_Waitall(hs->n_requests, hs->request, hs->status);
+
+#endif
+
+  hs->active = false;
+}
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
@@ -154,6 +154,10 @@ typedef struct {
 
 } cs_halo_t;
 
+/* Structure to maintain halo exchange state (for split-phase exchanges) */
+
+typedef struct _cs_halo_state_t  cs_halo_state_t;
+
 /*=============================================================================
  * Global static variables
  *============================================================================*/
@@ -372,6 +376,90 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo state structure.
+ *
+ * A halo state may be used to handle a split-phase (start/wait) halo
+ * exchange, allowing other operations on local values to overlap
+ * communication.
+ *
+ * \return  pointer to created cs_halo_state_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a halo state structure.
+ *
+ * \param[in, out]  halo_state  pointer to pointer to cs_halo_state
+ *                              structure to destroy.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_state_destroy(cs_halo_state_t  **halo_state);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to default halo state structure.
+ *
+ * \return  pointer to default halo state structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_get_default(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start update of array of strided variable (floating-point) halo
+ *        values in case of parallelism or periodicity.
+ *
+ * Values of local elements are packed and sent, and receives into the
+ * ghost elements of the array are posted, but this function does not wait
+ * for exchanges to complete, so the halo (ghost) values of the array
+ * must not be accessed until cs_halo_sync_wait() has been called
+ * with the same halo state. Local values may be read in the meantime.
+ *
+ * Exchanges are based on persistent communication requests, which are
+ * built upon the first call, and reused as long as the halo, array,
+ * synchronization mode and stride remain the same for a given state.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in, out]  var         pointer to variable value array
+ * \param[in]       stride      number of (interlaced) values by entity
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_real_t         var[],
+                   int               stride,
+                   cs_halo_state_t  *halo_state);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of a halo update started with
+ *        cs_halo_sync_start().
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in, out]  var         pointer to variable value array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  cs_real_t         var[],
+                  cs_halo_state_t  *halo_state);
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
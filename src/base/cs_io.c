@@ -40,6 +40,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #undef HAVE_STDINT_H
 #if defined(__STDC_VERSION__)
 #  if (__STDC_VERSION__ >= 199901L)
@@ -110,7 +114,7 @@ typedef struct {
    *   5: index of embedded data in data array + 1 if data is
    *      embedded, 0 otherwise
    *   6: datatype id in file
-   *   7: associated file id (in case of multiple files)
+   *   7: 1 if section body is compressed, 0 otherwise
    */
 
   cs_file_off_t  *h_vals;            /* Base values associated
@@ -162,10 +166,14 @@ struct _cs_io_t {
   char               *type_name;      /* Pointer to type in section header */
   void               *data;           /* Pointer to data in section header
                                          (if embedded; NULL otherwise) */
+  bool                compressed;     /* Is current section body
+                                         compressed ? */
 
   /* Other flags */
 
   long                echo;           /* Data echo level (verbosity) */
+  int                 z_level;        /* Compression level for sections
+                                         written (0 if not compressed) */
   int                 log_id;         /* Id of log entry, or -1 */
   double              start_time;     /* Wall-clock time at open */
 
@@ -180,6 +188,17 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Compressed section bodies: minimum section size (in bytes) under which
+   sections are written uncompressed, and maximum (uncompressed) chunk size */
+
+#define CS_IO_Z_MIN_SIZE     65536
+#define CS_IO_Z_CHUNK_SIZE   1048576
+
+/* Compressed chunk codecs */
+
+#define CS_IO_Z_CODEC_RAW      0    /* Values stored as is */
+#define CS_IO_Z_CODEC_DEFLATE  1    /* Byte shuffle + deflate */
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -365,6 +384,226 @@ _convert_from_offset(unsigned char         buf[],
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Shuffle bytes of fixed-size values so that bytes of same significance
+ * are contiguous, or revert this operation.
+ *
+ * With smooth numerical fields, the most significant bytes of neighboring
+ * values vary little, so shuffled data compresses much better.
+ *
+ * parameters:
+ *   src       <-- source values
+ *   dest      --> shuffled (or unshuffled) values
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   reverse   <-- if true, unshuffle instead of shuffle
+ *----------------------------------------------------------------------------*/
+
+static void
+_z_shuffle(const unsigned char  *src,
+           unsigned char        *dest,
+           size_t                type_size,
+           size_t                n_vals,
+           bool                  reverse)
+{
+  if (reverse) {
+    for (size_t j = 0; j < type_size; j++) {
+      for (size_t i = 0; i < n_vals; i++)
+        dest[i*type_size + j] = src[j*n_vals + i];
+    }
+  }
+  else {
+    for (size_t j = 0; j < type_size; j++) {
+      for (size_t i = 0; i < n_vals; i++)
+        dest[j*n_vals + i] = src[i*type_size + j];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the maximum size of a compressed chunk.
+ *
+ * parameters:
+ *   size <-- uncompressed chunk size
+ *
+ * returns:
+ *   maximum compressed chunk size
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_z_bound(size_t  size)
+{
+#if defined(HAVE_ZLIB)
+  return compressBound(size);
+#else
+  return size;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Compress a chunk of values.
+ *
+ * If compression does not reduce the chunk size, values are copied as is.
+ *
+ * parameters:
+ *   src       <-- values to compress
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   level     <-- compression level
+ *   tmp       <-> work array (size: type_size*n_vals)
+ *   dest      --> compressed values (size: _z_bound(type_size*n_vals))
+ *   codec     --> id of codec used
+ *
+ * returns:
+ *   size of compressed chunk
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_z_compress_chunk(const unsigned char  *src,
+                  size_t                type_size,
+                  size_t                n_vals,
+                  int                   level,
+                  unsigned char        *tmp,
+                  unsigned char        *dest,
+                  cs_file_off_t        *codec)
+{
+  size_t size = type_size*n_vals;
+
+#if defined(HAVE_ZLIB)
+
+  uLongf z_size = compressBound(size);
+
+  _z_shuffle(src, tmp, type_size, n_vals, false);
+
+  if (   compress2(dest, &z_size, tmp, size, level) == Z_OK
+      && z_size < size) {
+    *codec = CS_IO_Z_CODEC_DEFLATE;
+    return z_size;
+  }
+
+#else
+
+  CS_UNUSED(level);
+  CS_UNUSED(tmp);
+
+#endif
+
+  *codec = CS_IO_Z_CODEC_RAW;
+  memcpy(dest, src, size);
+
+  return size;
+}
+
+/*----------------------------------------------------------------------------
+ * Decompress a chunk of values.
+ *
+ * parameters:
+ *   src       <-- compressed values
+ *   z_size    <-- size of compressed chunk
+ *   codec     <-- id of codec used
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   tmp       <-> work array (size: type_size*n_vals)
+ *   dest      --> decompressed values
+ *
+ * returns:
+ *   0 in case of success, 1 in case of corrupted data, 2 if the codec
+ *   is not available
+ *----------------------------------------------------------------------------*/
+
+static int
+_z_decompress_chunk(const unsigned char  *src,
+                    size_t                z_size,
+                    cs_file_off_t         codec,
+                    size_t                type_size,
+                    size_t                n_vals,
+                    unsigned char        *tmp,
+                    unsigned char        *dest)
+{
+  int retval = 0;
+  size_t size = type_size*n_vals;
+
+  if (codec == CS_IO_Z_CODEC_RAW) {
+    if (z_size == size)
+      memcpy(dest, src, size);
+    else
+      retval = 1;
+  }
+
+  else if (codec == CS_IO_Z_CODEC_DEFLATE) {
+#if defined(HAVE_ZLIB)
+    uLongf d_size = size;
+    if (   uncompress(tmp, &d_size, src, z_size) == Z_OK
+        && d_size == size)
+      _z_shuffle(tmp, dest, type_size, n_vals, true);
+    else
+      retval = 1;
+#else
+    CS_UNUSED(tmp);
+    retval = 2;
+#endif
+  }
+
+  else
+    retval = 1;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Handle an error reading a compressed section body.
+ *
+ * parameters:
+ *   errcode <-- error code returned by _z_decompress_chunk
+ *   inp     <-- input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_z_read_error(int             errcode,
+              const cs_io_t  *inp)
+{
+  if (errcode == 2)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Section \"%s\" of file \"%s\" is compressed,\n"
+                "but zlib support is not available in this build."),
+              inp->sec_name, cs_file_get_name(inp->f));
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading file \"%s\":\n"
+                "compressed section \"%s\" is corrupted."),
+              cs_file_get_name(inp->f), inp->sec_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the size of a compressed section body, and move the file pointer
+ * past this body.
+ *
+ * parameters:
+ *   offset <-- (aligned) position of section body in file
+ *   inp    <-> input kernel IO structure
+ *
+ * returns:
+ *   size of compressed section body, in bytes
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_z_skip_body(cs_file_off_t   offset,
+             cs_io_t        *inp)
+{
+  cs_file_off_t body_size = 0, z_head_buf[1];
+
+  cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
+
+  if (cs_file_read_global(inp->f, z_head_buf, 8, 1) != 1)
+    _z_read_error(1, inp);
+
+  _convert_to_offset((const unsigned char *)z_head_buf, &body_size, 1);
+
+  cs_file_seek(inp->f, offset + body_size, CS_FILE_SEEK_SET);
+
+  return body_size;
+}
+
 /*----------------------------------------------------------------------------
  * Return an empty kernel IO file structure.
  *
@@ -409,10 +648,12 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->sec_name = NULL;
   cs_io->type_name = NULL;
   cs_io->data = NULL;
+  cs_io->compressed = false;
 
   /* Verbosity and logging */
 
   cs_io->echo = echo;
+  cs_io->z_level = 0;
   cs_io->log_id = -1;
   cs_io->start_time = 0;
 
@@ -442,7 +683,7 @@ _create_index(cs_io_t *inp)
   idx->size = 0;
   idx->max_size = 32;
 
-  BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+  BFT_MALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
 
   idx->max_names_size = 256;
@@ -513,7 +754,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size = 32;
     else
       idx->max_size *= 2;
-    BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+    BFT_REALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
   };
 
@@ -544,13 +785,14 @@ _update_index_and_shift(cs_io_t             *inp,
 
   id = idx->size;
 
-  idx->h_vals[id*7]     = inp->n_vals;
-  idx->h_vals[id*7 + 1] = inp->location_id;
-  idx->h_vals[id*7 + 2] = inp->index_id;
-  idx->h_vals[id*7 + 3] = inp->n_loc_vals;
-  idx->h_vals[id*7 + 4] = idx->names_size;
-  idx->h_vals[id*7 + 5] = 0;
-  idx->h_vals[id*7 + 6] = header->type_read;
+  idx->h_vals[id*8]     = inp->n_vals;
+  idx->h_vals[id*8 + 1] = inp->location_id;
+  idx->h_vals[id*8 + 2] = inp->index_id;
+  idx->h_vals[id*8 + 3] = inp->n_loc_vals;
+  idx->h_vals[id*8 + 4] = idx->names_size;
+  idx->h_vals[id*8 + 5] = 0;
+  idx->h_vals[id*8 + 6] = header->type_read;
+  idx->h_vals[id*8 + 7] = (inp->compressed) ? 1 : 0;
 
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
@@ -565,10 +807,13 @@ _update_index_and_shift(cs_io_t             *inp,
     }
     else
       idx->offset[id] = offset;
-    cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
+    if (inp->compressed)
+      _z_skip_body(idx->offset[id], inp);
+    else
+      cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
   }
   else {
-    idx->h_vals[id*7 + 5] = idx->data_size + 1;
+    idx->h_vals[id*8 + 5] = idx->data_size + 1;
     memcpy(idx->data + idx->data_size,
            inp->data,
            new_data_size - idx->data_size);
@@ -1105,7 +1350,7 @@ _echo_data(size_t          echo,
  *----------------------------------------------------------------------------*/
 
 static void
-_cs_io_convert_read(void           *buffer,
+_cs_io_convert_read(const void     *buffer,
                     void           *dest,
                     cs_file_off_t   n_elts,
                     cs_datatype_t   buffer_type,
@@ -1131,22 +1376,22 @@ _cs_io_convert_read(void           *buffer,
           || buffer_type == CS_INT64) {
 
         if (sizeof(long) == buffer_type_size) {
-          long * _buffer = buffer;
+          const long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
             _dest[ii] = _buffer[ii];
         }
         else if (sizeof(long long) == buffer_type_size) {
-          long long * _buffer = buffer;
+          const long long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(int) == buffer_type_size) {
-          int * _buffer = buffer;
+          const int * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(short) == buffer_type_size) {
-          short * _buffer = buffer;
+          const short * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
@@ -1157,22 +1402,22 @@ _cs_io_convert_read(void           *buffer,
                || buffer_type == CS_UINT64) {
 
         if (sizeof(unsigned long) == buffer_type_size) {
-          unsigned long * _buffer = buffer;
+          const unsigned long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
             _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned long long) == buffer_type_size) {
-          unsigned long long * _buffer = buffer;
+          const unsigned long long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned int) == buffer_type_size) {
-          unsigned int * _buffer = buffer;
+          const unsigned int * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned short) == buffer_type_size) {
-          unsigned short * _buffer = buffer;
+          const unsigned short * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
@@ -1195,22 +1440,22 @@ _cs_io_convert_read(void           *buffer,
           || buffer_type == CS_INT64) {
 
         if (sizeof(long) == buffer_type_size) {
-          long * _buffer = buffer;
+          const long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
             _dest[ii] = _buffer[ii];
         }
         else if (sizeof(long long) == buffer_type_size) {
-          long long * _buffer = buffer;
+          const long long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(int) == buffer_type_size) {
-          int * _buffer = buffer;
+          const int * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(short) == buffer_type_size) {
-          short * _buffer = buffer;
+          const short * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
@@ -1221,22 +1466,22 @@ _cs_io_convert_read(void           *buffer,
                || buffer_type == CS_UINT64) {
 
         if (sizeof(unsigned long) == buffer_type_size) {
-          unsigned long * _buffer = buffer;
+          const unsigned long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
             _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned long long) == buffer_type_size) {
-          unsigned long long * _buffer = buffer;
+          const unsigned long long * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned int) == buffer_type_size) {
-          unsigned int * _buffer = buffer;
+          const unsigned int * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
         else if (sizeof(unsigned short) == buffer_type_size) {
-          unsigned short * _buffer = buffer;
+          const unsigned short * _buffer = buffer;
           for (ii = 0; ii < n_elts; ii++)
           _dest[ii] = _buffer[ii];
         }
@@ -1253,7 +1498,7 @@ _cs_io_convert_read(void           *buffer,
   case CS_FLOAT:
     {
       cs_real_t *_dest = dest;
-      double * _buffer = buffer;
+      const double * _buffer = buffer;
 
       assert(buffer_type == CS_DOUBLE);
 
@@ -1265,7 +1510,7 @@ _cs_io_convert_read(void           *buffer,
   case CS_DOUBLE:
     {
       cs_real_t *_dest = dest;
-      float * _buffer = buffer;
+      const float * _buffer = buffer;
 
       assert(buffer_type == CS_FLOAT);
 
@@ -1279,6 +1524,217 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Read a compressed section body.
+ *
+ * The body, starting at the current (aligned) file position, contains:
+ *   - the body size (in bytes) and the total number of chunks;
+ *   - for each chunk, its number of values, compressed size, and codec id;
+ *   - the compressed chunk data.
+ *
+ * For block reads in parallel, each rank reads and decompresses the chunks
+ * starting in its block, and values are then redistributed if chunk
+ * boundaries do not match those of the requested blocks (which is not
+ * needed when the block distribution is the same as when writing).
+ *
+ * parameters:
+ *   type_size <-- size of each value
+ *   val_start <-- id of first value of local block (0 to n-1 numbering)
+ *   val_end   <-- id of past-the-end value of local block
+ *   global    <-- true for a global read, false for a block read
+ *   buf       --> values read
+ *   inp       <-> input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_body_z(size_t      type_size,
+             cs_gnum_t   val_start,
+             cs_gnum_t   val_end,
+             bool        global,
+             void       *buf,
+             cs_io_t    *inp)
+{
+  int n_ranks = 1;
+  int exchange = 0;
+  size_t k0 = 0, k1 = 0, n_read = 0, max_chunk_size = 0;
+  cs_file_off_t z_head[2], z_head_buf[2];
+  cs_file_off_t *z_table = NULL, *v_idx = NULL, *b_idx = NULL;
+  unsigned char *z_data = NULL, *own = NULL, *tmp = NULL;
+
+  const cs_file_off_t body_start = cs_file_tell(inp->f);
+
+#if defined(HAVE_MPI)
+  if (inp->comm != MPI_COMM_NULL)
+    MPI_Comm_size(inp->comm, &n_ranks);
+#endif
+
+  /* Read body size, number of chunks, and chunk table */
+
+  if (cs_file_read_global(inp->f, z_head_buf, 8, 2) != 2)
+    _z_read_error(1, inp);
+
+  _convert_to_offset((const unsigned char *)z_head_buf, z_head, 2);
+
+  const size_t n_chunks = z_head[1];
+
+  BFT_MALLOC(z_data, n_chunks*24, unsigned char);
+  BFT_MALLOC(z_table, n_chunks*3, cs_file_off_t);
+
+  if (cs_file_read_global(inp->f, z_data, 8, n_chunks*3) != n_chunks*3)
+    _z_read_error(1, inp);
+
+  _convert_to_offset(z_data, z_table, n_chunks*3);
+
+  BFT_FREE(z_data);
+
+  /* Value and byte index of chunks */
+
+  BFT_MALLOC(v_idx, n_chunks + 1, cs_file_off_t);
+  BFT_MALLOC(b_idx, n_chunks + 1, cs_file_off_t);
+
+  v_idx[0] = 0;
+  b_idx[0] = 0;
+
+  for (size_t k = 0; k < n_chunks; k++) {
+    v_idx[k+1] = v_idx[k] + z_table[k*3];
+    b_idx[k+1] = b_idx[k] + z_table[k*3 + 1];
+    max_chunk_size = CS_MAX(max_chunk_size, (size_t)z_table[k*3]*type_size);
+  }
+
+  if (   v_idx[n_chunks] != inp->n_vals
+      || z_head[0] != (cs_file_off_t)(16 + n_chunks*24) + b_idx[n_chunks])
+    _z_read_error(1, inp);
+
+  /* Select chunks: in parallel, each chunk is read by the rank whose block
+     contains its first value; otherwise, chunks overlapping the block
+     are read */
+
+  if (global)
+    k1 = n_chunks;
+
+  else {
+    while (k1 < n_chunks && v_idx[k1] < (cs_file_off_t)val_end)
+      k1++;
+    if (n_ranks > 1) {
+      while (k0 < k1 && v_idx[k0] < (cs_file_off_t)val_start)
+        k0++;
+    }
+    else if (val_start < val_end) {
+      while (k0 + 1 < k1 && v_idx[k0 + 1] <= (cs_file_off_t)val_start)
+        k0++;
+    }
+    else
+      k0 = k1;
+  }
+
+  const cs_gnum_t own_start = v_idx[k0];
+  const cs_gnum_t own_end = v_idx[k1];
+
+  if (own_start != val_start || own_end != val_end)
+    exchange = 1;
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1 && global == false) {
+    int l_exchange = exchange;
+    MPI_Allreduce(&l_exchange, &exchange, 1, MPI_INT, MPI_MAX, inp->comm);
+  }
+#endif
+
+  /* Read and decompress selected chunks */
+
+  BFT_MALLOC(z_data, b_idx[k1] - b_idx[k0], unsigned char);
+
+  if (global)
+    n_read = cs_file_read_global(inp->f, z_data, 1, b_idx[n_chunks]);
+  else
+    n_read = cs_file_read_block(inp->f, z_data, 1, 1,
+                                b_idx[k0] + 1, b_idx[k1] + 1);
+
+  if (n_read != (size_t)(b_idx[k1] - b_idx[k0]))
+    _z_read_error(1, inp);
+
+  if (exchange)
+    BFT_MALLOC(own, (own_end - own_start)*type_size, unsigned char);
+  else
+    own = buf;
+
+  BFT_MALLOC(tmp, max_chunk_size, unsigned char);
+
+  for (size_t k = k0; k < k1; k++) {
+    int errcode = _z_decompress_chunk(z_data + (b_idx[k] - b_idx[k0]),
+                                      z_table[k*3 + 1],
+                                      z_table[k*3 + 2],
+                                      type_size,
+                                      z_table[k*3],
+                                      tmp,
+                                      own + (v_idx[k] - own_start)*type_size);
+    if (errcode != 0)
+      _z_read_error(errcode, inp);
+  }
+
+  BFT_FREE(tmp);
+  BFT_FREE(z_data);
+
+  /* Extract or redistribute values if chunks do not match blocks */
+
+  if (exchange && n_ranks == 1)
+    memcpy(buf,
+           own + (val_start - own_start)*type_size,
+           (val_end - val_start)*type_size);
+
+#if defined(HAVE_MPI)
+
+  else if (exchange) {
+
+    cs_gnum_t l_range[4] = {val_start, val_end, own_start, own_end};
+    cs_gnum_t *g_range = NULL;
+    int *send_count = NULL, *send_shift = NULL;
+    int *recv_count = NULL, *recv_shift = NULL;
+
+    BFT_MALLOC(g_range, n_ranks*4, cs_gnum_t);
+    BFT_MALLOC(send_count, n_ranks*4, int);
+    send_shift = send_count + n_ranks;
+    recv_count = send_count + n_ranks*2;
+    recv_shift = send_count + n_ranks*3;
+
+    MPI_Allgather(l_range, 4, CS_MPI_GNUM, g_range, 4, CS_MPI_GNUM,
+                  inp->comm);
+
+    for (int i = 0; i < n_ranks; i++) {
+      const cs_gnum_t *r = g_range + i*4;
+      cs_gnum_t s0 = CS_MAX(own_start, r[0]), s1 = CS_MIN(own_end, r[1]);
+      cs_gnum_t r0 = CS_MAX(val_start, r[2]), r1 = CS_MIN(val_end, r[3]);
+      send_count[i] = (s1 > s0) ? (s1 - s0)*type_size : 0;
+      send_shift[i] = (s1 > s0) ? (s0 - own_start)*type_size : 0;
+      recv_count[i] = (r1 > r0) ? (r1 - r0)*type_size : 0;
+      recv_shift[i] = (r1 > r0) ? (r0 - val_start)*type_size : 0;
+    }
+
+    MPI_Alltoallv(own, send_count, send_shift, MPI_BYTE,
+                  buf, recv_count, recv_shift, MPI_BYTE,
+                  inp->comm);
+
+    BFT_FREE(send_count);
+    BFT_FREE(g_range);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (exchange)
+    BFT_FREE(own);
+
+  BFT_FREE(b_idx);
+  BFT_FREE(v_idx);
+  BFT_FREE(z_table);
+
+  /* Values are stored as big-endian */
+
+  if (cs_file_get_swap_endian(inp->f) == 1 && type_size > 1)
+    _swap_endian(buf, type_size, val_end - val_start);
+
+  cs_file_seek(inp->f, body_start + z_head[0], CS_FILE_SEEK_SET);
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1323,6 +1779,7 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
   bool  convert_type = false;
   void  *_elts = NULL;
   void  *_buf = NULL;
+  const void  *_view = NULL;
   size_t  stride = 1;
 
   assert(inp  != NULL);
@@ -1390,13 +1847,33 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
-      cs_file_read_block(inp->f,
-                         _buf,
-                         type_size,
-                         stride,
-                         global_num_start,
-                         global_num_end);
+    if (inp->compressed) {
+      bool global = (global_num_start > 0 && global_num_end > 0) ? false : true;
+      cs_gnum_t val_start = (global) ? 0 : (global_num_start - 1)*stride;
+      _read_body_z(type_size, val_start, val_start + n_vals, global, _buf, inp);
+      if (log != NULL)
+        log->data_size[(global) ? 0 : 1] += n_vals*type_size;
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
+
+      /* When converting from a temporary buffer, values may be
+         converted directly from a memory-mapped file if possible */
+
+      if (_buf != _elts)
+        _view = cs_file_read_block_view(inp->f,
+                                        _buf,
+                                        type_size,
+                                        stride,
+                                        global_num_start,
+                                        global_num_end);
+      else
+        cs_file_read_block(inp->f,
+                           _buf,
+                           type_size,
+                           stride,
+                           global_num_start,
+                           global_num_end);
       if (log != NULL)
         log->data_size[1] += (global_num_end - global_num_start)*type_size;
     }
@@ -1428,7 +1905,7 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
   /* Convert data if necessary */
 
   if (convert_type == true) {
-    _cs_io_convert_read(_buf,
+    _cs_io_convert_read((_view != NULL) ? _view : _buf,
                         _elts,
                         n_vals,
                         header->type_read,
@@ -1721,8 +2198,12 @@ _write_header(const char     *sec_name,
     break;
   }
 
-  if (embed == true)
+  if (embed == true) {
     outp->type_name[7] = 'e';
+    outp->compressed = false;
+  }
+  else if (outp->compressed)
+    outp->type_name[2] = 'z';
 
   /* Section name */
 
@@ -1766,6 +2247,194 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a section's body should be written in compressed form.
+ *
+ * parameters:
+ *   n_g_vals <-- global number of values
+ *   elt_type <-- element type
+ *   outp     <-- output kernel IO structure
+ *
+ * returns:
+ *   true if section body should be compressed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_z_section(cs_gnum_t       n_g_vals,
+           cs_datatype_t   elt_type,
+           const cs_io_t  *outp)
+{
+  bool retval = false;
+
+  if (   outp->z_level > 0
+      && cs_datatype_size[elt_type] <= 8
+      && n_g_vals*cs_datatype_size[elt_type] >= CS_IO_Z_MIN_SIZE)
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a compressed section body.
+ *
+ * Values are split in chunks which are compressed independently, and
+ * never span several blocks, so that each rank compresses its own block
+ * and the file may be read in parallel using a similar block distribution.
+ * The body (see _read_body_z) is written at the current file position,
+ * which should be aligned.
+ *
+ * Under MPI, for global values, data is only compressed and written by
+ * the associated communicator's root rank.
+ *
+ * parameters:
+ *   elts      <-- pointer to local element data
+ *   type_size <-- size of each value
+ *   n_vals    <-- local number of values
+ *   global    <-- true for global values, false for a block write
+ *   outp      <-> output kernel IO structure
+ *
+ * returns:
+ *   local number of bytes written
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_write_body_z(const void  *elts,
+              size_t       type_size,
+              size_t       n_vals,
+              bool         global,
+              cs_io_t     *outp)
+{
+  int rank_id = 0, n_ranks = 1;
+  int errcode = 0;
+  size_t n_written = 0;
+  cs_gnum_t z_count[2] = {0, 0}, z_start[2] = {0, 0}, z_tot[2] = {0, 0};
+  cs_file_off_t z_head[2], z_head_buf[2];
+  cs_file_off_t *z_table = NULL;
+  unsigned char *z_table_buf = NULL, *z_data = NULL;
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(outp->comm, &rank_id);
+    MPI_Comm_size(outp->comm, &n_ranks);
+  }
+#endif
+
+  /* Compress local values (on root rank only for global values) */
+
+  if (global == false || rank_id == 0) {
+
+    const size_t chunk_size = CS_IO_Z_CHUNK_SIZE / type_size;
+    const size_t n_chunks = (n_vals + chunk_size - 1) / chunk_size;
+    const size_t tmp_size = CS_MIN(n_vals, chunk_size) * type_size;
+
+    const unsigned char *src = elts;
+    unsigned char *_src = NULL, *tmp = NULL;
+    size_t z_size = 0;
+
+    /* Values are stored as big-endian */
+
+    if (cs_file_get_swap_endian(outp->f) == 1 && type_size > 1) {
+      BFT_MALLOC(_src, n_vals*type_size, unsigned char);
+      memcpy(_src, elts, n_vals*type_size);
+      _swap_endian(_src, type_size, n_vals);
+      src = _src;
+    }
+
+    BFT_MALLOC(z_table, n_chunks*3, cs_file_off_t);
+    BFT_MALLOC(z_data, n_chunks*_z_bound(tmp_size), unsigned char);
+    BFT_MALLOC(tmp, tmp_size, unsigned char);
+
+    for (size_t k = 0; k < n_chunks; k++) {
+      size_t s_id = k*chunk_size;
+      size_t c_n_vals = CS_MIN(chunk_size, n_vals - s_id);
+      z_table[k*3] = c_n_vals;
+      z_table[k*3 + 1] = _z_compress_chunk(src + s_id*type_size,
+                                           type_size,
+                                           c_n_vals,
+                                           outp->z_level,
+                                           tmp,
+                                           z_data + z_size,
+                                           z_table + k*3 + 2);
+      z_size += z_table[k*3 + 1];
+    }
+
+    BFT_FREE(tmp);
+    BFT_FREE(_src);
+
+    BFT_MALLOC(z_table_buf, n_chunks*24, unsigned char);
+    _convert_from_offset(z_table_buf, z_table, n_chunks*3);
+    BFT_FREE(z_table);
+
+    z_count[0] = n_chunks;
+    z_count[1] = z_size;
+  }
+
+  /* Global chunk and byte counts, and position of local block */
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+    if (global)
+      MPI_Bcast(z_count, 2, CS_MPI_GNUM, 0, outp->comm);
+    else {
+      MPI_Scan(z_count, z_start, 2, CS_MPI_GNUM, MPI_SUM, outp->comm);
+      MPI_Allreduce(z_count, z_tot, 2, CS_MPI_GNUM, MPI_SUM, outp->comm);
+      z_start[0] -= z_count[0];
+      z_start[1] -= z_count[1];
+    }
+  }
+#endif
+
+  if (global || n_ranks == 1) {
+    z_tot[0] = z_count[0];
+    z_tot[1] = z_count[1];
+  }
+
+  /* Write body size, number of chunks, chunk table, and chunk data */
+
+  z_head[0] = 16 + (cs_file_off_t)(z_tot[0])*24 + (cs_file_off_t)(z_tot[1]);
+  z_head[1] = z_tot[0];
+
+  _convert_from_offset((unsigned char *)z_head_buf, z_head, 2);
+
+  if (cs_file_write_global(outp->f, z_head_buf, 8, 2) != 2)
+    errcode = 1;
+
+  if (global) {
+    if (cs_file_write_global(outp->f, z_table_buf, 8, z_tot[0]*3)
+        != z_tot[0]*3)
+      errcode = 1;
+    if (cs_file_write_global(outp->f, z_data, 1, z_tot[1]) != z_tot[1])
+      errcode = 1;
+  }
+  else {
+    if (cs_file_write_block_buffer(outp->f, z_table_buf, 8, 3,
+                                   z_start[0] + 1,
+                                   z_start[0] + z_count[0] + 1)
+        != z_count[0]*3)
+      errcode = 1;
+    if (cs_file_write_block_buffer(outp->f, z_data, 1, 1,
+                                   z_start[1] + 1,
+                                   z_start[1] + z_count[1] + 1)
+        != z_count[1])
+      errcode = 1;
+  }
+
+  if (errcode != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing compressed section to file \"%s\"."),
+              cs_file_get_name(outp->f));
+
+  BFT_FREE(z_data);
+  BFT_FREE(z_table_buf);
+
+  if (rank_id == 0)
+    n_written = 16 + z_count[0]*24 + z_count[1];
+  else if (global == false)
+    n_written = z_count[0]*24 + z_count[1];
+
+  return n_written;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -1782,23 +2451,25 @@ _dump_index(const cs_io_sec_index_t  *idx)
 
   bft_printf(_(" %llu indexed records:\n"
                "   (name, n_vals, location_id, index_id, n_loc_vals, type, "
-               "embed, file_id, offset)\n\n"),
+               "embed, compressed, offset)\n\n"),
              (unsigned long long)(idx->size));
 
   for (ii = 0; ii < idx->size; ii++) {
 
-    char embed = 'n';
-    cs_file_off_t *h_vals = idx->h_vals + ii*7;
+    char embed = 'n', compressed = 'n';
+    cs_file_off_t *h_vals = idx->h_vals + ii*8;
     const char *name = idx->names + h_vals[4];
 
     if (h_vals[5] > 0)
       embed = 'y';
+    if (h_vals[7] > 0)
+      compressed = 'y';
 
-    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %2u %ld\n"),
+    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %c %ld\n"),
                name, (unsigned long long)(h_vals[0]),
                (unsigned)(h_vals[1]), (unsigned)(h_vals[2]),
                (unsigned)(h_vals[3]), cs_datatype_name[h_vals[6]],
-               embed, (unsigned)(h_vals[7]),
+               embed, compressed,
                (long)(idx->offset[ii]));
 
   }
@@ -2055,7 +2726,7 @@ cs_io_get_indexed_sec_name(const cs_io_t  *inp,
 
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
       retval = inp->index->names + name_id;
     }
   }
@@ -2085,15 +2756,15 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
 
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
 
       h.sec_name = inp->index->names + name_id;
 
-      h.n_vals          = inp->index->h_vals[7*id];
-      h.location_id     = inp->index->h_vals[7*id + 1];
-      h.index_id        = inp->index->h_vals[7*id + 2];
-      h.n_location_vals = inp->index->h_vals[7*id + 3];
-      h.type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+      h.n_vals          = inp->index->h_vals[8*id];
+      h.location_id     = inp->index->h_vals[8*id + 1];
+      h.index_id        = inp->index->h_vals[8*id + 2];
+      h.n_location_vals = inp->index->h_vals[8*id + 3];
+      h.type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
       h.elt_type        = _type_read_to_elt_type(h.type_read);
     }
   }
@@ -2125,6 +2796,71 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Switch a kernel IO structure open for writing to asynchronous mode.
+ *
+ * Data is then staged and written by a background thread, and the file
+ * is closed by that thread once written (see cs_file_set_async()).
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   outp <-> output kernel IO structure
+ *
+ * returns:
+ *   true if asynchronous mode is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async(cs_io_t  *outp)
+{
+  assert(outp != NULL);
+
+  if (outp->mode != CS_IO_MODE_WRITE)
+    return false;
+
+  return cs_file_set_async(outp->f);
+}
+
+/*----------------------------------------------------------------------------
+ * Set the compression level of sections written to a kernel IO structure.
+ *
+ * Sections whose global size is large enough are then written with a
+ * compressed body: values are split in chunks which are compressed
+ * independently and never span several ranks' blocks, so sections may
+ * still be read by blocks in parallel. Compressed sections are flagged
+ * in their header, and are read transparently by cs_io_read_global()
+ * and cs_io_read_block().
+ *
+ * Compression requires zlib support; if not available, sections are
+ * written uncompressed.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   level <-- compression level (0 for none, 1 for fastest to 9 for best)
+ *
+ * returns:
+ *   true if compression is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_compression(cs_io_t  *outp,
+                      int       level)
+{
+  assert(outp != NULL);
+
+  outp->z_level = 0;
+
+#if defined(HAVE_ZLIB)
+  if (outp->mode == CS_IO_MODE_WRITE && level > 0)
+    outp->z_level = CS_MIN(level, 9);
+#else
+  CS_UNUSED(level);
+#endif
+
+  return (outp->z_level > 0) ? true : false;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2217,12 +2953,20 @@ cs_io_read_header(cs_io_t             *inp,
   inp->n_loc_vals = header_vals[4];
   inp->type_size = 0;
   inp->data = NULL;
+  inp->compressed = false;
   inp->type_name = (char *)(inp->buffer + 48);
   inp->sec_name = (char *)(inp->buffer + 56);
 
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  /* Compressed bodies are flagged by a 'z' following the type name
+     (so that readers not handling compression reject the section) */
+
+  if (   header_vals[1] > 0 && inp->data == NULL
+      && inp->type_name[2] == 'z')
+    inp->compressed = true;
+
   inp->type_size = 0;
 
   /* Return immediately if we have an end-of file marker */
@@ -2282,8 +3026,16 @@ cs_io_read_header(cs_io_t             *inp,
 
   if (header->n_vals != 0) {
 
+    char z_type_name[3];
     const char *elt_type_name = inp->type_name;
 
+    if (inp->compressed) {
+      z_type_name[0] = inp->type_name[0];
+      z_type_name[1] = inp->type_name[1];
+      z_type_name[2] = '\0';
+      elt_type_name = z_type_name;
+    }
+
     if (   strcmp(elt_type_name, _type_name_i4) == 0
         || strcmp(elt_type_name, "i ") == 0)
       header->type_read = CS_INT32;
@@ -2364,13 +3116,13 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   if (id >= inp->index->size)
     return 1;
 
-  header->sec_name = inp->index->names + inp->index->h_vals[7*id + 4];
+  header->sec_name = inp->index->names + inp->index->h_vals[8*id + 4];
 
-  header->n_vals          = inp->index->h_vals[7*id];
-  header->location_id     = inp->index->h_vals[7*id + 1];
-  header->index_id        = inp->index->h_vals[7*id + 2];
-  header->n_location_vals = inp->index->h_vals[7*id + 3];
-  header->type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+  header->n_vals          = inp->index->h_vals[8*id];
+  header->location_id     = inp->index->h_vals[8*id + 1];
+  header->index_id        = inp->index->h_vals[8*id + 2];
+  header->n_location_vals = inp->index->h_vals[8*id + 3];
+  header->type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
   header->elt_type        = _type_read_to_elt_type(header->type_read);
 
   inp->n_vals      = header->n_vals;
@@ -2378,6 +3130,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   inp->index_id    = header->index_id;
   inp->n_loc_vals  = header->n_location_vals;
   inp->type_size   = cs_datatype_size[header->type_read];
+  inp->compressed  = (inp->index->h_vals[8*id + 7] > 0) ? true : false;
 
   /* The following values are not taken from the header buffer as
      usual, but are base on the index */
@@ -2388,7 +3141,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
 
   /* Non-embedded values */
 
-  if (inp->index->h_vals[7*id + 5] == 0) {
+  if (inp->index->h_vals[8*id + 5] == 0) {
     cs_file_off_t offset = inp->index->offset[id];
     retval = cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
   }
@@ -2396,7 +3149,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   /* Embedded values */
 
   else {
-    size_t data_id = inp->index->h_vals[7*id + 5] - 1;
+    size_t data_id = inp->index->h_vals[8*id + 5] - 1;
     unsigned char *_data = inp->index->data + data_id;
     inp->data = _data;
   }
@@ -2778,6 +3531,8 @@ cs_io_write_global(const char     *sec_name,
   if (outp->echo >= CS_IO_ECHO_HEADERS)
     _echo_header(sec_name, n_vals, elt_type);
 
+  outp->compressed = _z_section(n_vals, elt_type, outp);
+
   embed = _write_header(sec_name,
                         n_vals,
                         location_id,
@@ -2800,23 +3555,36 @@ cs_io_write_global(const char     *sec_name,
 
     _write_padding(outp->body_align, outp);
 
-    n_written = cs_file_write_global(outp->f,
-                                     elts,
-                                     cs_datatype_size[elt_type],
-                                     n_vals);
+    if (outp->compressed)
+      n_written = _write_body_z(elts,
+                                cs_datatype_size[elt_type],
+                                n_vals,
+                                true,
+                                outp);
 
-    if (n_vals != (cs_gnum_t)n_written)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Error writing %llu bytes to file \"%s\"."),
-                (unsigned long long)n_vals, cs_file_get_name(outp->f));
+    else {
+      n_written = cs_file_write_global(outp->f,
+                                       elts,
+                                       cs_datatype_size[elt_type],
+                                       n_vals);
+
+      if (n_vals != (cs_gnum_t)n_written)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Error writing %llu bytes to file \"%s\"."),
+                  (unsigned long long)n_vals, cs_file_get_name(outp->f));
+
+      n_written *= cs_datatype_size[elt_type];
+    }
 
     if (log != NULL) {
       double t_end = cs_timer_wtime();
       log->wtimes[0] += t_end - t_start;
-      log->data_size[0] += n_written*cs_datatype_size[elt_type];
+      log->data_size[0] += n_written;
     }
   }
 
+  outp->compressed = false;
+
   if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
     _echo_data(outp->echo, n_vals, 1, n_vals + 1, elt_type, elts);
 }
@@ -2867,7 +3635,7 @@ cs_io_write_block(const char     *sec_name,
                   cs_io_t        *outp)
 {
   double t_start = 0.;
-  size_t n_written = 0;
+  size_t n_written = 0, n_bytes = 0;
   size_t n_g_vals = n_g_elts;
   size_t n_vals = global_num_end - global_num_start;
   size_t stride = 1;
@@ -2879,6 +3647,8 @@ cs_io_write_block(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  outp->compressed = _z_section(n_g_vals, elt_type, outp);
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2895,22 +3665,35 @@ cs_io_write_block(const char     *sec_name,
 
   _write_padding(outp->body_align, outp);
 
-  n_written = cs_file_write_block(outp->f,
-                                  elts,
-                                  cs_datatype_size[elt_type],
-                                  stride,
-                                  global_num_start,
-                                  global_num_end);
+  if (outp->compressed)
+    n_bytes = _write_body_z(elts,
+                            cs_datatype_size[elt_type],
+                            n_vals,
+                            false,
+                            outp);
 
-  if (n_vals != (cs_gnum_t)n_written)
-    bft_error(__FILE__, __LINE__, 0,
-              _("Error writing %llu bytes to file \"%s\"."),
-              (unsigned long long)n_vals, cs_file_get_name(outp->f));
+  else {
+    n_written = cs_file_write_block(outp->f,
+                                    elts,
+                                    cs_datatype_size[elt_type],
+                                    stride,
+                                    global_num_start,
+                                    global_num_end);
+
+    if (n_vals != (cs_gnum_t)n_written)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error writing %llu bytes to file \"%s\"."),
+                (unsigned long long)n_vals, cs_file_get_name(outp->f));
+
+    n_bytes = n_written*cs_datatype_size[elt_type];
+  }
+
+  outp->compressed = false;
 
   if (log != NULL) {
     double t_end = cs_timer_wtime();
     log->wtimes[1] += t_end - t_start;
-    log->data_size[1] += n_written*cs_datatype_size[elt_type];
+    log->data_size[1] += n_bytes;
   }
 
   if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
@@ -2968,7 +3751,7 @@ cs_io_write_block_buffer(const char     *sec_name,
                          cs_io_t        *outp)
 {
   double t_start = 0.;
-  size_t n_written = 0;
+  size_t n_written = 0, n_bytes = 0;
   size_t n_g_vals = n_g_elts;
   size_t n_vals = global_num_end - global_num_start;
   size_t stride = 1;
@@ -2980,6 +3763,8 @@ cs_io_write_block_buffer(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  outp->compressed = _z_section(n_g_vals, elt_type, outp);
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2996,22 +3781,35 @@ cs_io_write_block_buffer(const char     *sec_name,
 
   _write_padding(outp->body_align, outp);
 
-  n_written = cs_file_write_block_buffer(outp->f,
-                                          elts,
-                                          cs_datatype_size[elt_type],
-                                          stride,
-                                          global_num_start,
-                                          global_num_end);
+  if (outp->compressed)
+    n_bytes = _write_body_z(elts,
+                            cs_datatype_size[elt_type],
+                            n_vals,
+                            false,
+                            outp);
 
-  if (n_vals != (cs_gnum_t)n_written)
-    bft_error(__FILE__, __LINE__, 0,
-              _("Error writing %llu bytes to file \"%s\"."),
-              (unsigned long long)n_vals, cs_file_get_name(outp->f));
+  else {
+    n_written = cs_file_write_block_buffer(outp->f,
+                                           elts,
+                                           cs_datatype_size[elt_type],
+                                           stride,
+                                           global_num_start,
+                                           global_num_end);
+
+    if (n_vals != (cs_gnum_t)n_written)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error writing %llu bytes to file \"%s\"."),
+                (unsigned long long)n_vals, cs_file_get_name(outp->f));
+
+    n_bytes = n_written*cs_datatype_size[elt_type];
+  }
+
+  outp->compressed = false;
 
   if (log != NULL) {
     double t_end = cs_timer_wtime();
     log->wtimes[1] += t_end - t_start;
-    log->data_size[1] += n_written*cs_datatype_size[elt_type];
+    log->data_size[1] += n_bytes;
   }
 
   if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
@@ -3060,8 +3858,12 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
-      cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
+      if (pp_io->compressed)
+        _z_skip_body(offset, pp_io);
+      else {
+        offset += n_vals*type_size;
+        cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
+      }
     }
 
     pp_io->data = NULL; /* Reset for next read */
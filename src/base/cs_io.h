@@ -259,6 +259,46 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Switch a kernel IO structure open for writing to asynchronous mode.
+ *
+ * Data is then staged and written by a background thread, and the file
+ * is closed by that thread once written (see cs_file_set_async()).
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   outp <-> output kernel IO structure
+ *
+ * returns:
+ *   true if asynchronous mode is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async(cs_io_t  *outp);
+
+/*----------------------------------------------------------------------------
+ * Set the compression level of sections written to a kernel IO structure.
+ *
+ * Sections whose global size is large enough are then written with a
+ * compressed body, split in chunks which never span several ranks' blocks,
+ * and are read transparently by cs_io_read_global() and cs_io_read_block().
+ *
+ * Compression requires zlib support; if not available, sections are
+ * written uncompressed.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   level <-- compression level (0 for none, 1 for fastest to 9 for best)
+ *
+ * returns:
+ *   true if compression is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_compression(cs_io_t  *outp,
+                      int       level);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
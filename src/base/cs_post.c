@@ -3325,6 +3325,8 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b plot (comma or whitespace separated 2d plot files)
  * - \c \b time_plot (comma or whitespace separated time plot files)
+ * - \c \b reduced (decimated and quantized binary files, for frequent
+ *         outputs of large meshes)
  *
  * The format name is case-sensitive, so \c \b ensight or \c \b cgns are also valid.
  *
@@ -3351,6 +3353,19 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b divide_polyhedra} to divide elements which are neither tetrahedra,
  *         prisms, pyramids nor hexahedra into simpler elements (tetrahedra and
  *         pyramids), so that any post-processing tool can recognize them.
+ * - \c \b rank_order to write elements in rank order, each rank writing
+ *         its own partition directly, which avoids redistributing element
+ *         data in parallel (for binary \c \b EnSight); element ordering
+ *         then depends on the partitioning. Sections with elements shared
+ *         by several ranks (such as interior faces on partition boundaries)
+ *         are still written in global number order.
+ * - \c \b bits=n to quantize values using 8 or 16 (default) bits per
+ *         value, with an offset and scale for each block of samples,
+ *         or 32 for unquantized values (for \c \b reduced).
+ * - \c \b decimate=n to output only every nth vertex or element along
+ *         a Peano-Hilbert curve (for \c \b reduced).
+ * - \c \b block_size=n to set the number of samples per quantization
+ *         block (1024 by default, for \c \b reduced).
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
  *
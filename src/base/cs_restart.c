@@ -191,6 +191,23 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+
+/* Asynchronous checkpoint writes (files are written with a temporary
+   suffix, and renamed once their completion is collectively checked) */
+
+static bool    _checkpoint_async = false;         /* asynchronous mode */
+static int     _checkpoint_async_n_files = 0;     /* number of pending files */
+static char  **_checkpoint_async_name = NULL;     /* final names of pending
+                                                     files */
+static bool   *_checkpoint_async_closed = NULL;   /* closed flag of pending
+                                                     files */
+
+static const char _checkpoint_async_suffix[] = ".async";
+
+/* Compression level for sections of checkpoint files (0 if none) */
+
+static int     _checkpoint_z_level = 0;
+
 /* Are we restarting from a NCFD file ? */
 static int    _restart_from_ncfd = 0;
 
@@ -299,6 +316,111 @@ _locations_from_index(cs_restart_t  *r)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build the temporary name used for a file written asynchronously.
+ *
+ * The returned string must be freed by the caller.
+ *
+ * parameters:
+ *   name <-- final file name
+ *
+ * returns:
+ *   pointer to allocated temporary file name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_async_tmp_name(const char  *name)
+{
+  char *tmp_name = NULL;
+
+  BFT_MALLOC(tmp_name,
+             strlen(name) + strlen(_checkpoint_async_suffix) + 1,
+             char);
+
+  strcpy(tmp_name, name);
+  strcat(tmp_name, _checkpoint_async_suffix);
+
+  return tmp_name;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the id of a pending asynchronously written file.
+ *
+ * parameters:
+ *   name <-- final file name
+ *
+ * returns:
+ *   id of matching pending file, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_async_file_id(const char  *name)
+{
+  for (int i = 0; i < _checkpoint_async_n_files; i++) {
+    if (strcmp(_checkpoint_async_name[i], name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous checkpoint writes.
+ *
+ * Errors on any rank are fatal. Otherwise, completed (i.e. closed) files
+ * replace those of the previous checkpoint.
+ *
+ * This function is collective.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(void)
+{
+  int n_errors = cs_file_async_wait();
+
+  cs_parall_max(1, CS_INT_TYPE, &n_errors);
+
+  if (n_errors > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing checkpoint files asynchronously.\n"
+                "Incomplete files have a \"%s\" suffix, and files from the\n"
+                "previous checkpoint have not been replaced."),
+              _checkpoint_async_suffix);
+
+  int n_pending = 0;
+
+  for (int i = 0; i < _checkpoint_async_n_files; i++) {
+
+    char *name = _checkpoint_async_name[i];
+
+    if (_checkpoint_async_closed[i] == false) {
+      _checkpoint_async_name[n_pending] = name;
+      _checkpoint_async_closed[n_pending] = false;
+      n_pending++;
+      continue;
+    }
+
+    if (cs_glob_rank_id < 1) {
+      char *tmp_name = _async_tmp_name(name);
+      if (rename(tmp_name, name) != 0)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error renaming checkpoint file \"%s\" to \"%s\"."),
+                  tmp_name, name);
+      BFT_FREE(tmp_name);
+    }
+
+    BFT_FREE(name);
+
+  }
+
+  _checkpoint_async_n_files = n_pending;
+
+  if (n_pending == 0) {
+    BFT_FREE(_checkpoint_async_name);
+    BFT_FREE(_checkpoint_async_closed);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a checkpoint / restart file management structure;
  *
@@ -312,11 +434,26 @@ _add_file(cs_restart_t  *r)
   double timing[2];
   cs_file_access_t method;
 
+  char *tmp_name = NULL;
+  const char *file_name = r->name;
+
   const char magic_string[] = "Checkpoint / restart, R0";
   const long echo = CS_IO_ECHO_NONE;
 
   timing[0] = cs_timer_wtime();
 
+  /* In asynchronous write mode, ensure the previous checkpoint is complete
+     before writing the next one, and write to a temporary file */
+
+  if (r->mode == CS_RESTART_MODE_WRITE) {
+    if (_async_file_id(r->name) > -1)
+      _async_wait();
+    if (_checkpoint_async) {
+      tmp_name = _async_tmp_name(r->name);
+      file_name = tmp_name;
+    }
+  }
+
   /* In read mode, open file to detect header first */
 
 #if defined(HAVE_MPI)
@@ -345,7 +482,9 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
-      r->fh = cs_io_initialize(r->name,
+      if (tmp_name != NULL)
+        method = CS_FILE_STDIO_SERIAL;
+      r->fh = cs_io_initialize(file_name,
                                magic_string,
                                CS_IO_MODE_WRITE,
                                method,
@@ -367,7 +506,9 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
-      r->fh = cs_io_initialize(r->name,
+      if (tmp_name != NULL)
+        method = CS_FILE_STDIO_SERIAL;
+      r->fh = cs_io_initialize(file_name,
                                magic_string,
                                CS_IO_MODE_WRITE,
                                method,
@@ -376,6 +517,40 @@ _add_file(cs_restart_t  *r)
   }
 #endif
 
+  /* Optional compression of large sections */
+
+  if (r->mode == CS_RESTART_MODE_WRITE && _checkpoint_z_level > 0) {
+    if (cs_io_set_compression(r->fh, _checkpoint_z_level) == false) {
+      bft_printf(_("\n"
+                   "Compressed checkpoint files are not available\n"
+                   "in this build (zlib support is required);\n"
+                   "checkpoint files are written uncompressed.\n"));
+      _checkpoint_z_level = 0;
+    }
+  }
+
+  /* Switch to asynchronous writes and register file for renaming */
+
+  if (tmp_name != NULL) {
+
+    if (cs_io_set_async(r->fh) == false) {
+      bft_printf(_("\n"
+                   "Asynchronous checkpoint writes are not available\n"
+                   "in this build; checkpoint files are written synchronously.\n"));
+      _checkpoint_async = false;
+    }
+
+    int i = _checkpoint_async_n_files;
+    _checkpoint_async_n_files += 1;
+    BFT_REALLOC(_checkpoint_async_name, _checkpoint_async_n_files, char *);
+    BFT_REALLOC(_checkpoint_async_closed, _checkpoint_async_n_files, bool);
+    BFT_MALLOC(_checkpoint_async_name[i], strlen(r->name) + 1, char);
+    strcpy(_checkpoint_async_name[i], r->name);
+    _checkpoint_async_closed[i] = false;
+
+    BFT_FREE(tmp_name);
+  }
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[r->mode] += timing[1] - timing[0];
 
@@ -1737,6 +1912,53 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, data written to checkpoint files is copied to
+ * staging buffers and written to disk by a background I/O thread, so time
+ * stepping may continue while the checkpoint is being written. Files are
+ * written with a temporary suffix, and only replace those of the previous
+ * checkpoint once all ranks have completed writing them without errors,
+ * either before a file of the same name is written again or when
+ * \ref cs_restart_checkpoint_wait is called.
+ *
+ * Memory used for staging may be bounded using
+ * \ref cs_file_set_async_buffer_size.
+ *
+ * \param[in]  async  true for asynchronous writes, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  _checkpoint_async = async;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the compression level of checkpoint files.
+ *
+ * Large sections of checkpoint files are then written in compressed form,
+ * using independently compressed chunks within each rank's block, so
+ * that they may still be read in parallel. Reading compressed sections
+ * is transparent, and files may be read with a different number of ranks.
+ *
+ * Compression requires zlib support; it is ignored otherwise.
+ *
+ * \param[in]  level  compression level (0 for none, 1 for fastest,
+ *                    up to 9 for best)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(int  level)
+{
+  _checkpoint_z_level = level;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -1902,6 +2124,35 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of asynchronous checkpoint writes.
+ *
+ * Files for which writing completed on all ranks replace those of the
+ * previous checkpoint. If writing failed on any rank, an error is
+ * generated, and files of the previous checkpoint are kept.
+ *
+ * This function is collective, and does nothing if no asynchronous
+ * writes are pending.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void)
+{
+  if (_checkpoint_async_n_files == 0)
+    return;
+
+  double timing[2];
+
+  timing[0] = cs_timer_wtime();
+
+  _async_wait();
+
+  timing[1] = cs_timer_wtime();
+  _restart_wtime[CS_RESTART_MODE_WRITE] += timing[1] - timing[0];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
@@ -2075,6 +2326,12 @@ cs_restart_destroy(cs_restart_t  **restart)
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
+  if (mode == CS_RESTART_MODE_WRITE) {
+    int async_id = _async_file_id(r->name);
+    if (async_id > -1)
+      _checkpoint_async_closed[async_id] = true;
+  }
+
   /* Free locations array */
 
   if (r->n_locations > 0) {
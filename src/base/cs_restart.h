@@ -314,6 +314,47 @@ cs_restart_checkpoint_set_defaults(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, data written to checkpoint files is copied to
+ * staging buffers and written to disk by a background I/O thread, so time
+ * stepping may continue while the checkpoint is being written. Files are
+ * written with a temporary suffix, and only replace those of the previous
+ * checkpoint once all ranks have completed writing them without errors,
+ * either before a file of the same name is written again or when
+ * \ref cs_restart_checkpoint_wait is called.
+ *
+ * Memory used for staging may be bounded using
+ * \ref cs_file_set_async_buffer_size.
+ *
+ * \param[in]  async  true for asynchronous writes, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the compression level of checkpoint files.
+ *
+ * Large sections of checkpoint files are then written in compressed form,
+ * using independently compressed chunks within each rank's block, so
+ * that they may still be read in parallel. Reading compressed sections
+ * is transparent, and files may be read with a different number of ranks.
+ *
+ * Compression requires zlib support; it is ignored otherwise.
+ *
+ * \param[in]  level  compression level (0 for none, 1 for fastest,
+ *                    up to 9 for best)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(int  level);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -385,6 +426,22 @@ cs_restart_checkpoint_required(const cs_time_step_t  *ts);
 void
 cs_restart_checkpoint_done(const cs_time_step_t  *ts);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of asynchronous checkpoint writes.
+ *
+ * Files for which writing completed on all ranks replace those of the
+ * previous checkpoint. If writing failed on any rank, an error is
+ * generated, and files of the previous checkpoint are kept.
+ *
+ * This function is collective, and does nothing if no asynchronous
+ * writes are pending.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
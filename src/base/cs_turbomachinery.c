@@ -49,6 +49,7 @@
 #include "cs_coupling.h"
 #include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_field_operator.h"
 #include "cs_gradient.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
@@ -1125,6 +1126,7 @@ _update_mesh(bool     restart_mode,
   }
 
   cs_gradient_free_quantities();
+  cs_field_gradient_cache_clear();
   cs_cell_to_vertex_free();
   cs_mesh_adjacencies_update_mesh();
 
@@ -387,6 +387,29 @@ module field
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function marking field values as modified
+
+    subroutine cs_field_update_state(f)  &
+      bind(C, name='cs_field_update_state')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      type(c_ptr), value :: f
+    end subroutine cs_field_update_state
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function marking field boundary condition coefficients
+    ! as modified
+
+    subroutine cs_field_update_bc_state(f)  &
+      bind(C, name='cs_field_update_bc_state')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      type(c_ptr), value :: f
+    end subroutine cs_field_update_bc_state
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function returning field's value pointer and dimensions.
 
     ! If the field id is not valid, a fatal error is provoked.
@@ -1228,6 +1251,72 @@ contains
 
   !=============================================================================
 
+  !> \brief  Mark field values as modified.
+
+  !> This must be called when values are modified directly (i.e. not by
+  !> an equation solver or a field API function), so that derived
+  !> quantities such as cached gradients are not reused.
+
+  !> \param[in]  id  field id
+
+  subroutine field_update_state(id)
+
+    use, intrinsic :: iso_c_binding
+    implicit none
+
+    ! Arguments
+
+    integer, intent(in) :: id
+
+    ! Local variables
+
+    integer(c_int) :: c_id
+    type(c_ptr)    :: f
+
+    c_id = id
+
+    f = cs_field_by_id(c_id)
+    call cs_field_update_state(f)
+
+    return
+
+  end subroutine field_update_state
+
+  !=============================================================================
+
+  !> \brief  Mark field boundary condition coefficients as modified.
+
+  !> This must be called when boundary condition coefficients are modified
+  !> directly, so that derived quantities such as cached gradients are
+  !> not reused.
+
+  !> \param[in]  id  field id
+
+  subroutine field_update_bc_state(id)
+
+    use, intrinsic :: iso_c_binding
+    implicit none
+
+    ! Arguments
+
+    integer, intent(in) :: id
+
+    ! Local variables
+
+    integer(c_int) :: c_id
+    type(c_ptr)    :: f
+
+    c_id = id
+
+    f = cs_field_by_id(c_id)
+    call cs_field_update_bc_state(f)
+
+    return
+
+  end subroutine field_update_bc_state
+
+  !=============================================================================
+
   !> \brief  Query if a given key has been set for a field.
 
   !> If the key id is not valid, or the field category is not
@@ -500,6 +500,8 @@ call predvv &
 ! Bad cells regularisation
 call cs_bad_cells_regularisation_vector(vel, 1)
 
+call field_update_state(ivarfl(iu))
+
 ! --- Sortie si pas de pression continuite
 !       on met a jour les flux de masse, et on sort
 
@@ -1201,6 +1203,11 @@ endif
 ! Bad cells regularisation
 call cs_bad_cells_regularisation_vector(vel, 1)
 
+! Velocity values (and pressure outlet boundary conditions with
+! hydrostatic pressure) were modified in place
+call field_update_state(ivarfl(iu))
+if (iphydr.eq.1) call field_update_bc_state(ivarfl(ipr))
+
 ! Mass flux initialization for VOF algorithm
 if (ivofmt.gt.0) then
   do ifac = 1, nfac
@@ -2241,6 +2241,8 @@ else
   enddo
 endif
 
+call field_update_state(ivarfl(ipr))
+
 ! Transformation of volumic mass fluxes into massic mass fluxes
 if (idilat.eq.4) then
 
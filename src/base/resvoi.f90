@@ -359,6 +359,7 @@ if ((i_mass_transfer.ne.0.and.dt(1).gt.dtmaxg).or.i_mass_transfer.eq.0) then
         cvar_voidf(iel) = scminp
       endif
     enddo
+    call field_update_state(ivarfl(ivar))
   endif
 
 endif
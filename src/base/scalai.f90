@@ -156,6 +156,7 @@ if (nscapp.gt.0) then
               enddo
             enddo
           endif
+          call field_update_state(ivarfl(ivar))
         enddo
       endif
     endif
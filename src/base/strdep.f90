@@ -319,6 +319,7 @@ if (itrfin.ne.-1) then
     else
       call csexit(1)
     endif
+    call field_update_state(ivarfl(ii))
   enddo
   do ifac = 1, nfac
     imasfl(ifac) = imasfl_pre(ifac)
@@ -345,6 +345,7 @@ if (ippmod(idarcy).eq.-1) then
                                   + gy*(xyzcen(2,iel)-xyp0)   &
                                   + gz*(xyzcen(3,iel)-xzp0))
     enddo
+    call field_update_state(ivarfl(ipr))
   endif
 
 endif
@@ -1334,6 +1335,8 @@ if (iccvfg.eq.0) then
         cvar_k(iel) = relaxk*cvar_k(iel) + (1.d0-relaxk)*cvara_k(iel)
         cvar_ep(iel) = relaxe*cvar_ep(iel) + (1.d0-relaxe)*cvara_ep(iel)
       enddo
+      call field_update_state(ivarfl(ik))
+      call field_update_state(ivarfl(iep))
     endif
 
   else if(itytur.eq.3) then
@@ -1378,6 +1381,8 @@ if (iccvfg.eq.0) then
         cvar_k(iel)   = relaxk*cvar_k(iel)   + (1.d0-relaxk)*cvara_k(iel)
         cvar_omg(iel) = relaxw*cvar_omg(iel) + (1.d0-relaxw)*cvara_omg(iel)
       enddo
+      call field_update_state(ivarfl(ik))
+      call field_update_state(ivarfl(iomg))
     end if
 
   else if( iturb.eq.70 ) then
@@ -1400,6 +1405,7 @@ if (iccvfg.eq.0) then
       do iel = 1,ncel
         cvar_nusa(iel) = relaxn*cvar_nusa(iel)+(1.d0-relaxn)*cvara_nusa(iel)
       enddo
+      call field_update_state(ivarfl(inusa))
     endif
 
   endif
@@ -796,6 +796,16 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
     poly_degree = 2;
     break;
 
+  case CS_PARAM_PRECOND_SSOR:
+    poly_degree = -1;
+    pc = cs_sles_pc_sgs_create();
+    break;
+
+  case CS_PARAM_PRECOND_ILU0:
+    poly_degree = -1;
+    pc = cs_sles_pc_ilu0_create();
+    break;
+
   case CS_PARAM_PRECOND_AMG:
     poly_degree = -1;
     switch (slesp.amg_type) {
@@ -993,7 +1003,18 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
   } /* end of switch */
 
   /* Update the preconditioner settings if needed */
-  if (slesp.precond == CS_PARAM_PRECOND_AMG) {
+  if (   slesp.precond == CS_PARAM_PRECOND_SSOR
+      || slesp.precond == CS_PARAM_PRECOND_ILU0) {
+
+    assert(pc != NULL);
+
+    if (it != NULL)
+      cs_sles_it_transfer_pc(it, &pc);
+    else
+      cs_sles_pc_destroy(&pc);
+
+  }
+  else if (slesp.precond == CS_PARAM_PRECOND_AMG) {
 
     assert(pc != NULL && it != NULL);
 
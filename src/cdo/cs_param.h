@@ -501,7 +501,7 @@ typedef enum {
   CS_PARAM_PRECOND_DIAG,
   CS_PARAM_PRECOND_GKB_CG,
   CS_PARAM_PRECOND_GKB_GMRES,
-  CS_PARAM_PRECOND_ILU0,        /*!< Only with PETSc */
+  CS_PARAM_PRECOND_ILU0,
   CS_PARAM_PRECOND_ICC0,        /*!< Only with PETSc*/
   CS_PARAM_PRECOND_POLY1,
   CS_PARAM_PRECOND_POLY2,
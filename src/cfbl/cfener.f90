@@ -846,6 +846,11 @@ if (irangp.ge.0.or.iperio.eq.1) then
   !==========
 endif
 
+! Pressure, energy and temperature were modified in place
+call field_update_state(ivarfl(ipr))
+call field_update_state(ivarfl(ivar))
+call field_update_state(ivarfl(isca(itempk)))
+
 ! Free memory
 if (allocated(wb)) deallocate(wb)
 if (allocated(smbrs)) deallocate(smbrs, rovsdt)
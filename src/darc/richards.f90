@@ -468,6 +468,8 @@ do while ( (isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp) &
     enddo
   endif
 
+  call field_update_state(ivarfl(ipr))
+
   iccocg = 1
   init = 1
   inc  = 1
@@ -687,6 +689,8 @@ else
 
 endif
 
+call field_update_state(ivarfl(iu))
+
 ! update pressure head (h = H - z) for post-processing
 ! Only used when gravity is taken into account
 if (darcy_gravity.ge.1) then
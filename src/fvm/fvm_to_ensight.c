@@ -94,6 +94,10 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool         rank_order;         /* Write element sections in rank order,
+                                      directly from each rank's partition
+                                      (parallel binary output only) */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -381,6 +385,87 @@ _write_block_floats_g(cs_gnum_t         num_start,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Write values from each rank's partition to an EnSight Gold binary file
+ * in parallel mode.
+ *
+ * Values are written in rank order, each rank's range in the file being
+ * determined by a prefix sum of local counts, so no redistribution
+ * to blocks is needed.
+ *
+ * parameters:
+ *   w        <-- pointer to writer structure
+ *   size     <-- size of each value (in bytes)
+ *   n_values <-- number of local values
+ *   values   <-> local values (may be modified by byte swapping)
+ *   f        <-- file to write to
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_part_values_g(const fvm_to_ensight_writer_t  *w,
+                     size_t                          size,
+                     cs_lnum_t                       n_values,
+                     void                           *values,
+                     _ensight_file_t                 f)
+{
+  cs_gnum_t  part_size = n_values, num_end = 0;
+
+  assert(f.bf != NULL);
+
+  MPI_Scan(&part_size, &num_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+  num_end += 1;
+
+  cs_file_write_block_buffer(f.bf,
+                             values,
+                             size,
+                             1,
+                             num_end - part_size,
+                             num_end);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if an EnSight element section may be written in rank order.
+ *
+ * Elements shared by several ranks (such as interior faces on partition
+ * boundaries) would be written more than once, so in this case, the
+ * section is written in global number order. Sections appended to the
+ * same EnSight element section are also written in global number order,
+ * as per-element field values are grouped for such sections.
+ *
+ * This function is collective, and should be called at the start
+ * of each EnSight element section.
+ *
+ * parameters:
+ *   w              <-- pointer to writer structure
+ *   export_section <-- pointer to section helper structure
+ *
+ * returns:
+ *   true if the section may be written in rank order, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_rank_order_section(const fvm_to_ensight_writer_t  *w,
+                    const fvm_writer_section_t     *export_section)
+{
+  if (w->rank_order == false)
+    return false;
+
+  if (   export_section->next != NULL
+      && export_section->next->continues_previous == true)
+    return false;
+
+  const fvm_io_num_t *global_element_num
+    = export_section->section->global_element_num;
+
+  cs_gnum_t n_l_elements = fvm_io_num_get_local_count(global_element_num);
+  cs_gnum_t n_elements_sum = 0;
+
+  MPI_Allreduce(&n_l_elements, &n_elements_sum, 1, CS_MPI_GNUM, MPI_SUM,
+                w->comm);
+
+  return (n_elements_sum == fvm_io_num_get_global_count(global_element_num));
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -927,6 +1012,46 @@ _field_output_g(void           *context,
                         *f);
 }
 
+/*----------------------------------------------------------------------------
+ * Output function for field values written in rank order.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions
+ * using a non-distributed helper, so block numbers are local.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start local number of element for current block
+ *   block_end    <-- past-the-end local number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output_part_g(void           *context,
+                     cs_datatype_t   datatype,
+                     int             dimension,
+                     int             component_id,
+                     cs_gnum_t       block_start,
+                     cs_gnum_t       block_end,
+                     void           *buffer)
+{
+  CS_UNUSED(datatype);
+  CS_UNUSED(dimension);
+  CS_UNUSED(component_id);
+
+  _ensight_context_t *c = context;
+
+  assert(datatype == CS_FLOAT);
+
+  _write_part_values_g(c->writer,
+                       sizeof(float),
+                       block_end - block_start,
+                       buffer,
+                       *(c->file));
+}
+
 /*----------------------------------------------------------------------------
  * Write "trivial" point elements to an EnSight Gold file in parallel mode
  *
@@ -1043,6 +1168,7 @@ _export_point_elements_l(const fvm_nodal_t  *mesh,
  *
  * parameters:
  *   w                  <-- pointer to writer structure
+ *   rank_order         <-- write in rank order ?
  *   global_element_num <-- global element numbering
  *   vertex_index       <-- pointer to element -> vertex index
  *   n_ranks            <-- number of processes in communicator
@@ -1051,6 +1177,7 @@ _export_point_elements_l(const fvm_nodal_t  *mesh,
 
 static void
 _write_lengths_g(const fvm_to_ensight_writer_t  *w,
+                 bool                            rank_order,
                  const fvm_io_num_t             *global_element_num,
                  const cs_lnum_t                 vertex_index[],
                  _ensight_file_t                 f)
@@ -1071,6 +1198,19 @@ _write_lengths_g(const fvm_to_ensight_writer_t  *w,
   const cs_gnum_t   *g_num
     = fvm_io_num_get_global_num(global_element_num);
 
+  BFT_MALLOC(part_lengths, n_elements, int32_t);
+
+  for (i = 0; i < n_elements; i++)
+    part_lengths[i] = vertex_index[i+1] - vertex_index[i];
+
+  /* In rank order mode, write partition values directly */
+
+  if (rank_order) {
+    _write_part_values_g(w, sizeof(int32_t), n_elements, part_lengths, f);
+    BFT_FREE(part_lengths);
+    return;
+  }
+
   /* Allocate block buffer */
 
   bi = cs_block_dist_compute_sizes(w->rank,
@@ -1082,10 +1222,6 @@ _write_lengths_g(const fvm_to_ensight_writer_t  *w,
   /* Build distribution structures */
 
   BFT_MALLOC(block_lengths, bi.gnum_range[1] - bi.gnum_range[0], int);
-  BFT_MALLOC(part_lengths, n_elements, int32_t);
-
-  for (i = 0; i < n_elements; i++)
-    part_lengths[i] = vertex_index[i+1] - vertex_index[i];
 
   d = cs_part_to_block_create_by_gnum(w->comm, bi, n_elements, g_num);
 
@@ -1197,18 +1333,20 @@ _write_block_indexed(cs_gnum_t         num_start,
  *
  * parameters:
  *   w                  <-- pointer to writer structure
+ *   rank_order         <-- write in rank order ?
  *   global_vertex_num  <-- vertex global numbering
  *   global_element_num <-- global element numbering
  *   vertex_index       <-- element -> vertex index
- *   vertex_num         <-- element -> vertex number
+ *   vertex_num         <-> element -> vertex number (may be modified)
  *   f                  <-- associated file handle
  *----------------------------------------------------------------------------*/
 
 static void
 _write_indexed_connect_g(const fvm_to_ensight_writer_t  *w,
+                         bool                            rank_order,
                          const fvm_io_num_t             *global_element_num,
                          const cs_lnum_t                 vertex_index[],
-                         const int32_t                   vertex_num[],
+                         int32_t                         vertex_num[],
                          _ensight_file_t                 f)
 {
   cs_block_dist_info_t bi;
@@ -1226,6 +1364,17 @@ _write_indexed_connect_g(const fvm_to_ensight_writer_t  *w,
   const cs_gnum_t   *g_elt_num
     = fvm_io_num_get_global_num(global_element_num);
 
+  /* In rank order mode, write partition values directly */
+
+  if (rank_order) {
+    _write_part_values_g(w,
+                         sizeof(int32_t),
+                         vertex_index[n_elements],
+                         vertex_num,
+                         f);
+    return;
+  }
+
   /* Adjust min block size based on minimum element size */
 
   loc_size = vertex_index[n_elements];
@@ -1281,6 +1430,7 @@ _write_indexed_connect_g(const fvm_to_ensight_writer_t  *w,
  *
  * parameters:
  *   w                 <-- pointer to writer structure
+ *   rank_order        <-- write in rank order ?
  *   export_section    <-- pointer to EnSight section helper structure
  *   global_vertex_num <-- pointer to vertex global numbering
  *   f                 <-- associated file handle
@@ -1291,6 +1441,7 @@ _write_indexed_connect_g(const fvm_to_ensight_writer_t  *w,
 
 static const fvm_writer_section_t *
 _export_nodal_polyhedra_g(const fvm_to_ensight_writer_t  *w,
+                          bool                            rank_order,
                           const fvm_writer_section_t     *export_section,
                           const fvm_io_num_t             *global_vertex_num,
                           _ensight_file_t                 f)
@@ -1313,6 +1464,7 @@ _export_nodal_polyhedra_g(const fvm_to_ensight_writer_t  *w,
     const fvm_nodal_section_t  *section = current_section->section;
 
     _write_lengths_g(w,
+                     rank_order,
                      section->global_element_num,
                      section->face_index,
                      f);
@@ -1360,52 +1512,68 @@ _export_nodal_polyhedra_g(const fvm_to_ensight_writer_t  *w,
     }
     assert(k == section->face_index[section->n_elements]);
 
-    /* Prepare distribution structures */
+    /* In rank order mode, write partition values directly */
 
-    bi = cs_block_dist_compute_sizes(w->rank,
-                                     w->n_ranks,
-                                     w->min_rank_step,
-                                     min_block_size,
-                                     n_g_elements);
+    if (rank_order)
+      _write_part_values_g(w,
+                           sizeof(int32_t),
+                           section->face_index[section->n_elements],
+                           part_face_len,
+                           f);
 
-    d = cs_part_to_block_create_by_gnum(w->comm,
-                                        bi,
-                                        n_elements,
-                                        g_elt_num);
+    else {
 
-    BFT_MALLOC(block_index, bi.gnum_range[1] - bi.gnum_range[0] + 1, cs_lnum_t);
+      /* Prepare distribution structures */
 
-    cs_part_to_block_copy_index(d,
-                                section->face_index,
-                                block_index);
+      bi = cs_block_dist_compute_sizes(w->rank,
+                                       w->n_ranks,
+                                       w->min_rank_step,
+                                       min_block_size,
+                                       n_g_elements);
 
-    block_size = block_index[bi.gnum_range[1] - bi.gnum_range[0]];
+      d = cs_part_to_block_create_by_gnum(w->comm,
+                                          bi,
+                                          n_elements,
+                                          g_elt_num);
 
-    BFT_MALLOC(block_face_len, block_size, int32_t);
+      BFT_MALLOC(block_index,
+                 bi.gnum_range[1] - bi.gnum_range[0] + 1,
+                 cs_lnum_t);
 
-    cs_part_to_block_copy_indexed(d,
-                                  CS_INT32,
+      cs_part_to_block_copy_index(d,
                                   section->face_index,
-                                  part_face_len,
-                                  block_index,
-                                  block_face_len);
+                                  block_index);
 
-    MPI_Scan(&block_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
-    block_end += 1;
-    block_start = block_end - block_size;
+      block_size = block_index[bi.gnum_range[1] - bi.gnum_range[0]];
 
-    _write_block_connect_g(1,
-                           block_start,
-                           block_end,
-                           block_face_len,
-                           w->comm,
-                           f);
+      BFT_MALLOC(block_face_len, block_size, int32_t);
+
+      cs_part_to_block_copy_indexed(d,
+                                    CS_INT32,
+                                    section->face_index,
+                                    part_face_len,
+                                    block_index,
+                                    block_face_len);
 
-    BFT_FREE(block_face_len);
+      MPI_Scan(&block_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+      block_end += 1;
+      block_start = block_end - block_size;
+
+      _write_block_connect_g(1,
+                             block_start,
+                             block_end,
+                             block_face_len,
+                             w->comm,
+                             f);
 
-    cs_part_to_block_destroy(&d);
+      BFT_FREE(block_face_len);
+
+      cs_part_to_block_destroy(&d);
+
+      BFT_FREE(block_index);
+
+    }
 
-    BFT_FREE(block_index);
     BFT_FREE(part_face_len);
 
     current_section = current_section->next;
@@ -1497,6 +1665,7 @@ _export_nodal_polyhedra_g(const fvm_to_ensight_writer_t  *w,
     /* Now distribute and write cells -> vertices connectivity */
 
     _write_indexed_connect_g(w,
+                             rank_order,
                              section->global_element_num,
                              part_vtx_idx,
                              part_vtx_num,
@@ -1712,6 +1881,7 @@ _export_nodal_polyhedra_l(const fvm_writer_section_t  *export_section,
  *
  * parameters:
  *   w                 <-- pointer to writer structure
+ *   rank_order        <-- write in rank order ?
  *   export_section    <-- pointer to EnSight section helper structure
  *   global_vertex_num <-- pointer to vertex global numbering
  *   f                 <-- associated file handle
@@ -1722,6 +1892,7 @@ _export_nodal_polyhedra_l(const fvm_writer_section_t  *export_section,
 
 static const fvm_writer_section_t *
 _export_nodal_polygons_g(const fvm_to_ensight_writer_t  *w,
+                         bool                            rank_order,
                          const fvm_writer_section_t     *export_section,
                          const fvm_io_num_t             *global_vertex_num,
                          _ensight_file_t                 f)
@@ -1738,6 +1909,7 @@ _export_nodal_polygons_g(const fvm_to_ensight_writer_t  *w,
     const fvm_nodal_section_t  *section = current_section->section;
 
     _write_lengths_g(w,
+                     rank_order,
                      section->global_element_num,
                      section->vertex_index,
                      f);
@@ -1807,6 +1979,7 @@ _export_nodal_polygons_g(const fvm_to_ensight_writer_t  *w,
     /* Now distribute and write cell -> vertices connectivity */
 
     _write_indexed_connect_g(w,
+                             rank_order,
                              section->global_element_num,
                              part_vtx_idx,
                              part_vtx_num,
@@ -1954,6 +2127,7 @@ _export_nodal_polygons_l(const fvm_writer_section_t  *export_section,
  *
  * parameters:
  *   w                  <-- pointer to writer structure
+ *   rank_order         <-- write in rank order ?
  *   global_vertex_num  <-- vertex global numbering
  *   global_element_num <-- global element numbering
  *   tesselation        <-- element tesselation description
@@ -1964,6 +2138,7 @@ _export_nodal_polygons_l(const fvm_writer_section_t  *export_section,
 
 static void
 _write_tesselated_connect_g(const fvm_to_ensight_writer_t  *w,
+                            bool                            rank_order,
                             const fvm_io_num_t             *global_vertex_num,
                             const fvm_io_num_t             *global_element_num,
                             const fvm_tesselation_t        *tesselation,
@@ -2029,6 +2204,14 @@ _write_tesselated_connect_g(const fvm_to_ensight_writer_t  *w,
     BFT_FREE(part_vtx_gnum);
   }
 
+  /* In rank order mode, write partition values directly */
+
+  if (rank_order) {
+    _write_part_values_g(w, sizeof(int32_t), part_size, part_vtx_num, f);
+    BFT_FREE(part_vtx_num);
+    return;
+  }
+
   /* Allocate memory for additionnal indexes and decoded connectivity */
 
   bi = cs_block_dist_compute_sizes(w->rank,
@@ -2099,6 +2282,7 @@ _write_tesselated_connect_g(const fvm_to_ensight_writer_t  *w,
  *
  * parameters:
  *   w                 <-- pointer to writer structure
+ *   rank_order        <-- write in rank order ?
  *   export_section    <-- pointer to EnSight section helper structure
  *   global_vertex_num <-- pointer to vertex global numbering
  *   f                 <-- associated file handle
@@ -2109,6 +2293,7 @@ _write_tesselated_connect_g(const fvm_to_ensight_writer_t  *w,
 
 static const fvm_writer_section_t *
 _export_nodal_tesselated_g(const fvm_to_ensight_writer_t  *w,
+                           bool                            rank_order,
                            const fvm_writer_section_t     *export_section,
                            const fvm_io_num_t             *global_vertex_num,
                            _ensight_file_t                 f)
@@ -2125,6 +2310,7 @@ _export_nodal_tesselated_g(const fvm_to_ensight_writer_t  *w,
     const fvm_nodal_section_t  *section = current_section->section;
 
     _write_tesselated_connect_g(w,
+                                rank_order,
                                 global_vertex_num,
                                 section->global_element_num,
                                 section->tesselation,
@@ -2229,6 +2415,7 @@ _export_nodal_tesselated_l(const fvm_writer_section_t  *export_section,
  *
  * parameters:
  *   w                 <-- pointer to writer structure
+ *   rank_order        <-- write in rank order ?
  *   export_section    <-- pointer to EnSight section helper structure
  *   global_vertex_num <-- pointer to vertex global numbering
  *   f                 <-- associated file handle
@@ -2239,6 +2426,7 @@ _export_nodal_tesselated_l(const fvm_writer_section_t  *export_section,
 
 static const fvm_writer_section_t *
 _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
+                        bool                            rank_order,
                         const fvm_writer_section_t     *export_section,
                         const fvm_io_num_t             *global_vertex_num,
                         _ensight_file_t                 f)
@@ -2274,24 +2462,8 @@ _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
     const cs_gnum_t   *g_vtx_num
       = fvm_io_num_get_global_num(global_vertex_num);
 
-    /* Prepare distribution structures */
-
-    bi = cs_block_dist_compute_sizes(w->rank,
-                                     w->n_ranks,
-                                     w->min_rank_step,
-                                     min_block_size,
-                                     n_g_elements);
-
-    d = cs_part_to_block_create_by_gnum(w->comm,
-                                        bi,
-                                        n_elements,
-                                        g_elt_num);
-
     /* Build connectivity */
 
-    block_size = bi.gnum_range[1] - bi.gnum_range[0];
-
-    BFT_MALLOC(block_vtx_num, block_size*stride, int32_t);
     BFT_MALLOC(part_vtx_num, n_elements*stride, int32_t);
 
     for (i = 0; i < n_elements; i++) {
@@ -2301,24 +2473,54 @@ _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
       }
     }
 
-    cs_part_to_block_copy_array(d,
-                                CS_INT32,
-                                stride,
-                                part_vtx_num,
-                                block_vtx_num);
-
-    BFT_FREE(part_vtx_num);
+    /* In rank order mode, write partition values directly */
 
-    _write_block_connect_g(stride,
-                           bi.gnum_range[0],
-                           bi.gnum_range[1],
-                           block_vtx_num,
-                           w->comm,
+    if (rank_order)
+      _write_part_values_g(w,
+                           sizeof(int32_t),
+                           n_elements*stride,
+                           part_vtx_num,
                            f);
 
-    BFT_FREE(block_vtx_num);
+    else {
+
+      /* Prepare distribution structures */
+
+      bi = cs_block_dist_compute_sizes(w->rank,
+                                       w->n_ranks,
+                                       w->min_rank_step,
+                                       min_block_size,
+                                       n_g_elements);
+
+      d = cs_part_to_block_create_by_gnum(w->comm,
+                                          bi,
+                                          n_elements,
+                                          g_elt_num);
+
+      block_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+      BFT_MALLOC(block_vtx_num, block_size*stride, int32_t);
 
-    cs_part_to_block_destroy(&d);
+      cs_part_to_block_copy_array(d,
+                                  CS_INT32,
+                                  stride,
+                                  part_vtx_num,
+                                  block_vtx_num);
+
+      _write_block_connect_g(stride,
+                             bi.gnum_range[0],
+                             bi.gnum_range[1],
+                             block_vtx_num,
+                             w->comm,
+                             f);
+
+      BFT_FREE(block_vtx_num);
+
+      cs_part_to_block_destroy(&d);
+
+    }
+
+    BFT_FREE(part_vtx_num);
 
     current_section = current_section->next;
 
@@ -2530,6 +2732,10 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          write elements in rank order, directly from each
+ *                       rank's partition (binary files in parallel only;
+ *                       sections with elements shared by several ranks
+ *                       are written in global number order)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2571,6 +2777,7 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
+  this_writer->rank_order = false;
 
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
@@ -2644,12 +2851,21 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if (   (l_opt == 10)
+               && (strncmp(options + i1, "rank_order", l_opt) == 0))
+        this_writer->rank_order = true;
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
 
   }
 
+  /* Rank order output only applies to binary files in parallel */
+
+  if (this_writer->text_mode == true || this_writer->n_ranks < 2)
+    this_writer->rank_order = false;
+
   this_writer->case_info = fvm_to_ensight_case_create(name,
                                                       path,
                                                       time_dependency);
@@ -2778,6 +2994,10 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
                                   = (fvm_to_ensight_writer_t *)this_writer_p;
   _ensight_file_t  f = {NULL, NULL};
 
+#if defined(HAVE_MPI)
+  bool  rank_order = false;
+#endif
+
   const int  rank = this_writer->rank;
   const int  n_ranks = this_writer->n_ranks;
 
@@ -2886,6 +3106,11 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       _write_string(f, _ensight_type_name[export_section->type]);
       _write_int(f, n_g_elements);
+
+#if defined(HAVE_MPI)
+      if (n_ranks > 1)
+        rank_order = _rank_order_section(this_writer, export_section);
+#endif
     }
 
     /* Output for strided (regular) element types */
@@ -2897,6 +3122,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       if (n_ranks > 1)
         export_section = _export_nodal_strided_g(this_writer,
+                                                 rank_order,
                                                  export_section,
                                                  mesh->global_vertex_num,
                                                  f);
@@ -2927,6 +3153,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       if (n_ranks > 1)
         export_section = _export_nodal_tesselated_g(this_writer,
+                                                    rank_order,
                                                     export_section,
                                                     mesh->global_vertex_num,
                                                     f);
@@ -2948,6 +3175,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       if (n_ranks > 1)
         export_section = _export_nodal_polygons_g(this_writer,
+                                                  rank_order,
                                                   export_section,
                                                   mesh->global_vertex_num,
                                                   f);
@@ -2970,6 +3198,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       if (n_ranks > 1)
         export_section =_export_nodal_polyhedra_g(this_writer,
+                                                  rank_order,
                                                   export_section,
                                                   mesh->global_vertex_num,
                                                   f);
@@ -3042,6 +3271,11 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   fvm_to_ensight_writer_t  *w = (fvm_to_ensight_writer_t *)this_writer_p;
   _ensight_file_t  f = {NULL, NULL};
 
+#if defined(HAVE_MPI)
+  bool  rank_order = false;
+  fvm_writer_field_helper_t  *part_helper = NULL;
+#endif
+
   const int  rank = w->rank;
   const int  n_ranks = w->n_ranks;
 
@@ -3125,6 +3359,19 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                                    w->min_block_size,
                                    w->comm);
 
+  /* In rank order mode, element values of sections which may be
+     written in rank order are output from each rank's partition,
+     using a non-distributed helper */
+
+  if (   n_ranks > 1 && w->rank_order == true
+      && location == FVM_WRITER_PER_ELEMENT)
+    part_helper = fvm_writer_field_helper_create(mesh,
+                                                 export_list,
+                                                 output_dim,
+                                                 CS_NO_INTERLACE,
+                                                 CS_FLOAT,
+                                                 location);
+
 #endif
 
   /* Part header */
@@ -3186,8 +3433,13 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
       /* Print header if start of corresponding EnSight section */
 
-      if (export_section->continues_previous == false)
+      if (export_section->continues_previous == false) {
         _write_string(f, _ensight_type_name[export_section->type]);
+#if defined(HAVE_MPI)
+        if (n_ranks > 1)
+          rank_order = _rank_order_section(w, export_section);
+#endif
+      }
 
       /* Output per grouped sections */
 
@@ -3199,17 +3451,33 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
         c.writer = w;
         c.file = &f;
 
-        export_section = fvm_writer_field_helper_output_e(helper,
-                                                          &c,
-                                                          export_section,
-                                                          dimension,
-                                                          interlace,
-                                                          comp_order,
-                                                          n_parent_lists,
-                                                          parent_num_shift,
-                                                          datatype,
-                                                          field_values,
-                                                          _field_output_g);
+        if (rank_order)
+          export_section
+            = fvm_writer_field_helper_output_e(part_helper,
+                                               &c,
+                                               export_section,
+                                               dimension,
+                                               interlace,
+                                               comp_order,
+                                               n_parent_lists,
+                                               parent_num_shift,
+                                               datatype,
+                                               field_values,
+                                               _field_output_part_g);
+
+        else
+          export_section
+            = fvm_writer_field_helper_output_e(helper,
+                                               &c,
+                                               export_section,
+                                               dimension,
+                                               interlace,
+                                               comp_order,
+                                               n_parent_lists,
+                                               parent_num_shift,
+                                               datatype,
+                                               field_values,
+                                               _field_output_g);
 
       }
 
@@ -3235,6 +3503,10 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
   fvm_writer_field_helper_destroy(&helper);
 
+#if defined(HAVE_MPI)
+  fvm_writer_field_helper_destroy(&part_helper);
+#endif
+
   BFT_FREE(export_list);
 
   /* Close variable file and update case file */
@@ -66,6 +66,10 @@ BEGIN_C_DECLS
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          write elements in rank order, directly from each
+ *                       rank's partition (binary files in parallel only;
+ *                       sections with elements shared by several ranks
+ *                       are written in global number order)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -0,0 +1,1153 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to reduced-order (decimated and quantized) binary files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_convert_array.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_extract.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_order.h"
+#include "cs_part_to_block.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_reduced.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Sampling of a mesh's vertices or elements.
+ *
+ * Sources are local elements, or vertices in serial mode. In parallel,
+ * vertices may be shared by several ranks, so source vertices are those
+ * of the block distribution based on their global number.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t             n_src;        /* Number of source entities */
+  cs_lnum_t             n_samples;    /* Number of local samples */
+  cs_lnum_t            *sample_id;    /* Source ids of local samples,
+                                         ordered by sample number */
+
+  cs_gnum_t             n_g_samples;  /* Global number of samples */
+  cs_block_dist_info_t  bi;           /* Block distribution of samples,
+                                         aligned on quantization blocks */
+
+#if defined(HAVE_MPI)
+  cs_part_to_block_t   *d_src;        /* Partition to block distribution
+                                         of source vertices, or NULL */
+  cs_part_to_block_t   *d;            /* Sample to block distribution,
+                                         or NULL */
+#endif
+
+} _sampling_t;
+
+/*----------------------------------------------------------------------------
+ * Reduced-order writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Writer name */
+  char        *path;               /* Path prefix */
+
+  int          rank;               /* Rank of current process in communicator */
+  int          n_ranks;            /* Number of processes in communicator */
+
+  fvm_writer_time_dep_t  time_dependency;  /* Mesh time dependency */
+
+  int          nt;                 /* Time step */
+  double       t;                  /* Time value */
+
+  int          n_bits;             /* Bits per quantized value (8 or 16),
+                                      or 32 for unquantized values */
+  cs_gnum_t    decimation;         /* Output every nth entity along
+                                      the Peano-Hilbert curve */
+  cs_lnum_t    q_block_size;       /* Number of samples per
+                                      quantization block */
+
+  const fvm_nodal_t  *mesh;        /* Mesh associated with sampling */
+  _sampling_t   sampling[2];       /* Vertex and element sampling */
+
+#if defined(HAVE_MPI)
+  int          min_rank_step;      /* Minimum rank step */
+  int          min_block_size;     /* Minimum block buffer size */
+  MPI_Comm     block_comm;         /* Associated MPI block communicator */
+  MPI_Comm     comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_reduced_writer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char  *_location_name[] = {"vertices", "elements"};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize sampling structure.
+ *
+ * parameters:
+ *   s <-> pointer to sampling structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sampling_init(_sampling_t  *s)
+{
+  s->n_src = 0;
+  s->n_samples = 0;
+  s->sample_id = NULL;
+
+  s->n_g_samples = 0;
+  s->bi = cs_block_dist_compute_sizes(0, 1, 1, 0, 0);
+
+#if defined(HAVE_MPI)
+  s->d_src = NULL;
+  s->d = NULL;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Free sampling structure members.
+ *
+ * parameters:
+ *   s <-> pointer to sampling structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sampling_free(_sampling_t  *s)
+{
+  BFT_FREE(s->sample_id);
+
+#if defined(HAVE_MPI)
+  if (s->d_src != NULL)
+    cs_part_to_block_destroy(&(s->d_src));
+  if (s->d != NULL)
+    cs_part_to_block_destroy(&(s->d));
+#endif
+
+  _sampling_init(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute block distribution of samples.
+ *
+ * Block boundaries are aligned on quantization block boundaries, so that
+ * no quantization block is split across ranks.
+ *
+ * parameters:
+ *   w           <-- pointer to writer structure
+ *   n_g_samples <-- global number of samples
+ *
+ * returns:
+ *   block size and range info structure
+ *----------------------------------------------------------------------------*/
+
+static cs_block_dist_info_t
+_sample_block_dist(const fvm_to_reduced_writer_t  *w,
+                   cs_gnum_t                       n_g_samples)
+{
+  cs_block_dist_info_t bi;
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    const cs_gnum_t q_size = w->q_block_size;
+
+    bi = cs_block_dist_compute_sizes(w->rank,
+                                     w->n_ranks,
+                                     w->min_rank_step,
+                                     w->min_block_size / sizeof(float),
+                                     n_g_samples);
+
+    /* Round block size up to a multiple of the quantization block size
+       and update range accordingly (as in cs_block_dist_compute_sizes) */
+
+    cs_gnum_t block_size = ((bi.block_size + q_size - 1) / q_size) * q_size;
+    cs_gnum_t g_rank[2];
+
+    if (w->rank % bi.rank_step == 0) {
+      g_rank[0] = w->rank / bi.rank_step;
+      g_rank[1] = g_rank[0] + 1;
+    }
+    else {  /* empty block on this rank */
+      g_rank[0] = w->rank / bi.rank_step + 1;
+      g_rank[1] = g_rank[0];
+    }
+
+    for (int i = 0; i < 2; i++) {
+      bi.gnum_range[i] = g_rank[i]*block_size + 1;
+      if (bi.gnum_range[i] > n_g_samples + 1)
+        bi.gnum_range[i] = n_g_samples + 1;
+    }
+
+    bi.block_size = block_size;
+
+    return bi;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  bi = cs_block_dist_compute_sizes(0, 1, 1, 0, n_g_samples);
+
+  return bi;
+}
+
+/*----------------------------------------------------------------------------
+ * Build sampling of vertices or elements for a given mesh.
+ *
+ * Source entities are numbered along a Peano-Hilbert curve, and every
+ * nth entity along that curve is selected.
+ *
+ * parameters:
+ *   w             <-- pointer to writer structure
+ *   mesh          <-- pointer to nodal mesh structure
+ *   location      <-- vertices or elements
+ *   s             <-> pointer to sampling structure
+ *   sample_coords --> sample coordinates (3 per sample, ordered
+ *                     by sample number), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_sampling(fvm_to_reduced_writer_t  *w,
+                const fvm_nodal_t        *mesh,
+                fvm_writer_var_loc_t      location,
+                _sampling_t              *s,
+                float                   **sample_coords)
+{
+  const int dim = mesh->dim;
+
+  cs_coord_t *src_coords = NULL;
+
+  _sampling_free(s);
+
+  /* Source entity coordinates */
+
+  if (location == FVM_WRITER_PER_ELEMENT) {
+    int entity_dim = fvm_nodal_get_max_entity_dim(mesh);
+    if (entity_dim > 0)
+      s->n_src = fvm_nodal_get_n_entities(mesh, entity_dim);
+    BFT_MALLOC(src_coords, s->n_src*dim, cs_coord_t);
+    if (s->n_src > 0)
+      fvm_nodal_get_element_centers(mesh, CS_INTERLACE, entity_dim, src_coords);
+  }
+
+  else {
+    s->n_src = mesh->n_vertices;
+    BFT_MALLOC(src_coords, s->n_src*dim, cs_coord_t);
+    fvm_nodal_get_vertex_coords(mesh, CS_INTERLACE, src_coords);
+
+#if defined(HAVE_MPI)
+    if (w->n_ranks > 1) {
+      cs_block_dist_info_t  bi;
+      fvm_writer_vertex_part_to_block_create(w->min_rank_step,
+                                             w->min_block_size,
+                                             0,
+                                             0,
+                                             mesh,
+                                             &bi,
+                                             &(s->d_src),
+                                             w->comm);
+      cs_coord_t *block_coords = NULL;
+      s->n_src = bi.gnum_range[1] - bi.gnum_range[0];
+      BFT_MALLOC(block_coords, s->n_src*dim, cs_coord_t);
+      cs_part_to_block_copy_array(s->d_src,
+                                  CS_COORD_TYPE,
+                                  dim,
+                                  src_coords,
+                                  block_coords);
+      BFT_FREE(src_coords);
+      src_coords = block_coords;
+    }
+#endif
+  }
+
+  cs_gnum_t n_g_src = s->n_src;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    cs_gnum_t n_l_src = s->n_src;
+    MPI_Allreduce(&n_l_src, &n_g_src, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+  }
+#endif
+
+  /* Select every nth entity along the Peano-Hilbert curve */
+
+  cs_gnum_t *sample_num = NULL;
+
+  if (n_g_src > 0) {
+
+    fvm_io_num_t *sfc_num
+      = fvm_io_num_create_from_sfc(src_coords,
+                                   dim,
+                                   s->n_src,
+                                   FVM_IO_NUM_SFC_HILBERT_BOX);
+
+    const cs_gnum_t *g_num = fvm_io_num_get_global_num(sfc_num);
+    const cs_gnum_t n = w->decimation;
+
+    s->n_g_samples = (n_g_src + n - 1) / n;
+
+    for (cs_lnum_t i = 0; i < s->n_src; i++) {
+      if ((g_num[i] - 1) % n == 0)
+        s->n_samples += 1;
+    }
+
+    BFT_MALLOC(s->sample_id, s->n_samples, cs_lnum_t);
+    BFT_MALLOC(sample_num, s->n_samples, cs_gnum_t);
+
+    s->n_samples = 0;
+    for (cs_lnum_t i = 0; i < s->n_src; i++) {
+      if ((g_num[i] - 1) % n == 0) {
+        s->sample_id[s->n_samples] = i;
+        sample_num[s->n_samples] = (g_num[i] - 1) / n + 1;
+        s->n_samples += 1;
+      }
+    }
+
+    sfc_num = fvm_io_num_destroy(sfc_num);
+
+    /* Order local samples by sample number, so that local sample
+       arrays are directly usable as block arrays in serial mode */
+
+    cs_lnum_t *order = cs_order_gnum(NULL, sample_num, s->n_samples);
+    cs_lnum_t *_sample_id = NULL;
+    cs_gnum_t *_sample_num = NULL;
+
+    BFT_MALLOC(_sample_id, s->n_samples, cs_lnum_t);
+    BFT_MALLOC(_sample_num, s->n_samples, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < s->n_samples; i++) {
+      _sample_id[i] = s->sample_id[order[i]];
+      _sample_num[i] = sample_num[order[i]];
+    }
+
+    BFT_FREE(order);
+    BFT_FREE(sample_num);
+    BFT_FREE(s->sample_id);
+
+    s->sample_id = _sample_id;
+    sample_num = _sample_num;
+
+  }
+
+  /* Sample distribution */
+
+  s->bi = _sample_block_dist(w, s->n_g_samples);
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    s->d = cs_part_to_block_create_by_gnum(w->comm,
+                                           s->bi,
+                                           s->n_samples,
+                                           sample_num);
+    cs_part_to_block_transfer_gnum(s->d, sample_num);
+    sample_num = NULL;
+  }
+#endif
+
+  BFT_FREE(sample_num);
+
+  /* Sample coordinates (always 3D) */
+
+  if (sample_coords != NULL) {
+
+    float *_sample_coords = NULL;
+    BFT_MALLOC(_sample_coords, s->n_samples*3, float);
+
+    for (cs_lnum_t i = 0; i < s->n_samples; i++) {
+      const cs_coord_t *c = src_coords + s->sample_id[i]*dim;
+      for (int j = 0; j < 3; j++)
+        _sample_coords[i*3 + j] = (j < dim) ? c[j] : 0.;
+    }
+
+    *sample_coords = _sample_coords;
+
+  }
+
+  BFT_FREE(src_coords);
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute sample values to blocks.
+ *
+ * parameters:
+ *   s           <-- pointer to sampling structure
+ *   dim         <-- number of values per sample
+ *   sample_vals <-- sample values, ordered by sample number
+ *                   (ownership is transferred to this function)
+ *
+ * returns:
+ *   pointer to block values
+ *----------------------------------------------------------------------------*/
+
+static float *
+_sample_values_to_block(const _sampling_t  *s,
+                        int                 dim,
+                        float              *sample_vals)
+{
+  float *block_vals = sample_vals;
+
+#if defined(HAVE_MPI)
+
+  if (s->d != NULL) {
+    cs_lnum_t n_block = s->bi.gnum_range[1] - s->bi.gnum_range[0];
+    BFT_MALLOC(block_vals, n_block*dim, float);
+    cs_part_to_block_copy_array(s->d,
+                                CS_FLOAT,
+                                dim,
+                                sample_vals,
+                                block_vals);
+    BFT_FREE(sample_vals);
+  }
+
+#endif
+
+  return block_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Quantize block values.
+ *
+ * For each quantization block and component, values are mapped linearly
+ * from [min, max] to [0, 2^n_bits - 1]; the associated offset and scale
+ * are stored so that v ~ offset + q*scale.
+ *
+ * parameters:
+ *   n_vals       <-- number of samples
+ *   dim          <-- number of values per sample
+ *   q_block_size <-- number of samples per quantization block
+ *   n_bits       <-- number of bits per quantized value (8 or 16)
+ *   vals         <-- sample values (interlaced)
+ *   q_params     --> offset and scale per block and component
+ *   q_vals       --> quantized values
+ *----------------------------------------------------------------------------*/
+
+static void
+_quantize(cs_lnum_t     n_vals,
+          int           dim,
+          cs_lnum_t     q_block_size,
+          int           n_bits,
+          const float   vals[],
+          float         q_params[],
+          void         *q_vals)
+{
+  const cs_lnum_t n_q_blocks = (n_vals + q_block_size - 1) / q_block_size;
+  const double q_max = (n_bits == 8) ? UINT8_MAX : UINT16_MAX;
+
+  uint8_t *q8 = q_vals;
+  uint16_t *q16 = q_vals;
+
+# pragma omp parallel for if (n_q_blocks > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_q_blocks; b_id++) {
+
+    const cs_lnum_t s_id = b_id*q_block_size;
+    const cs_lnum_t e_id = CS_MIN(s_id + q_block_size, n_vals);
+
+    for (int k = 0; k < dim; k++) {
+
+      float v_min = vals[s_id*dim + k], v_max = v_min;
+      for (cs_lnum_t i = s_id + 1; i < e_id; i++) {
+        const float v = vals[i*dim + k];
+        if (v < v_min)
+          v_min = v;
+        else if (v > v_max)
+          v_max = v;
+      }
+
+      /* Use the stored (float) parameters for quantization so that
+         reconstruction error is bounded by half a quantization step */
+
+      const float offset = v_min;
+      const float scale = (v_max - v_min) / q_max;
+      const double r_scale = (scale > 0) ? 1./scale : 0.;
+
+      q_params[(b_id*dim + k)*2]     = offset;
+      q_params[(b_id*dim + k)*2 + 1] = scale;
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        double q = floor((vals[i*dim + k] - offset)*r_scale + 0.5);
+        if (!(q > 0.))  /* also handles NaN */
+          q = 0.;
+        else if (q > q_max)
+          q = q_max;
+        if (n_bits == 8)
+          q8[i*dim + k] = q;
+        else
+          q16[i*dim + k] = q;
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Open a reduced-order output file.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   base_name <-- base file name (without path or time step)
+ *   time_step <-- associated time step, or < 0 for none
+ *
+ * returns:
+ *   pointer to file structure
+ *----------------------------------------------------------------------------*/
+
+static cs_file_t *
+_open_file(const fvm_to_reduced_writer_t  *w,
+           const char                     *base_name,
+           int                             time_step)
+{
+  char t_stamp[32];
+  if (time_step >= 0)
+    sprintf(t_stamp, ".%05d", time_step);
+  else
+    t_stamp[0] = '\0';
+
+  char *file_name = NULL;
+  size_t l =   strlen(w->path) + strlen(w->name) + 1
+             + strlen(base_name) + strlen(t_stamp) + 1;
+  BFT_MALLOC(file_name, l, char);
+
+  sprintf(file_name, "%s%s.%s", w->path, w->name, base_name);
+
+  /* Replace characters which are not well suited for file names */
+
+  for (size_t i = strlen(w->path) + strlen(w->name) + 1;
+       file_name[i] != '\0';
+       i++) {
+    if (! (isalnum((unsigned char)file_name[i]) || file_name[i] == '_'
+           || file_name[i] == '-' || file_name[i] == '.'))
+      file_name[i] = '_';
+  }
+
+  strcat(file_name, t_stamp);
+
+  cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+
+  MPI_Info hints;
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+  cs_file_t *f = cs_file_open(file_name,
+                              CS_FILE_MODE_WRITE,
+                              method,
+                              hints,
+                              w->block_comm,
+                              w->comm);
+
+#else
+
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+  cs_file_t *f = cs_file_open(file_name, CS_FILE_MODE_WRITE, method);
+
+#endif
+
+  BFT_FREE(file_name);
+
+  cs_file_set_big_endian(f);
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------
+ * Write string to a reduced-order file (padded to 80 characters).
+ *
+ * parameters:
+ *   f <-- file to write to
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_string(cs_file_t   *f,
+              const char  *s)
+{
+  char  buf[81];
+
+  strncpy(buf, s, 80);
+  buf[80] = '\0';
+  for (size_t i = strlen(buf); i < 80; i++)
+    buf[i] = '\0';
+
+  cs_file_write_global(f, buf, 1, 80);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to reduced-order file writer.
+ *
+ * Only every Nth vertex or element along a Peano-Hilbert curve is output,
+ * and field values are quantized by blocks of consecutive samples, each
+ * block using its own offset and scale per component.
+ *
+ * Options are:
+ *   bits=<n>            bits per quantized value: 8, 16 (default),
+ *                       or 32 for unquantized (float) values
+ *   decimate=<n>        output every nth vertex or element (default: 1)
+ *   block_size=<n>      number of samples per quantization block
+ *                       (default: 1024)
+ *
+ * Files are binary, in big-endian byte order; strings are padded
+ * to 80 characters. Sample coordinates are written to <name>.coords
+ * (with a time step suffix for time-dependent meshes), containing:
+ *   "Code_Saturne reduced-order sample coordinates"
+ *   then, for "vertices" and "elements" in turn:
+ *     location name, int64 {n_g_samples, decimation},
+ *     float coordinates (n_g_samples*3, interlaced).
+ * Each field is written to <name>.<field>.<time step>, containing:
+ *   "Code_Saturne reduced-order field", field name, location name,
+ *   int64 {time step, n_g_samples, dimension, bits, block_size,
+ *          decimation}, double time value,
+ *   then, with 32 bits, float values (n_g_samples*dimension, interlaced),
+ *   otherwise float {offset, scale} for each quantization block and
+ *   component, then 8 or 16-bit unsigned values q (n_g_samples*dimension,
+ *   interlaced), with v ~ offset + q*scale (to half a step).
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque reduced-order writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_reduced_init_writer(const char             *name,
+                           const char             *path,
+                           const char             *options,
+                           fvm_writer_time_dep_t   time_dependency,
+                           MPI_Comm                comm)
+#else
+void *
+fvm_to_reduced_init_writer(const char             *name,
+                           const char             *path,
+                           const char             *options,
+                           fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_reduced_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_reduced_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  BFT_MALLOC(w->path, strlen(path) + 1, char);
+  strcpy(w->path, path);
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks, min_rank_step, min_block_size;
+    MPI_Comm w_block_comm, w_comm;
+    w->min_rank_step = 1;
+    w->min_block_size = 1024*1024*8;
+    w->block_comm = MPI_COMM_NULL;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+      cs_file_get_default_comm(&min_rank_step, &min_block_size,
+                               &w_block_comm, &w_comm);
+      if (comm == w_comm) {
+        w->min_rank_step = min_rank_step;
+        w->min_block_size = min_block_size;
+        w->block_comm = w_block_comm;
+      }
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Defaults */
+
+  w->time_dependency = time_dependency;
+
+  w->nt = -1;
+  w->t = -1;
+
+  w->n_bits = 16;
+  w->decimation = 1;
+  w->q_block_size = 1024;
+
+  w->mesh = NULL;
+  _sampling_init(w->sampling);
+  _sampling_init(w->sampling + 1);
+
+  /* Parse options */
+
+  if (options != NULL) {
+
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      l_opt = i2 - i1;
+
+      if (strncmp(options + i1, "bits=", 5) == 0) {
+        const char *s = options + i1 + 5;
+        int nb, nr;
+        nr = sscanf(s, "%d", &nb);
+        if (nr == 1) {
+          if (nb == 8 || nb == 16 || nb == 32)
+            w->n_bits = nb;
+          else
+            bft_error(__FILE__, __LINE__, 0,
+                      _("Reduced-order writer \"%s\":\n"
+                        "unsupported option \"%.*s\" (use 8, 16, or 32)."),
+                      name, l_opt, options + i1);
+        }
+      }
+      else if (strncmp(options + i1, "decimate=", 9) == 0) {
+        const char *s = options + i1 + 9;
+        int n, nr;
+        nr = sscanf(s, "%d", &n);
+        if (nr == 1 && n > 0)
+          w->decimation = n;
+      }
+      else if (strncmp(options + i1, "block_size=", 11) == 0) {
+        const char *s = options + i1 + 11;
+        int n, nr;
+        nr = sscanf(s, "%d", &n);
+        if (nr == 1 && n > 0)
+          w->q_block_size = n;
+      }
+
+      for (i1 = i2 + 1 ; i1 < l_tot && options[i1] == ' ' ; i1++);
+
+    }
+
+  }
+
+  /* Return writer */
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to reduced-order file writer.
+ *
+ * parameters:
+ *   writer <-- pointer to opaque reduced-order writer structure.
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_reduced_finalize_writer(void  *writer)
+{
+  fvm_to_reduced_writer_t  *w
+    = (fvm_to_reduced_writer_t *)writer;
+
+  BFT_FREE(w->name);
+  BFT_FREE(w->path);
+
+  _sampling_free(w->sampling);
+  _sampling_free(w->sampling + 1);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with a reduced-order geometry.
+ *
+ * parameters:
+ *   writer     <-- pointer to associated writer
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_set_mesh_time(void          *writer,
+                             const int      time_step,
+                             const double   time_value)
+{
+  fvm_to_reduced_writer_t  *w = (fvm_to_reduced_writer_t *)writer;
+
+  w->nt = time_step;
+  w->t = time_value;
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh sample coordinates to a reduced-order file.
+ *
+ * The vertex and element samples used for subsequent field outputs
+ * are also determined here.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer.
+ *   mesh   <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_export_nodal(void               *writer,
+                            const fvm_nodal_t  *mesh)
+{
+  fvm_to_reduced_writer_t  *w = (fvm_to_reduced_writer_t *)writer;
+
+  const int time_step
+    = (w->time_dependency == FVM_WRITER_FIXED_MESH) ? -1 : w->nt;
+
+  cs_file_t *f = _open_file(w, "coords", time_step);
+
+  _write_string(f, "Code_Saturne reduced-order sample coordinates");
+
+  for (int l_id = 0; l_id < 2; l_id++) {
+
+    _sampling_t *s = w->sampling + l_id;
+    float *coords = NULL;
+
+    _build_sampling(w,
+                    mesh,
+                    (l_id == 0) ? FVM_WRITER_PER_NODE : FVM_WRITER_PER_ELEMENT,
+                    s,
+                    &coords);
+
+    coords = _sample_values_to_block(s, 3, coords);
+
+    int64_t header[2] = {s->n_g_samples, w->decimation};
+
+    _write_string(f, _location_name[l_id]);
+    cs_file_write_global(f, header, sizeof(int64_t), 2);
+
+    cs_file_write_block_buffer(f,
+                               coords,
+                               sizeof(float),
+                               3,
+                               s->bi.gnum_range[0],
+                               s->bi.gnum_range[1]);
+
+    BFT_FREE(coords);
+
+  }
+
+  cs_file_free(f);
+
+  w->mesh = mesh;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to a reduced-order file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_export_field(void                  *writer,
+                            const fvm_nodal_t     *mesh,
+                            const char            *name,
+                            fvm_writer_var_loc_t   location,
+                            int                    dimension,
+                            cs_interlace_t         interlace,
+                            int                    n_parent_lists,
+                            const cs_lnum_t        parent_num_shift[],
+                            cs_datatype_t          datatype,
+                            int                    time_step,
+                            double                 time_value,
+                            const void      *const field_values[])
+{
+  fvm_to_reduced_writer_t  *w = (fvm_to_reduced_writer_t *)writer;
+
+  if (dimension < 1)
+    return;
+
+  /* If time step changes, update it */
+
+  if (time_step != w->nt)
+    fvm_to_reduced_set_mesh_time(writer,
+                                 time_step,
+                                 time_value);
+
+  /* Samples are defined when exporting the mesh */
+
+  if (mesh != w->mesh)
+    fvm_to_reduced_export_nodal(writer, mesh);
+
+  const int l_id = (location == FVM_WRITER_PER_ELEMENT) ? 1 : 0;
+  const _sampling_t *s = w->sampling + l_id;
+
+  /* Gather local values (interlaced) */
+
+  cs_lnum_t n_part = 0;
+  float *src_vals = NULL;
+
+  if (location == FVM_WRITER_PER_ELEMENT) {
+
+    const int entity_dim = fvm_nodal_get_max_entity_dim(mesh);
+    if (entity_dim > 0)
+      n_part = fvm_nodal_get_n_entities(mesh, entity_dim);
+
+    BFT_MALLOC(src_vals, n_part*dimension, float);
+
+    cs_lnum_t num_shift = 0;
+
+    for (int i = 0; i < mesh->n_sections && entity_dim > 0; i++) {
+
+      const fvm_nodal_section_t  *section = mesh->sections[i];
+
+      if (section->entity_dim != entity_dim)
+        continue;
+
+      cs_lnum_t src_shift = (n_parent_lists == 0) ? num_shift : 0;
+
+      fvm_convert_array(dimension,
+                        0,
+                        dimension,
+                        src_shift,
+                        section->n_elements + src_shift,
+                        interlace,
+                        datatype,
+                        CS_FLOAT,
+                        n_parent_lists,
+                        parent_num_shift,
+                        section->parent_element_num,
+                        field_values,
+                        src_vals + num_shift*dimension);
+
+      num_shift += section->n_elements;
+
+    }
+
+  }
+  else {
+
+    n_part = mesh->n_vertices;
+
+    BFT_MALLOC(src_vals, n_part*dimension, float);
+
+    fvm_convert_array(dimension,
+                      0,
+                      dimension,
+                      0,
+                      n_part,
+                      interlace,
+                      datatype,
+                      CS_FLOAT,
+                      n_parent_lists,
+                      parent_num_shift,
+                      mesh->parent_vertex_num,
+                      field_values,
+                      src_vals);
+
+#if defined(HAVE_MPI)
+    if (s->d_src != NULL) {
+      float *block_vals = NULL;
+      BFT_MALLOC(block_vals, s->n_src*dimension, float);
+      cs_part_to_block_copy_array(s->d_src,
+                                  CS_FLOAT,
+                                  dimension,
+                                  src_vals,
+                                  block_vals);
+      BFT_FREE(src_vals);
+      src_vals = block_vals;
+    }
+#endif
+
+  }
+
+  /* Extract samples and distribute them to blocks */
+
+  float *vals = NULL;
+  BFT_MALLOC(vals, s->n_samples*dimension, float);
+
+  for (cs_lnum_t i = 0; i < s->n_samples; i++) {
+    const float *v = src_vals + s->sample_id[i]*dimension;
+    for (int j = 0; j < dimension; j++)
+      vals[i*dimension + j] = v[j];
+  }
+
+  BFT_FREE(src_vals);
+
+  vals = _sample_values_to_block(s, dimension, vals);
+
+  /* Write header */
+
+  cs_file_t *f = _open_file(w, name, time_step);
+
+  int64_t header[6] = {time_step,
+                       s->n_g_samples,
+                       dimension,
+                       w->n_bits,
+                       w->q_block_size,
+                       w->decimation};
+  double t = time_value;
+
+  _write_string(f, "Code_Saturne reduced-order field");
+  _write_string(f, name);
+  _write_string(f, _location_name[l_id]);
+
+  cs_file_write_global(f, header, sizeof(int64_t), 6);
+  cs_file_write_global(f, &t, sizeof(double), 1);
+
+  /* Write values */
+
+  const cs_gnum_t *gnum_range = s->bi.gnum_range;
+  const cs_lnum_t n_block = gnum_range[1] - gnum_range[0];
+
+  if (w->n_bits == 32)
+    cs_file_write_block_buffer(f,
+                               vals,
+                               sizeof(float),
+                               dimension,
+                               gnum_range[0],
+                               gnum_range[1]);
+
+  else {
+
+    /* Quantization block range (samples are aligned on blocks) */
+
+    const cs_gnum_t q_size = w->q_block_size;
+    cs_gnum_t q_range[2];
+    for (int i = 0; i < 2; i++)
+      q_range[i] = (gnum_range[i] - 1 + q_size - 1) / q_size + 1;
+
+    const size_t q_val_size = w->n_bits / 8;
+    float *q_params = NULL;
+    unsigned char *q_vals = NULL;
+
+    BFT_MALLOC(q_params, (q_range[1] - q_range[0])*dimension*2, float);
+    BFT_MALLOC(q_vals, n_block*dimension*q_val_size, unsigned char);
+
+    _quantize(n_block,
+              dimension,
+              w->q_block_size,
+              w->n_bits,
+              vals,
+              q_params,
+              q_vals);
+
+    cs_file_write_block_buffer(f,
+                               q_params,
+                               sizeof(float),
+                               dimension*2,
+                               q_range[0],
+                               q_range[1]);
+
+    cs_file_write_block_buffer(f,
+                               q_vals,
+                               q_val_size,
+                               dimension,
+                               gnum_range[0],
+                               gnum_range[1]);
+
+    BFT_FREE(q_vals);
+    BFT_FREE(q_params);
+
+  }
+
+  BFT_FREE(vals);
+
+  cs_file_free(f);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,201 @@
+#ifndef __FVM_TO_REDUCED_H__
+#define __FVM_TO_REDUCED_H__
+
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to reduced-order (decimated and quantized) binary files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_writer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to reduced-order file writer.
+ *
+ * Only every Nth vertex or element along a Peano-Hilbert curve is output,
+ * and field values are quantized by blocks of consecutive samples, each
+ * block using its own offset and scale per component.
+ *
+ * Options are:
+ *   bits=<n>            bits per quantized value: 8, 16 (default),
+ *                       or 32 for unquantized (float) values
+ *   decimate=<n>        output every nth vertex or element (default: 1)
+ *   block_size=<n>      number of samples per quantization block
+ *                       (default: 1024)
+ *
+ * Files are binary, in big-endian byte order; strings are padded
+ * to 80 characters. Sample coordinates are written to <name>.coords
+ * (with a time step suffix for time-dependent meshes), containing:
+ *   "Code_Saturne reduced-order sample coordinates"
+ *   then, for "vertices" and "elements" in turn:
+ *     location name, int64 {n_g_samples, decimation},
+ *     float coordinates (n_g_samples*3, interlaced).
+ * Each field is written to <name>.<field>.<time step>, containing:
+ *   "Code_Saturne reduced-order field", field name, location name,
+ *   int64 {time step, n_g_samples, dimension, bits, block_size,
+ *          decimation}, double time value,
+ *   then, with 32 bits, float values (n_g_samples*dimension, interlaced),
+ *   otherwise float {offset, scale} for each quantization block and
+ *   component, then 8 or 16-bit unsigned values q (n_g_samples*dimension,
+ *   interlaced), with v ~ offset + q*scale (to half a step).
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque reduced-order writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+void *
+fvm_to_reduced_init_writer(const char             *name,
+                           const char             *path,
+                           const char             *options,
+                           fvm_writer_time_dep_t   time_dependency,
+                           MPI_Comm                comm);
+
+#else
+
+void *
+fvm_to_reduced_init_writer(const char             *name,
+                           const char             *path,
+                           const char             *options,
+                           fvm_writer_time_dep_t   time_dependency);
+
+#endif
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to reduced-order file writer.
+ *
+ * parameters:
+ *   writer <-- pointer to opaque reduced-order writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_reduced_finalize_writer(void  *writer);
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with a reduced-order geometry.
+ *
+ * parameters:
+ *   writer     <-- pointer to associated writer
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_set_mesh_time(void          *writer,
+                             const int      time_step,
+                             const double   time_value);
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh sample coordinates to a reduced-order file.
+ *
+ * The vertex and element samples used for subsequent field outputs
+ * are also determined here.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer.
+ *   mesh   <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_export_nodal(void               *writer,
+                            const fvm_nodal_t  *mesh);
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to a reduced-order file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_reduced_export_field(void                  *writer,
+                            const fvm_nodal_t     *mesh,
+                            const char            *name,
+                            fvm_writer_var_loc_t   location,
+                            int                    dimension,
+                            cs_interlace_t         interlace,
+                            int                    n_parent_lists,
+                            const cs_lnum_t        parent_num_shift[],
+                            cs_datatype_t          datatype,
+                            int                    time_step,
+                            double                 time_value,
+                            const void      *const field_values[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __FVM_TO_REDUCED_H__ */
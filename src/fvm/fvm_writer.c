@@ -71,6 +71,7 @@
 #include "fvm_to_ensight.h"
 #include "fvm_to_histogram.h"
 #include "fvm_to_plot.h"
+#include "fvm_to_reduced.h"
 #include "fvm_to_time_plot.h"
 
 #if defined(HAVE_CATALYST) && !defined(HAVE_PLUGIN_CATALYST)
@@ -107,9 +108,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -422,6 +423,29 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     NULL,
     NULL
 #endif
+  },
+
+  /* Built-in reduced-order (decimated and quantized) writer */
+  {
+    "reduced",
+    "",
+    (  FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON
+     | FVM_WRITER_FORMAT_SEPARATE_MESHES),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                 /* dynamic library count */
+    NULL,                              /* dynamic library */
+    NULL,                              /* dynamic library name */
+    NULL,                              /* dynamic library prefix */
+    NULL,                              /* n_version_strings_func */
+    NULL,                              /* version_string_func */
+    fvm_to_reduced_init_writer,        /* init_func */
+    fvm_to_reduced_finalize_writer,    /* finalize_func */
+    fvm_to_reduced_set_mesh_time,      /* set_mesh_time_func */
+    NULL,                              /* needs_tesselation_func */
+    fvm_to_reduced_export_nodal,       /* export_nodal_func */
+    fvm_to_reduced_export_field,       /* export_field_func */
+    NULL                               /* flush_func */
   }
 
 };
@@ -1065,6 +1089,14 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          write elements in rank order, directly from each
+ *                       rank's partition (binary files in parallel only)
+ *   bits=<n>            bits per quantized value (8 or 16), or 32 for
+ *                       unquantized values (reduced-order files only)
+ *   decimate=<n>        output every nth vertex or element along a
+ *                       Peano-Hilbert curve (reduced-order files only)
+ *   block_size=<n>      number of samples per quantization block
+ *                       (reduced-order files only)
  *   separate_meshes     use a different writer for each mesh
  *
  * parameters:
@@ -218,6 +218,14 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          write elements in rank order, directly from each
+ *                       rank's partition (binary files in parallel only)
+ *   bits=<n>            bits per quantized value (8 or 16), or 32 for
+ *                       unquantized values (reduced-order files only)
+ *   decimate=<n>        output every nth vertex or element along a
+ *                       Peano-Hilbert curve (reduced-order files only)
+ *   block_size=<n>      number of samples per quantization block
+ *                       (reduced-order files only)
  *   separate_meshes     use a different writer for each mesh
  *
  * parameters:
@@ -251,6 +251,74 @@ _update_cell_b_faces(cs_mesh_adjacencies_t  *ma)
   cs_sort_indexed(n_cells, c2b_idx, c2b);
 }
 
+/*----------------------------------------------------------------------------
+ * Update cells -> interior faces connectivity
+ *
+ * For each cell, faces are sorted by increasing id, and an orientation
+ * of +1 is associated to faces for which the cell is the first adjacent
+ * cell, -1 otherwise.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_i_faces(cs_mesh_adjacencies_t  *ma)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  /* (re)build cell -> interior faces index */
+
+  BFT_REALLOC(ma->cell_i_faces_idx, n_cells + 1, cs_lnum_t);
+  cs_lnum_t *c2f_idx = ma->cell_i_faces_idx;
+
+  cs_lnum_t *c2f_count;
+  BFT_MALLOC(c2f_count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c2f_count[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+    for (int j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[i][j];
+      if (c_id < n_cells)
+        c2f_count[c_id] += 1;
+    }
+  }
+
+  c2f_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    c2f_idx[i+1] = c2f_idx[i] + c2f_count[i];
+    c2f_count[i] = 0;
+  }
+
+  /* Rebuild values; as faces are scanned in increasing order,
+     entries are already sorted for each cell */
+
+  BFT_REALLOC(ma->cell_i_faces, c2f_idx[n_cells], cs_lnum_t);
+  BFT_REALLOC(ma->cell_i_faces_sgn, c2f_idx[n_cells], short int);
+  cs_lnum_t *c2f = ma->cell_i_faces;
+  short int *c2f_sgn = ma->cell_i_faces_sgn;
+
+  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+    for (int j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[i][j];
+      if (c_id < n_cells) {
+        cs_lnum_t k = c2f_idx[c_id] + c2f_count[c_id];
+        c2f[k] = i;
+        c2f_sgn[k] = (j == 0) ? 1 : -1;
+        c2f_count[c_id] += 1;
+      }
+    }
+  }
+
+  BFT_FREE(c2f_count);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update the v2v index with the data from the given face connectivity.
@@ -489,6 +557,10 @@ cs_mesh_adjacencies_initialize(void)
   ma->cell_b_faces_idx = NULL;
   ma->cell_b_faces = NULL;
 
+  ma->cell_i_faces_idx = NULL;
+  ma->cell_i_faces = NULL;
+  ma->cell_i_faces_sgn = NULL;
+
   ma->c2v = NULL;
   ma->_c2v = NULL;
 
@@ -512,6 +584,10 @@ cs_mesh_adjacencies_finalize(void)
   BFT_FREE(ma->cell_b_faces_idx);
   BFT_FREE(ma->cell_b_faces);
 
+  BFT_FREE(ma->cell_i_faces_idx);
+  BFT_FREE(ma->cell_i_faces);
+  BFT_FREE(ma->cell_i_faces_sgn);
+
   cs_adjacency_destroy(&(ma->_c2v));
 
   cs_glob_mesh_adjacencies = NULL;
@@ -540,6 +616,11 @@ cs_mesh_adjacencies_update_mesh(void)
 
   _update_cell_b_faces(ma);
 
+  /* (re)build cell -> interior face connectivities if previously requested */
+
+  if (ma->cell_i_faces_idx != NULL)
+    _update_cell_i_faces(ma);
+
   /* (re)build or map cell -> vertex connectivities */
 
   if (ma->c2v != NULL)
@@ -564,6 +645,24 @@ cs_mesh_adjacencies_update_cell_cells_e(void)
   ma->cell_cells_e = m->cell_cells_lst;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build or update cell -> interior faces connectivites in
+ *         mesh adjacencies helper API relative to mesh.
+ *
+ * This connectivity is built only when first requested, then updated
+ * later if needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_i_faces(void)
+{
+  cs_mesh_adjacencies_t *ma = &_cs_glob_mesh_adjacencies;
+
+  _update_cell_i_faces(ma);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return cell -> vertex connectivites in
@@ -100,6 +100,15 @@ typedef struct {
   cs_lnum_t        *cell_b_faces_idx;  /*!< cells to boundary faces index */
   cs_lnum_t        *cell_b_faces;      /*!< cells to boundary faces adjacency */
 
+  /* cells -> interior faces connectivity (built on demand) */
+
+  cs_lnum_t        *cell_i_faces_idx;  /*!< cells to interior faces index,
+                                         or NULL if not built */
+  cs_lnum_t        *cell_i_faces;      /*!< cells to interior faces adjacency */
+  short int        *cell_i_faces_sgn;  /*!< +1 if the cell is the first
+                                         cell adjacent to the face,
+                                         -1 if it is the second */
+
   /* cells -> vertices connectivity */
 
   const cs_adjacency_t  *c2v;          /*!< cells to vertices adjacency */
@@ -158,6 +167,19 @@ cs_mesh_adjacencies_update_mesh(void);
 void
 cs_mesh_adjacencies_update_cell_cells_e(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build or update cell -> interior faces connectivites in
+ *         mesh adjacencies helper API relative to mesh.
+ *
+ * This connectivity is built only when first requested, then updated
+ * later if needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_i_faces(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return cell -> vertex connectivites in
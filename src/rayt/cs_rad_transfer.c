@@ -58,6 +58,8 @@
 #include "cs_sles_it.h"
 #include "cs_timer.h"
 
+#include "cs_rad_transfer_solve.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -250,7 +252,9 @@ cs_rad_transfer_params_t _rt_params = {.type = CS_RAD_TRANSFER_NONE,
                                        .ifinfe = 5,
                                        .atmo_ir_absorption = false,
                                        .dispersion = false,
-                                       .dispersion_coeff = 1.};
+                                       .dispersion_coeff = 1.,
+                                       .dir_batch = 0,
+                                       .upwind_sweep = false};
 
 cs_rad_transfer_params_t *cs_glob_rad_transfer_params = &_rt_params;
 
@@ -301,6 +305,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_solve_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -124,6 +124,19 @@ typedef struct {
                                        value of 1 already improves precision in
                                        both cases. */
 
+  int           dir_batch;           /*!< DOM directions solved simultaneously
+                                       (sharing mesh traversals and global
+                                       reductions) in the absence of
+                                       dispersion:
+                                       - 0: one direction at a time
+                                       - 1: directions of each octant
+                                       - 2: all directions */
+  bool          upwind_sweep;        /*!< solve DOM radiance directly, using
+                                       a sweep of cells ordered along each
+                                       direction, in the absence of
+                                       dispersion (directions with cyclic
+                                       dependencies are solved
+                                       iteratively) */
 
 } cs_rad_transfer_params_t;
 
@@ -341,6 +341,15 @@ cs_rad_transfer_log_setup(void)
         (CS_LOG_SETUP,
          _("    ndirec:                 %3d\n"),
          cs_glob_rad_transfer_params->ndirec);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    dir_batch:              %3d  (0: none, 1: per octant, 2: all "
+         "directions solved together)\n"),
+       cs_glob_rad_transfer_params->dir_batch);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    upwind_sweep:           %3s  (direct sweep along directions)\n"),
+       (cs_glob_rad_transfer_params->upwind_sweep) ? "on" : "off");
   }
 
   cs_log_printf
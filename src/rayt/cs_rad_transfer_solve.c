@@ -40,6 +40,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -102,10 +106,30 @@ static int ipadom = 0;
  * Local Macro Definitions
  *============================================================================*/
 
+/* Number of directions handled together in batched dot products */
+
+#define CS_RAD_DOT_CHUNK  8
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
 
+/* Upwind sweep structures for DOM radiance directions */
+
+typedef struct {
+
+  int          n_dirs;     /* number of directions */
+
+  cs_lnum_t   *c2f_idx;    /* cells -> interior faces index */
+  cs_lnum_t   *c2f;        /* cells -> interior faces adjacency */
+
+  bool        *acyclic;    /* true for directions whose upwind dependency
+                              graph is acyclic on all ranks */
+
+} _rad_sweep_t;
+
+static _rad_sweep_t  *_sweep = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -296,6 +320,962 @@ _order_by_direction(void)
   BFT_FREE(s);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute direction vector and solid angle for a given global direction id.
+ *
+ * Directions are numbered by octant (with the sign of x, then y, then z
+ * components going from negative to positive, as in the solver loops),
+ * then by direction id in the quadrature.
+ *
+ * parameters:
+ *   kdir    <-- global (0-based) direction id
+ *   vect_s  --> direction vector
+ *   domegat --> associated solid angle
+ *----------------------------------------------------------------------------*/
+
+static void
+_direction_vector(int         kdir,
+                  cs_real_t   vect_s[3],
+                  cs_real_t  *domegat)
+{
+  const int ndirs = cs_glob_rad_transfer_params->ndirs;
+  const int octant = kdir / ndirs;
+  const int dir_id = kdir % ndirs;
+
+  const int ii = (octant & 4) ? 1 : -1;
+  const int jj = (octant & 2) ? 1 : -1;
+  const int kk = (octant & 1) ? 1 : -1;
+
+  vect_s[0] = ii * cs_glob_rad_transfer_params->vect_s[dir_id][0];
+  vect_s[1] = jj * cs_glob_rad_transfer_params->vect_s[dir_id][1];
+  vect_s[2] = kk * cs_glob_rad_transfer_params->vect_s[dir_id][2];
+
+  *domegat = cs_glob_rad_transfer_params->angsol[dir_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Build upwind sweep structures for DOM radiance directions.
+ *
+ * For each direction, the local upwind dependency graph (ghost cells
+ * being considered as sources) is checked for cycles; directions with
+ * cycles on any rank may not be swept.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_sweep(void)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->i_face_normal;
+
+  const int n_dirs = 8 * cs_glob_rad_transfer_params->ndirs;
+
+  BFT_MALLOC(_sweep, 1, _rad_sweep_t);
+
+  _sweep->n_dirs = n_dirs;
+
+  /* Cells -> interior faces adjacency */
+
+  BFT_MALLOC(_sweep->c2f_idx, n_cells + 1, cs_lnum_t);
+
+  cs_lnum_t *c2f_idx = _sweep->c2f_idx;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    c2f_idx[c_id] = 0;
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[face_id][k];
+      if (c_id < n_cells)
+        c2f_idx[c_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c2f_idx[c_id + 1] += c2f_idx[c_id];
+
+  BFT_MALLOC(_sweep->c2f, c2f_idx[n_cells], cs_lnum_t);
+
+  cs_lnum_t *c2f = _sweep->c2f;
+  cs_lnum_t *count;
+  BFT_MALLOC(count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    count[c_id] = 0;
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[face_id][k];
+      if (c_id < n_cells) {
+        c2f[c2f_idx[c_id] + count[c_id]] = face_id;
+        count[c_id] += 1;
+      }
+    }
+  }
+
+  /* Topological ordering for each direction (Kahn's algorithm);
+     count is used for the number of unprocessed upwind local cells */
+
+  BFT_MALLOC(_sweep->acyclic, n_dirs, bool);
+
+  int *is_cyclic;
+  cs_lnum_t *order;
+  BFT_MALLOC(is_cyclic, n_dirs, int);
+  BFT_MALLOC(order, n_cells, cs_lnum_t);
+
+  for (int kdir = 0; kdir < n_dirs; kdir++) {
+
+    cs_real_t vect_s[3], domegat;
+    _direction_vector(kdir, vect_s, &domegat);
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      count[c_id] = 0;
+
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+      cs_real_t flux = cs_math_3_dot_product(vect_s, i_face_normal[face_id]);
+      if (flux > 0. && ii < n_cells && jj < n_cells)
+        count[jj] += 1;
+      else if (flux < 0. && ii < n_cells && jj < n_cells)
+        count[ii] += 1;
+    }
+
+    cs_lnum_t n_ordered = 0;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (count[c_id] == 0)
+        order[n_ordered++] = c_id;
+    }
+
+    /* The order array is also used as a queue */
+
+    for (cs_lnum_t k = 0; k < n_ordered; k++) {
+      cs_lnum_t c_id = order[k];
+      for (cs_lnum_t i = c2f_idx[c_id]; i < c2f_idx[c_id+1]; i++) {
+        cs_lnum_t face_id = c2f[i];
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+        cs_real_t flux = cs_math_3_dot_product(vect_s,
+                                               i_face_normal[face_id]);
+        cs_lnum_t c_id_d = -1;
+        if (ii == c_id && flux > 0.)
+          c_id_d = jj;
+        else if (jj == c_id && flux < 0.)
+          c_id_d = ii;
+        if (c_id_d > -1 && c_id_d < n_cells) {
+          count[c_id_d] -= 1;
+          if (count[c_id_d] == 0)
+            order[n_ordered++] = c_id_d;
+        }
+      }
+    }
+
+    is_cyclic[kdir] = (n_ordered < n_cells) ? 1 : 0;
+
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(count);
+
+  /* Directions with cycles on any rank are handled iteratively */
+
+  cs_parall_max(n_dirs, CS_INT_TYPE, is_cyclic);
+
+  int n_cyclic = 0;
+  for (int kdir = 0; kdir < n_dirs; kdir++) {
+    _sweep->acyclic[kdir] = (is_cyclic[kdir]) ? false : true;
+    if (is_cyclic[kdir])
+      n_cyclic++;
+  }
+
+  BFT_FREE(is_cyclic);
+
+  if (n_cyclic > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n  Radiative transfer: %d of %d directions have cyclic "
+                    "upwind dependencies\n"
+                    "  and will be solved iteratively.\n"),
+                  n_cyclic, n_dirs);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve upwind radiance transport systems for a batch of directions
+ * using direct sweeps along each direction.
+ *
+ * For each direction, the number of upwind neighbors not yet computed
+ * is maintained for each cell, and cells for which it reaches zero are
+ * added to a ready list, so each cell is visited only once.
+ *
+ * In parallel, each rank computes the cells whose upwind values are
+ * available, then ghost values and their status are exchanged, in
+ * successive stages (wavefront schedule). Directions of a batch are
+ * pipelined, sharing the same exchanges.
+ *
+ * parameters:
+ *   kdir_s    <-- first global (0-based) direction id of batch
+ *   n_b       <-- number of directions in batch
+ *   vect_s    <-- direction vectors
+ *   da        <-- diagonal (interlaced)
+ *   rhs       <-- right-hand side (interlaced)
+ *   radiance  <-> radiance for each direction (interlaced, with ghosts)
+ *   solved    --> true for directions which were swept
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_directions(int                kdir_s,
+                  int                n_b,
+                  const cs_real_3_t  vect_s[],
+                  const cs_real_t    da[],
+                  const cs_real_t    rhs[],
+                  cs_real_t          radiance[],
+                  bool               solved[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_ghosts = n_cells_ext - n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->i_face_normal;
+
+  const cs_lnum_t *c2f_idx = _sweep->c2f_idx;
+  const cs_lnum_t *c2f = _sweep->c2f;
+
+  /* Status of each value (1 when computed), and status of ghost values
+     already accounted for in the upwind counts */
+
+  unsigned char *done, *g_done;
+  BFT_MALLOC(done, (size_t)n_cells_ext*n_b, unsigned char);
+  BFT_MALLOC(g_done, (size_t)n_ghosts*n_b, unsigned char);
+
+  memset(done, 0, (size_t)n_cells_ext*n_b);
+  memset(g_done, 0, (size_t)n_ghosts*n_b);
+
+  /* Number of upwind values not yet available for each value,
+     and ready list (queue) of cells for each direction */
+
+  cs_lnum_t *n_up, *ready;
+  BFT_MALLOC(n_up, (size_t)n_cells*n_b, cs_lnum_t);
+  BFT_MALLOC(ready, (size_t)n_cells*n_b, cs_lnum_t);
+
+  cs_gnum_t *n_pending;
+  cs_lnum_t *r_start, *r_end;
+  BFT_MALLOC(n_pending, n_b + 1, cs_gnum_t);
+  BFT_MALLOC(r_start, n_b, cs_lnum_t);
+  BFT_MALLOC(r_end, n_b, cs_lnum_t);
+
+  for (int d = 0; d < n_b; d++) {
+
+    cs_lnum_t *_ready = ready + (size_t)n_cells*d;
+
+    n_pending[d] = (_sweep->acyclic[kdir_s + d]) ? n_cells : 0;
+    r_start[d] = 0;
+    r_end[d] = 0;
+
+    if (n_pending[d] == 0)
+      continue;
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      cs_lnum_t n = 0;
+      for (cs_lnum_t i = c2f_idx[c_id]; i < c2f_idx[c_id+1]; i++) {
+        cs_lnum_t face_id = c2f[i];
+        cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                               i_face_normal[face_id]);
+        if (   (i_face_cells[face_id][1] == c_id && flux > 0.)
+            || (i_face_cells[face_id][0] == c_id && flux < 0.))
+          n++;
+      }
+      n_up[c_id*n_b + d] = n;
+      if (n == 0)
+        _ready[r_end[d]++] = c_id;
+    }
+
+  }
+
+  /* Interior faces adjacent to ghost cells */
+
+  cs_lnum_t n_g_faces = 0;
+  cs_lnum_t *g_faces = NULL;
+
+  if (m->halo != NULL) {
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+      if (   i_face_cells[face_id][0] >= n_cells
+          || i_face_cells[face_id][1] >= n_cells)
+        n_g_faces++;
+    }
+    BFT_MALLOC(g_faces, n_g_faces, cs_lnum_t);
+    n_g_faces = 0;
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+      if (   i_face_cells[face_id][0] >= n_cells
+          || i_face_cells[face_id][1] >= n_cells)
+        g_faces[n_g_faces++] = face_id;
+    }
+  }
+
+  while (true) {
+
+    cs_gnum_t n_done = 0;
+
+    for (int d = 0; d < n_b; d++) {
+
+      cs_lnum_t *_ready = ready + (size_t)n_cells*d;
+
+      while (r_start[d] < r_end[d]) {
+
+        cs_lnum_t c_id = _ready[r_start[d]++];
+
+        cs_real_t s = rhs[c_id*n_b + d];
+
+        for (cs_lnum_t i = c2f_idx[c_id]; i < c2f_idx[c_id+1]; i++) {
+          cs_lnum_t face_id = c2f[i];
+          cs_lnum_t ii = i_face_cells[face_id][0];
+          cs_lnum_t jj = i_face_cells[face_id][1];
+          cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                                 i_face_normal[face_id]);
+          cs_lnum_t c_id_u = -1, c_id_d = -1;
+          if (jj == c_id) {
+            if (flux > 0.)
+              c_id_u = ii;
+            else if (flux < 0.)
+              c_id_d = ii;
+          }
+          else {
+            if (flux < 0.) {
+              c_id_u = jj;
+              flux = -flux;
+            }
+            else if (flux > 0.)
+              c_id_d = jj;
+          }
+          if (c_id_u > -1)
+            s += flux * radiance[c_id_u*n_b + d];
+          else if (c_id_d > -1 && c_id_d < n_cells) {
+            n_up[c_id_d*n_b + d] -= 1;
+            if (n_up[c_id_d*n_b + d] == 0)
+              _ready[r_end[d]++] = c_id_d;
+          }
+        }
+
+        radiance[c_id*n_b + d] = s / da[c_id*n_b + d];
+        done[c_id*n_b + d] = 1;
+        n_pending[d] -= 1;
+        n_done += 1;
+
+      }
+
+    }
+
+    if (cs_glob_n_ranks == 1 && m->halo == NULL)
+      break;
+
+    /* Check global progress; stop when all directions are complete
+       or no progress is possible (cyclic dependencies across ranks) */
+
+    n_pending[n_b] = 0;
+    for (int d = 0; d < n_b; d++)
+      n_pending[n_b] += n_pending[d];
+
+    cs_gnum_t counts[2] = {n_pending[n_b], n_done};
+    cs_parall_counter(counts, 2);
+
+    if (counts[0] == 0 || counts[1] == 0)
+      break;
+
+    if (m->halo == NULL)
+      continue;
+
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, radiance, n_b);
+    cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, n_b, done);
+
+    /* Update upwind counts of cells adjacent to newly computed ghosts */
+
+    for (cs_lnum_t f_idx = 0; f_idx < n_g_faces; f_idx++) {
+
+      cs_lnum_t face_id = g_faces[f_idx];
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+      cs_lnum_t c_id = (ii < n_cells) ? ii : jj;
+      cs_lnum_t g_id = (ii < n_cells) ? jj : ii;
+
+      for (int d = 0; d < n_b; d++) {
+
+        if (   done[g_id*n_b + d] == 0
+            || g_done[(g_id - n_cells)*n_b + d] != 0)
+          continue;
+
+        cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                               i_face_normal[face_id]);
+        if ((g_id == ii && flux > 0.) || (g_id == jj && flux < 0.)) {
+          n_up[c_id*n_b + d] -= 1;
+          if (n_up[c_id*n_b + d] == 0)
+            ready[(size_t)n_cells*d + r_end[d]++] = c_id;
+        }
+
+      }
+
+    }
+
+    memcpy(g_done, done + (size_t)n_cells*n_b, (size_t)n_ghosts*n_b);
+
+  }
+
+  cs_parall_counter(n_pending, n_b);
+
+  for (int d = 0; d < n_b; d++)
+    solved[d] = (_sweep->acyclic[kdir_s + d] && n_pending[d] == 0);
+
+  BFT_FREE(g_faces);
+  BFT_FREE(r_end);
+  BFT_FREE(r_start);
+  BFT_FREE(n_pending);
+  BFT_FREE(ready);
+  BFT_FREE(n_up);
+  BFT_FREE(g_done);
+  BFT_FREE(done);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute upwind radiance transport matrix-vector product for a batch
+ * of directions.
+ *
+ * Values are interlaced, so that all directions are handled in a single
+ * traversal of the mesh faces, and face fluxes are computed on the fly.
+ *
+ * parameters:
+ *   n_b     <-- number of directions in batch
+ *   vect_s  <-- direction vectors
+ *   da      <-- diagonal (interlaced, size: n_cells*n_b)
+ *   x       <-> input vector (interlaced, size: n_cells_ext*n_b);
+ *               ghost values are updated
+ *   y       --> resulting vector (interlaced, size: n_cells*n_b)
+ *----------------------------------------------------------------------------*/
+
+static void
+_batch_mat_vec(int                n_b,
+               const cs_real_3_t  vect_s[],
+               const cs_real_t    da[],
+               cs_real_t          x[],
+               cs_real_t          y[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->i_face_normal;
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, x, n_b);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells*n_b; i++)
+    y[i] = da[i] * x[i];
+
+  /* Contribution of upwind neighbors (non-conservative form) */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        for (int d = 0; d < n_b; d++) {
+          cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                                 i_face_normal[face_id]);
+          if (flux > 0.) {
+            if (jj < n_cells)
+              y[jj*n_b + d] -= flux * x[ii*n_b + d];
+          }
+          else {
+            if (ii < n_cells)
+              y[ii*n_b + d] += flux * x[jj*n_b + d];
+          }
+        }
+
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute local dot products for each direction of a batch.
+ *
+ * Each thread handles a fixed range of cells, and partial sums are added
+ * in thread order, so results do not depend on thread scheduling.
+ *
+ * parameters:
+ *   n_cells <-- number of cells
+ *   n_b     <-- number of directions in batch
+ *   x       <-- first vector (interlaced)
+ *   y       <-- second vector (interlaced)
+ *   s       --> dot product for each direction
+ *----------------------------------------------------------------------------*/
+
+static void
+_batch_dot(cs_lnum_t         n_cells,
+           int               n_b,
+           const cs_real_t   x[],
+           const cs_real_t   y[],
+           double            s[])
+{
+  int n_t = 1, n_t_max = 1;
+
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
+
+  double *t_s;
+  BFT_MALLOC(t_s, (size_t)n_t_max*n_b, double);
+
+# pragma omp parallel if(n_cells > CS_THR_MIN)
+  {
+    int t_id = 0, _n_t = 1;
+
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+    _n_t = omp_get_num_threads();
+    if (t_id == 0)
+      n_t = _n_t;
+#endif
+
+    cs_lnum_t t_n = (n_cells + _n_t - 1) / _n_t;
+    cs_lnum_t s_id = CS_MIN(t_id*t_n, n_cells);
+    cs_lnum_t e_id = CS_MIN(s_id + t_n, n_cells);
+
+    for (int d_s = 0; d_s < n_b; d_s += CS_RAD_DOT_CHUNK) {
+
+      const int n_d = CS_MIN(CS_RAD_DOT_CHUNK, n_b - d_s);
+
+      double _s[CS_RAD_DOT_CHUNK];
+
+      for (int d = 0; d < n_d; d++)
+        _s[d] = 0.;
+
+      for (cs_lnum_t c_id = s_id; c_id < e_id; c_id++) {
+        const cs_real_t *_x = x + c_id*n_b + d_s;
+        const cs_real_t *_y = y + c_id*n_b + d_s;
+        for (int d = 0; d < n_d; d++)
+          _s[d] += _x[d] * _y[d];
+      }
+
+      for (int d = 0; d < n_d; d++)
+        t_s[t_id*n_b + d_s + d] = _s[d];
+
+    }
+  }
+
+  for (int d = 0; d < n_b; d++)
+    s[d] = 0.;
+
+  for (int t_id = 0; t_id < n_t; t_id++) {
+    for (int d = 0; d < n_b; d++)
+      s[d] += t_s[t_id*n_b + d];
+  }
+
+  BFT_FREE(t_s);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the radiance transport equations for a batch of directions.
+ *
+ * The systems built here are the same as those built by
+ * cs_equation_iterative_solve_scalar with the pure upwind convection
+ * options used for the radiance (with no dispersion). When upwind sweep
+ * structures are available, directions with no cyclic dependencies are
+ * solved directly. Remaining directions are solved simultaneously using
+ * a Jacobi-preconditioned BiCGStab algorithm, sharing mesh traversals and
+ * global reductions, while convergence is tested separately for each
+ * direction.
+ *
+ * parameters:
+ *   kdir_s    <-- first global (0-based) direction id of batch
+ *   n_b       <-- number of directions in batch
+ *   vcopt     <-- variable calculation options
+ *   gg_id     <-- number of the i-th gray gas
+ *   w_gg      <-- weights of the i-th gray gas at boundaries
+ *   tempk     <-- temperature in Kelvin
+ *   bc_type   <-- boundary face types
+ *   coefap    <-> boundary condition work array for the radiance
+ *                 (explicit part)
+ *   coefbp    <-> boundary condition work array for the radiance
+ *                 (implicit part)
+ *   cofafp    <-> boundary condition work array for the diffusion
+ *                 of the radiance (explicit part)
+ *   cofbfp    <-> boundary condition work array for the diffusion
+ *                 of the radiance (implicit part)
+ *   rhs0      <-- explicit source term (shared by directions)
+ *   rovsdt0   <-- implicit source term (shared by directions)
+ *   radiance  --> radiance for each direction (interlaced,
+ *                 size: n_cells_ext*n_b)
+ *   solved    --> true for directions which converged
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_directions_batch(int                       kdir_s,
+                        int                       n_b,
+                        const cs_var_cal_opt_t   *vcopt,
+                        int                       gg_id,
+                        cs_real_t                 w_gg[],
+                        const cs_real_t           tempk[],
+                        int                       bc_type[],
+                        cs_real_t       *restrict coefap,
+                        cs_real_t       *restrict coefbp,
+                        cs_real_t       *restrict cofafp,
+                        cs_real_t       *restrict cofbfp,
+                        const cs_real_t           rhs0[],
+                        const cs_real_t           rovsdt0[],
+                        cs_real_t       *restrict radiance,
+                        bool                      solved[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells = m->b_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->i_face_normal;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_t *restrict cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  const cs_real_t c_stefan = cs_physical_constants_stephan;
+  const cs_real_t onedpi  = 1.0 / cs_math_pi;
+  const int n_max_iter = 10000;
+
+  const size_t n_b_cells = (size_t)n_cells*n_b;
+  const size_t n_b_cells_ext = (size_t)n_cells_ext*n_b;
+
+  cs_real_3_t *vect_s;
+  BFT_MALLOC(vect_s, n_b, cs_real_3_t);
+
+  cs_real_t *da, *ad_inv, *rhs;
+  BFT_MALLOC(da, n_b_cells, cs_real_t);
+  BFT_MALLOC(ad_inv, n_b_cells, cs_real_t);
+  BFT_MALLOC(rhs, n_b_cells, cs_real_t);
+
+  /* Diagonal and right-hand side: source terms */
+
+  const cs_real_t *ck_u = NULL, *ck_d = NULL;
+  if (cs_glob_rad_transfer_params->atmo_ir_absorption) {
+    ck_u = cs_field_by_name("rad_absorption_coeff_up")->val;
+    ck_d = cs_field_by_name("rad_absorption_coeff_down")->val;
+  }
+
+  for (int d = 0; d < n_b; d++) {
+
+    cs_real_t domegat;
+    _direction_vector(kdir_s + d, vect_s[d], &domegat);
+
+    if (cs_glob_rad_transfer_params->atmo_ir_absorption) {
+
+      const cs_real_t *grav = cs_glob_physical_constants->gravity;
+      const cs_real_t *ck = (cs_math_3_dot_product(grav, vect_s[d]) < 0.0) ?
+                            ck_u : ck_d;
+
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        cs_real_t ck_u_d = ck[c_id] * 3./5.;
+        da[c_id*n_b + d] = ck_u_d * cell_vol[c_id];
+        rhs[c_id*n_b + d] =   ck_u_d * cell_vol[c_id]
+                            * c_stefan * cs_math_pow4(tempk[c_id]) * onedpi;
+      }
+
+    }
+    else {
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        da[c_id*n_b + d] = rovsdt0[c_id];
+        rhs[c_id*n_b + d] = rhs0[c_id];
+      }
+    }
+
+  }
+
+  /* Contribution of interior faces to the diagonal
+     (inflow faces, in non-conservative form) */
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+    for (int d = 0; d < n_b; d++) {
+      cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                             i_face_normal[face_id]);
+      if (flux > 0.) {
+        if (jj < n_cells)
+          da[jj*n_b + d] += flux;
+      }
+      else if (ii < n_cells)
+        da[ii*n_b + d] -= flux;
+    }
+  }
+
+  /* Contribution of boundary faces to the diagonal and right-hand side */
+
+  for (int d = 0; d < n_b; d++) {
+
+    /* Update boundary condition coefficients */
+    if (cs_glob_rad_transfer_params->atmo_ir_absorption)
+      cs_rad_transfer_bc_coeffs(bc_type,
+                                vect_s[d],
+                                coefap, coefbp,
+                                cofafp, cofbfp,
+                                NULL, /* only usefull for P1 */
+                                w_gg,
+                                gg_id);
+
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+      cs_lnum_t ii = b_face_cells[face_id];
+      cs_real_t flux = cs_math_3_dot_product(vect_s[d],
+                                             b_face_normal[face_id]);
+      if (flux < 0.) {
+        da[ii*n_b + d] -= flux*(1. - coefbp[face_id]);
+        rhs[ii*n_b + d] -= flux*coefap[face_id];
+      }
+    }
+
+  }
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (size_t i = 0; i < n_b_cells; i++)
+    ad_inv[i] = (fabs(da[i]) > 0.) ? 1. / da[i] : 1.;
+
+  /* Preconditioned BiCGStab for all directions */
+
+  cs_real_t *_wa, *rk, *res0, *pk, *vk, *tk, *zk;
+  BFT_MALLOC(_wa, n_b_cells*5 + n_b_cells_ext, cs_real_t);
+  rk = _wa;
+  res0 = _wa + n_b_cells;
+  pk = _wa + n_b_cells*2;
+  vk = _wa + n_b_cells*3;
+  tk = _wa + n_b_cells*4;
+  zk = _wa + n_b_cells*5;       /* preconditioned vector, with ghosts */
+
+  double *s;
+  BFT_MALLOC(s, n_b*9, double);
+  double *r_norm = s + n_b*2, *rho = s + n_b*3, *alpha = s + n_b*4;
+  double *omega = s + n_b*5, *residue = s + n_b*6, *rho_old = s + n_b*7;
+  double *beta = s + n_b*8;
+
+  int *n_iter;
+  bool *active;
+  BFT_MALLOC(n_iter, n_b, int);
+  BFT_MALLOC(active, n_b, bool);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (size_t i = 0; i < n_b_cells; i++) {
+    rk[i] = rhs[i];
+    res0[i] = rhs[i];
+    pk[i] = 0.;
+    vk[i] = 0.;
+  }
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (size_t i = 0; i < n_b_cells_ext; i++) {
+    radiance[i] = 0.;
+    zk[i] = 0.;
+  }
+
+  /* Direct solution for directions which may be swept */
+
+  for (int d = 0; d < n_b; d++)
+    solved[d] = false;
+
+  if (_sweep != NULL) {
+
+    _sweep_directions(kdir_s, n_b, (const cs_real_3_t *)vect_s,
+                      da, rhs, radiance, solved);
+
+    /* A sweep stopped by cyclic dependencies leaves partial values,
+       used as initial solution: r = rhs - A.x */
+
+    bool partial = false;
+    for (int d = 0; d < n_b; d++) {
+      if (_sweep->acyclic[kdir_s + d] && !solved[d])
+        partial = true;
+    }
+
+    if (partial) {
+
+      _batch_mat_vec(n_b, (const cs_real_3_t *)vect_s, da, radiance, tk);
+
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (size_t i = 0; i < n_b_cells; i++) {
+        rk[i] = rhs[i] - tk[i];
+        res0[i] = rk[i];
+      }
+
+    }
+
+  }
+
+  /* The residual normalization is the norm of the right-hand side
+     (initial residual for a null solution) */
+
+  _batch_dot(n_cells, n_b, rhs, rhs, s);
+  _batch_dot(n_cells, n_b, rk, rk, s + n_b);
+  cs_parall_sum(2*n_b, CS_DOUBLE, s);
+
+  int n_active = 0;
+
+  for (int d = 0; d < n_b; d++) {
+    r_norm[d] = sqrt(s[d]);
+    residue[d] = sqrt(s[n_b + d]);
+    rho_old[d] = 1.;
+    alpha[d] = 1.;
+    omega[d] = 1.;
+    n_iter[d] = (solved[d]) ? -1 : 0;
+    if (r_norm[d] <= 0. || residue[d] <= vcopt->epsilo * r_norm[d])
+      solved[d] = true;
+    active[d] = !solved[d];
+    if (active[d])
+      n_active++;
+  }
+
+  int iter = 0;
+
+  while (n_active > 0 && iter < n_max_iter) {
+
+    /* rho = (r0, r) */
+
+    _batch_dot(n_cells, n_b, res0, rk, rho);
+    cs_parall_sum(n_b, CS_DOUBLE, rho);
+
+    for (int d = 0; d < n_b; d++) {
+      beta[d] = 0.;
+      if (active[d] && (fabs(rho[d]) < 1e-60 || fabs(omega[d]) < 1e-60)) {
+        active[d] = false;  /* breakdown */
+        n_active--;
+      }
+      if (active[d]) {
+        beta[d] = (rho[d] / rho_old[d]) * (alpha[d] / omega[d]);
+        rho_old[d] = rho[d];
+      }
+    }
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int d = 0; d < n_b; d++) {
+        size_t i = c_id*n_b + d;
+        pk[i] = rk[i] + beta[d]*(pk[i] - omega[d]*vk[i]);
+        zk[i] = pk[i] * ad_inv[i];
+      }
+    }
+
+    _batch_mat_vec(n_b, (const cs_real_3_t *)vect_s, da, zk, vk);
+
+    /* alpha = rho / (r0, v) */
+
+    _batch_dot(n_cells, n_b, res0, vk, s);
+    cs_parall_sum(n_b, CS_DOUBLE, s);
+
+    for (int d = 0; d < n_b; d++) {
+      alpha[d] = 0.;
+      if (active[d] && fabs(s[d]) < 1e-60) {
+        active[d] = false;
+        n_active--;
+      }
+      if (active[d])
+        alpha[d] = rho[d] / s[d];
+    }
+
+    /* x += alpha.M^-1.p, s = r - alpha.v (stored in r) */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int d = 0; d < n_b; d++) {
+        size_t i = c_id*n_b + d;
+        radiance[i] += alpha[d] * zk[i];
+        rk[i] -= alpha[d] * vk[i];
+        zk[i] = rk[i] * ad_inv[i];
+      }
+    }
+
+    _batch_mat_vec(n_b, (const cs_real_3_t *)vect_s, da, zk, tk);
+
+    /* omega = (t, s) / (t, t), in a single reduction */
+
+    _batch_dot(n_cells, n_b, tk, rk, s);
+    _batch_dot(n_cells, n_b, tk, tk, s + n_b);
+    cs_parall_sum(2*n_b, CS_DOUBLE, s);
+
+    for (int d = 0; d < n_b; d++) {
+      if (active[d] && s[n_b + d] > 0.)
+        omega[d] = s[d] / s[n_b + d];
+      else
+        omega[d] = 0.;
+    }
+
+    /* x += omega.M^-1.s, r = s - omega.t */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int d = 0; d < n_b; d++) {
+        size_t i = c_id*n_b + d;
+        radiance[i] += omega[d] * zk[i];
+        rk[i] -= omega[d] * tk[i];
+      }
+    }
+
+    iter++;
+
+    /* Convergence test for each direction */
+
+    _batch_dot(n_cells, n_b, rk, rk, s);
+    cs_parall_sum(n_b, CS_DOUBLE, s);
+
+    for (int d = 0; d < n_b; d++) {
+      if (active[d] == false)
+        continue;
+      n_iter[d] = iter;
+      residue[d] = sqrt(s[d]);
+      if (residue[d] <= vcopt->epsilo * r_norm[d]) {
+        solved[d] = true;
+        active[d] = false;
+        n_active--;
+      }
+    }
+
+  }
+
+  if (vcopt->iwarni > 0) {
+    for (int d = 0; d < n_b; d++) {
+      if (n_iter[d] < 0)
+        bft_printf(_("  radiation_%03d (batched): direct upwind sweep\n"),
+                   kdir_s + d + 1);
+      else
+        bft_printf(_("  radiation_%03d (batched): %s after %d iterations "
+                     "(residual %12.5e, norm %12.5e)\n"),
+                   kdir_s + d + 1,
+                   (solved[d]) ? _("converged") : _("not converged"),
+                   n_iter[d], residue[d], r_norm[d]);
+    }
+  }
+
+  BFT_FREE(active);
+  BFT_FREE(n_iter);
+  BFT_FREE(s);
+  BFT_FREE(_wa);
+  BFT_FREE(rhs);
+  BFT_FREE(ad_inv);
+  BFT_FREE(da);
+  BFT_FREE(vect_s);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Radiative flux and source term computation
@@ -535,6 +1515,29 @@ _cs_rad_transfer_sol(int                        gg_id,
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
     rovsdt[cell_id] = CS_MAX(rovsdt[cell_id], 0.0);
 
+  /* Batched solution of several directions; this is restricted
+     to the pure upwind case (the dispersion model uses reconstruction
+     and more than one sweep). */
+
+  int n_batch = 1;
+  if (   cs_glob_rad_transfer_params->dispersion == false
+      && cs_glob_mesh_quantities->has_disable_flag == 0) {
+    if (cs_glob_rad_transfer_params->dir_batch == 2)
+      n_batch = 8 * cs_glob_rad_transfer_params->ndirs;
+    else if (   cs_glob_rad_transfer_params->dir_batch == 1
+             || cs_glob_rad_transfer_params->upwind_sweep)
+      n_batch = cs_glob_rad_transfer_params->ndirs;
+    if (cs_glob_rad_transfer_params->upwind_sweep && _sweep == NULL)
+      _build_sweep();
+  }
+
+  cs_real_t *radiance_b = NULL;
+  bool *solved_b = NULL;
+  if (n_batch > 1) {
+    BFT_MALLOC(radiance_b, (size_t)n_cells_ext*n_batch, cs_real_t);
+    BFT_MALLOC(solved_b, n_batch, bool);
+  }
+
   /* Angular discretization */
 
   int kdir = 0;
@@ -546,6 +1549,22 @@ _cs_rad_transfer_sol(int                        gg_id,
         for (int dir_id = 0;
              dir_id < cs_glob_rad_transfer_params->ndirs;
              dir_id++) {
+
+          if (n_batch > 1 && kdir % n_batch == 0)
+            _solve_directions_batch(kdir,
+                                    n_batch,
+                                    &vcopt,
+                                    gg_id,
+                                    w_gg,
+                                    tempk,
+                                    bc_type,
+                                    coefap, coefbp,
+                                    cofafp, cofbfp,
+                                    rhs0,
+                                    rovsdt,
+                                    radiance_b,
+                                    solved_b);
+
           vect_s[0] = ii * cs_glob_rad_transfer_params->vect_s[dir_id][0];
           vect_s[1] = jj * cs_glob_rad_transfer_params->vect_s[dir_id][1];
           vect_s[2] = kk * cs_glob_rad_transfer_params->vect_s[dir_id][2];
@@ -634,40 +1653,50 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Resolution
              ---------- */
 
-          /* In case of a theta-scheme, set theta = 1;
-             no relaxation in steady case either */
-
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
-                                             1,   /* external sub-iteration */
-                                             -1,  /* f_id */
-                                             cname,
-                                             0,   /* iescap */
-                                             0,   /* imucpp */
-                                             -1,  /* normp */
-                                             &vcopt,
-                                             radiance_prev,
-                                             radiance_prev,
-                                             coefap,
-                                             coefbp,
-                                             cofafp,
-                                             cofbfp,
-                                             flurds,
-                                             flurdb,
-                                             viscf,
-                                             viscb,
-                                             viscf,
-                                             viscb,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             0, /* icvflb (upwind) */
-                                             NULL,
-                                             rovsdt,
-                                             rhs,
-                                             radiance,
-                                             dpvar,
-                                             NULL,
-                                             NULL);
+          const int b_id = (kdir - 1) % n_batch;
+
+          if (n_batch > 1 && solved_b[b_id]) {
+            for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+              radiance[cell_id] = radiance_b[cell_id*n_batch + b_id];
+          }
+          else {
+
+            /* In case of a theta-scheme, set theta = 1;
+               no relaxation in steady case either */
+
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
+                                               1,   /* external sub-iteration */
+                                               -1,  /* f_id */
+                                               cname,
+                                               0,   /* iescap */
+                                               0,   /* imucpp */
+                                               -1,  /* normp */
+                                               &vcopt,
+                                               radiance_prev,
+                                               radiance_prev,
+                                               coefap,
+                                               coefbp,
+                                               cofafp,
+                                               cofbfp,
+                                               flurds,
+                                               flurdb,
+                                               viscf,
+                                               viscb,
+                                               viscf,
+                                               viscb,
+                                               NULL,
+                                               NULL,
+                                               NULL,
+                                               0, /* icvflb (upwind) */
+                                               NULL,
+                                               rovsdt,
+                                               rhs,
+                                               radiance,
+                                               dpvar,
+                                               NULL,
+                                               NULL);
+
+          }
 
           /* Integration of fluxes and source terms
            * Increment absorption and emission for Atmo on the fly */
@@ -792,6 +1821,8 @@ _cs_rad_transfer_sol(int                        gg_id,
 
   /* Free memory */
 
+  BFT_FREE(solved_b);
+  BFT_FREE(radiance_b);
   BFT_FREE(ck_u_d);
   BFT_FREE(rhs0);
   BFT_FREE(dpvar);
@@ -2007,6 +3038,25 @@ cs_rad_transfer_solve(int               verbosity,
   BFT_FREE(iqpar);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures associated with the DOM radiance solution.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  if (_sweep == NULL)
+    return;
+
+  BFT_FREE(_sweep->acyclic);
+  BFT_FREE(_sweep->c2f);
+  BFT_FREE(_sweep->c2f_idx);
+
+  BFT_FREE(_sweep);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
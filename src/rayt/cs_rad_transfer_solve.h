@@ -76,6 +76,15 @@ cs_rad_transfer_solve(int               verbosity,
                       const cs_real_t   cp2ch[],
                       const int         ichcor[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures associated with the DOM radiance solution.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
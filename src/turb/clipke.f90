@@ -273,6 +273,8 @@ do ii = 1, 2
                                     vmin(ii:ii), vmax(ii:ii), iclpmn(ii),&
                                     iclpmx(1))
 
+  call field_update_state(ivarfl(ivar))
+
 enddo
 
 !===============================================================================
@@ -128,6 +128,8 @@ enddo
 
 call log_iteration_clipping_field(ivarfl(inusa), iclpnu(1), 0, vmin, vmax,iclpnu(1), iclmx(1))
 
+call field_update_state(ivarfl(inusa))
+
 return
 
 end subroutine
@@ -126,6 +126,8 @@ enddo
 
 call log_iteration_clipping_field(f_id, iclpmn(1), iclpmx(1), vmin, vmax,iclpmn(1), iclpmx(1))
 
+call field_update_state(f_id)
+
 return
 
 end
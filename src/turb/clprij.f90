@@ -257,6 +257,8 @@ do isou = 1, 7
                                     vmin(isou:isou), vmax(isou:isou),iclrij(isou),&
                                     icl_max)
 
+  call field_update_state(ivarfl(ivar))
+
 enddo
 return
 
@@ -514,6 +516,9 @@ call log_iteration_clipping_field(ivarfl(irij), icltot, 0,      &
 call log_iteration_clipping_field(ivarfl(iep), iclpep(1), 0,    &
                                   vmin(7), vmax(7),iclpep, iclep_max)
 
+call field_update_state(ivarfl(irij))
+call field_update_state(ivarfl(iep))
+
 return
 
 end subroutine clprij2
@@ -152,6 +152,8 @@ enddo
 
 call log_iteration_clipping_field(ivarfl(iphi), nclpmn(1), 0, vmin, vmax,nclpmn(1), nclpmx(1))
 
+call field_update_state(ivarfl(iphi))
+
 !===============================================================================
 !  2. Pour le BL-v2/k model, clipping de alpha a 0 pour les valeurs negatives
 !     et a 1 pour les valeurs superieurs a 1
@@ -196,6 +198,8 @@ if (iturb.eq.51) then
 
   call log_iteration_clipping_field(ivarfl(ial), nclpmn(1), nclpmx(1), vmin,vmax,nclpmn(1), nclpmx(1))
 
+  call field_update_state(ivarfl(ial))
+
 endif
 
 
@@ -1412,6 +1412,9 @@ call log_iteration_clipping_field(ivarfl(ik), iclipk(1), 0,    &
 call log_iteration_clipping_field(ivarfl(iomg), iclipw, 0,  &
                                   vrmin(2:2), vrmax(2:2),iclipk(1), iclpkmx(1))
 
+call field_update_state(ivarfl(ik))
+call field_update_state(ivarfl(iomg))
+
 !===============================================================================
 ! 16. Advanced reinit
 !===============================================================================
@@ -1467,6 +1470,10 @@ if (ntcabs.eq.1.and.reinit_turb.eq.1) then
     cvar_omg(iel) = ut2**3/(xkappa*15.d0*nu0/ut2)/(ut2**2/sqrt(cmu))/cmu
 
   enddo
+
+  call field_update_state(ivarfl(iu))
+  call field_update_state(ivarfl(ik))
+  call field_update_state(ivarfl(iomg))
 endif
 
 ! Free memory
@@ -294,6 +294,9 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PIPELINED_PCG       (pipelined conjugate gradient)
+   *  CS_SLES_GMRES_S_STEP        (s-step GMRES)
+   *  CS_SLES_BICGSTAB_S_STEP     (s-step BiCGStab)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -375,6 +378,22 @@ cs_user_linear_solvers(void)
        -1.0,           /* precision multiplier ascent (< 0 forces max iters) */
        0.1);           /* requested precision multiplier coarse (default 1) */
 
+    /* Use single precision extra-diagonal coefficients on coarse levels
+       to reduce memory bandwidth (default: false) */
+
+    cs_multigrid_set_coarse_precision(mg, true);
+
+    /* Keep grid hierarchy between time steps, only refreshing coarse
+       matrix coefficients; rebuild it when the convergence rate
+       degrades by more than 50% (default: false, 1.5) */
+
+    cs_multigrid_set_hierarchy_reuse(mg, true, 1.5);
+
+    /* Factorize coarsest level system (if at most 4096 rows) and solve
+       it directly instead of iterating (default: false, 4096) */
+
+    cs_multigrid_set_coarse_solver_direct(mg, true, 4096);
+
   }
   /*! [sles_mgp_1] */
 
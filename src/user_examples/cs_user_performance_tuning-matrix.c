@@ -102,6 +102,19 @@ cs_user_matrix_tuning(void)
 
   cs_matrix_default_set_type(CS_MATRIX_BLOCK_D, CS_MATRIX_MSR);
 
+  /* Use SELL-C-sigma storage for scalar matrices, with slices of 8 rows
+     sorted by decreasing length within windows of 256 rows (defaults) */
+
+  cs_matrix_set_sell_options(8,    /* chunk_size */
+                             256); /* sigma */
+
+  cs_matrix_default_set_type(CS_MATRIX_SCALAR, CS_MATRIX_SELL);
+
+  /* Use block sparse row storage for coupled systems with full
+     extra-diagonal blocks (otherwise handled by native storage) */
+
+  cs_matrix_default_set_type(CS_MATRIX_BLOCK, CS_MATRIX_BSR);
+
   /* Also allow tuning for multigrid for all expected levels
    * (we rarely have more than 10 or 11 levels except for huge meshes). */
 
@@ -55,6 +55,7 @@
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_renumber.h"
+#include "cs_restart.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -101,6 +102,8 @@ cs_user_parallel_io(void)
      CS_FILE_STDIO_SERIAL        Serial standard C IO
                                  (funnelled through rank 0 in parallel)
      CS_FILE_STDIO_PARALLEL      Per-process standard C IO
+     CS_FILE_MMAP                Per-process memory-mapped file access
+                                 (reading only)
      CS_FILE_MPI_INDEPENDENT     Non-collective MPI-IO
                                  with independent file open and close
      CS_FILE_MPI_NON_COLLECTIVE  Non-collective MPI-IO
@@ -153,6 +156,18 @@ cs_user_parallel_io(void)
 
 #endif /* defined(HAVE_MPI_IO) && MPI_VERSION > 1 */
 
+  /* Write checkpoint files asynchronously using a background I/O thread,
+     staging up to 1 GiB of data per rank instead of the default 256 MiB
+     (time stepping continues while previously staged data is being
+     written) */
+
+  cs_restart_checkpoint_set_async(true);
+  cs_file_set_async_buffer_size(1024*1024*1024);
+
+  /* Compress large sections of checkpoint files (fastest level) */
+
+  cs_restart_checkpoint_set_compression(1);
+
   /*! [perfomance_tuning_parallel_io] */
 }
 
@@ -188,6 +188,21 @@ cs_user_radiative_transfer_parameters(void)
 
   cs_glob_rad_transfer_params->atmo_ir_absorption = true;
 
+  /* Solve the radiance for several DOM directions simultaneously
+     (ignored with dispersion)
+       dir_batch = 0: one direction at a time
+       dir_batch = 1: all directions of an octant together
+       dir_batch = 2: all directions together */
+
+  cs_glob_rad_transfer_params->dir_batch = 1;
+
+  /* Solve the radiance directly using a sweep of cells ordered along
+     each direction, when possible (ignored with dispersion)
+       upwind_sweep = true: activated
+       upwind_sweep = false: not activated */
+
+  cs_glob_rad_transfer_params->upwind_sweep = true;
+
   /*! [cs_user_radiative_transfer_parameters] */
 }
 
@@ -31,6 +31,10 @@
 #include <sys/time.h>
 #include <unistd.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /* For the IBM ESSL library, function prototypes are defined in essl.h,
    with legacy blas names <name> mapped to esv<name>;
    for the AMD ACML library, prototypes are defined in acml.h.
@@ -85,7 +89,8 @@ const char ext_blas_type[] = "";
 #endif
 
 /* Reduction algorithm name */
-const char *reduce_name[] = {"superblock", "Kahan compensated sum"};
+const char *reduce_name[] = {"superblock", "Kahan compensated sum",
+                             "reproducible"};
 
 /* Size of arrays for tests */
 static const int _n_sizes = 9;
@@ -2711,6 +2716,286 @@ _solve_33_test(double  t_measure)
   return test_sum;
 }
 
+/*----------------------------------------------------------------------------
+ * Check that reproducible sum accumulators do not depend on the way
+ * values are split into blocks, on the merge order, or on the number
+ * of threads used by cs_dot_rsum.
+ *
+ * Values are chosen so that the exact sum is known, and may not be
+ * obtained by a standard floating-point sum.
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_rsum_test(void)
+{
+  const cs_lnum_t n = 3*33335;
+  const int n_splits = 5;
+  const int n_blocks[] = {1, 2, 3, 7, 64};
+
+  int n_errors = 0;
+
+  double *x, *y;
+  BFT_MALLOC(x, n, double);
+  BFT_MALLOC(y, n, double);
+
+  /* Large values cancel out exactly, leaving a sum of small terms */
+
+  for (cs_lnum_t i = 0; i < n/3; i++) {
+    double big = ldexp(sin(i*0.7) + 2., (i*37)%120 + 20);
+    x[3*i] = big;
+    x[3*i + 1] = ldexp(1., -(i%40));
+    x[3*i + 2] = -big;
+  }
+  for (cs_lnum_t i = 0; i < n; i++)
+    y[i] = 1.;
+
+  double ref_s = 0;
+  for (cs_lnum_t i = n/3 - 1; i > -1; i--)
+    ref_s += ldexp(1., -(i%40));
+
+  /* Reference: sequential accumulation */
+
+  cs_blas_rsum_t ref;
+  cs_blas_rsum_init(&ref);
+  for (cs_lnum_t i = 0; i < n; i++)
+    cs_blas_rsum_add(&ref, x[i]);
+
+  double ref_v = cs_blas_rsum_value(&ref);
+
+  bft_printf("Reproducible sum accumulators:\n"
+             "  sequential sum error for n = %7d: %12.5e\n",
+             (int)n, ref_s - ref_v);
+
+  if (memcmp(&ref_v, &ref_s, sizeof(double)) != 0)
+    n_errors++;
+
+  /* Block splits, with uneven block sizes, merged in forward and
+     reverse order, with or without prior normalization */
+
+  for (int s_id = 0; s_id < n_splits; s_id++) {
+
+    const int n_b = n_blocks[s_id];
+
+    cs_blas_rsum_t *b_acc, f_acc, r_acc;
+    BFT_MALLOC(b_acc, n_b, cs_blas_rsum_t);
+
+    cs_lnum_t s_idx = 0;
+    for (int b_id = 0; b_id < n_b; b_id++) {
+      cs_lnum_t e_idx = (b_id < n_b - 1) ?
+        (cs_lnum_t)((double)n*(b_id+1)*(b_id+1)/((double)n_b*n_b)) : n;
+      cs_blas_rsum_init(b_acc + b_id);
+      for (cs_lnum_t i = s_idx; i < e_idx; i++)
+        cs_blas_rsum_add(b_acc + b_id, x[i]);
+      if (b_id % 2)
+        cs_blas_rsum_normalize(b_acc + b_id);
+      s_idx = e_idx;
+    }
+
+    cs_blas_rsum_init(&f_acc);
+    cs_blas_rsum_init(&r_acc);
+    for (int b_id = 0; b_id < n_b; b_id++)
+      cs_blas_rsum_merge(&f_acc, b_acc + b_id);
+    for (int b_id = n_b - 1; b_id > -1; b_id--)
+      cs_blas_rsum_merge(&r_acc, b_acc + b_id);
+
+    double f_v = cs_blas_rsum_value(&f_acc);
+    double r_v = cs_blas_rsum_value(&r_acc);
+
+    if (   memcmp(f_acc.b, ref.b, sizeof(ref.b)) != 0
+        || memcmp(r_acc.b, ref.b, sizeof(ref.b)) != 0
+        || memcmp(&f_v, &ref_v, sizeof(double)) != 0
+        || memcmp(&r_v, &ref_v, sizeof(double)) != 0) {
+      bft_printf("  %d blocks: merged sums differ: %12.5e %12.5e\n",
+                 n_b, ref_v - f_v, ref_v - r_v);
+      n_errors++;
+    }
+
+    BFT_FREE(b_acc);
+  }
+
+  /* Dot products with varying thread counts */
+
+  int n_t_max = 1;
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
+
+  for (int n_t = 1; n_t <= 4; n_t++) {
+
+#if defined(HAVE_OPENMP)
+    omp_set_num_threads(n_t);
+#endif
+
+    const cs_real_t *xv[2] = {x, x};
+    const cs_real_t *yv[2] = {y, NULL};
+    cs_blas_rsum_t acc[2];
+
+    cs_dot_rsum(n, 2, xv, yv, acc);
+
+    for (int k = 0; k < 2; k++) {
+      double v = cs_blas_rsum_value(acc + k);
+      if (   memcmp(acc[k].b, ref.b, sizeof(ref.b)) != 0
+          || memcmp(&v, &ref_v, sizeof(double)) != 0) {
+        bft_printf("  %d thread(s): %s differs: %12.5e\n",
+                   n_t, (k == 0) ? "dot product" : "sum", ref_v - v);
+        n_errors++;
+      }
+    }
+
+  }
+
+#if defined(HAVE_OPENMP)
+  omp_set_num_threads(n_t_max);
+#else
+  CS_UNUSED(n_t_max);
+#endif
+
+  bft_printf("  block split, merge and thread count checks: %s\n\n",
+             (n_errors == 0) ? "passed" : "failed");
+
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare fused axpy and dot product functions with separate cs_axpy
+ * and cs_dot calls, for each reduction mode.
+ *
+ * Updated vectors must match within round-off (they are bit-identical
+ * unless external BLAS or fused multiply-add instructions are used), and
+ * dot products, whose summation order may differ, within a relative
+ * tolerance; in reproducible mode, dot products must be bit-identical.
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_axpy_dot_test(void)
+{
+  const int n_sizes = 5;
+  const cs_lnum_t sizes[] = {1, 7, 100, 1000, 50001};
+  const char *f_name[] = {"cs_axpy_dot", "cs_axpy_dot_xx",
+                          "cs_axpy2_dot_xx", "cs_axpy2_dot_xx_xy"};
+
+  const double a = -0.7, b = 1.3;
+
+  int n_errors = 0;
+
+  bft_printf("Fused axpy and dot products:\n");
+
+  for (int s_id = 0; s_id < n_sizes; s_id++) {
+
+    const cs_lnum_t n = sizes[s_id];
+
+    double *x, *y, *z, *w, *v, *y_f, *w_f, *y_r, *w_r;
+    BFT_MALLOC(x, n, double);
+    BFT_MALLOC(y, n, double);
+    BFT_MALLOC(z, n, double);
+    BFT_MALLOC(w, n, double);
+    BFT_MALLOC(v, n, double);
+    BFT_MALLOC(y_f, n, double);
+    BFT_MALLOC(w_f, n, double);
+    BFT_MALLOC(y_r, n, double);
+    BFT_MALLOC(w_r, n, double);
+
+    for (cs_lnum_t i = 0; i < n; i++) {
+      x[i] = sin(0.3*i) + 0.1;
+      y[i] = cos(0.7*i);
+      z[i] = (i%10 - 3)*_pi;
+      w[i] = 1./(i + 1);
+      v[i] = sin(1.1*i)*(i%7 + 1);
+    }
+
+    for (cs_blas_reduce_t j = 0; j < 3; j++) {
+
+      cs_blas_set_reduce_algorithm(j);
+
+      for (int f_id = 0; f_id < 4; f_id++) {
+
+        double s_f[2] = {0, 0}, s_r[2] = {0, 0};
+        int n_dots = (f_id == 3) ? 2 : 1;
+
+        memcpy(y_f, y, n*sizeof(double));
+        memcpy(w_f, w, n*sizeof(double));
+        memcpy(y_r, y, n*sizeof(double));
+        memcpy(w_r, w, n*sizeof(double));
+
+        /* Fused and separate operations */
+
+        switch (f_id) {
+        case 0:
+          s_f[0] = cs_axpy_dot(n, a, x, y_f, z);
+          cs_axpy(n, a, x, y_r);
+          s_r[0] = cs_dot(n, y_r, z);
+          break;
+        case 1:
+          s_f[0] = cs_axpy_dot_xx(n, a, x, y_f);
+          cs_axpy(n, a, x, y_r);
+          s_r[0] = cs_dot_xx(n, y_r);
+          break;
+        case 2:
+          s_f[0] = cs_axpy2_dot_xx(n, a, x, y_f, b, z, w_f);
+          cs_axpy(n, a, x, y_r);
+          cs_axpy(n, b, z, w_r);
+          s_r[0] = cs_dot_xx(n, w_r);
+          break;
+        default:
+          cs_axpy2_dot_xx_xy(n, a, x, y_f, b, z, w_f, v, s_f, s_f + 1);
+          cs_axpy(n, a, x, y_r);
+          cs_axpy(n, b, z, w_r);
+          cs_dot_xx_xy(n, w_r, v, s_r, s_r + 1);
+        }
+
+        double v_err = 0;
+        for (cs_lnum_t i = 0; i < n; i++) {
+          v_err = CS_MAX(v_err, CS_ABS(y_f[i] - y_r[i]));
+          v_err = CS_MAX(v_err, CS_ABS(w_f[i] - w_r[i]));
+        }
+
+        double d_err = 0;
+        for (int k = 0; k < n_dots; k++)
+          d_err = CS_MAX(d_err,
+                         CS_ABS(s_f[k] - s_r[k]) / CS_MAX(CS_ABS(s_r[k]),
+                                                          1e-300));
+
+        double d_tol = (j == CS_BLAS_REDUCE_REPRODUCIBLE) ? 0. : 1e-12;
+
+        if (v_err > 1e-14 || d_err > d_tol) {
+          bft_printf("  %-18s (%s) for n = %7d: vector error %12.5e, "
+                     "dot product error %12.5e\n",
+                     f_name[f_id], reduce_name[j], (int)n, v_err, d_err);
+          n_errors++;
+        }
+
+      }
+
+    }
+
+    cs_blas_set_reduce_algorithm(CS_BLAS_REDUCE_SUPERBLOCK);
+
+    BFT_FREE(w_r);
+    BFT_FREE(y_r);
+    BFT_FREE(w_f);
+    BFT_FREE(y_f);
+    BFT_FREE(v);
+    BFT_FREE(w);
+    BFT_FREE(z);
+    BFT_FREE(y);
+    BFT_FREE(x);
+  }
+
+  bft_printf("  comparison with separate axpy and dot products: %s\n\n",
+             (n_errors == 0) ? "passed" : "failed");
+
+  return n_errors;
+}
+
 /*----------------------------------------------------------------------------*/
 
 int
@@ -2720,6 +3005,7 @@ main (int argc, char *argv[])
   CS_UNUSED(argv);
 
   int sub_id;
+  int n_errors = 0;
   double t_measure = 1.0;
   double test_sum = 0.0;
 
@@ -2814,6 +3100,10 @@ main (int argc, char *argv[])
     BFT_FREE(x);
   }
 
+  n_errors += _rsum_test();
+
+  n_errors += _axpy_dot_test();
+
   /* Performance tests */
   /*-------------------*/
 
@@ -2852,5 +3142,8 @@ main (int argc, char *argv[])
   }
 #endif /* HAVE_MPI */
 
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
   exit (EXIT_SUCCESS);
 }
@@ -0,0 +1,279 @@
+/*============================================================================
+ * Unit test for field gradient caching in cs_field_operator.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_field_operator.h"
+#include "cs_gradient.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_numbering.h"
+#include "cs_parameters.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Build a mesh made of a single unit cube cell.
+ *
+ * Vertex i + 2j + 4k is located at (i, j, k); the boundary faces are
+ * numbered x-, x+, y-, y+, z-, z+, and oriented outwards.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_unit_cube_mesh(cs_mesh_t  *m)
+{
+  const cs_lnum_t face_vtx[6][4] = {{0, 4, 6, 2},
+                                    {1, 3, 7, 5},
+                                    {0, 1, 5, 4},
+                                    {2, 6, 7, 3},
+                                    {0, 2, 3, 1},
+                                    {4, 5, 7, 6}};
+
+  m->n_cells = 1;
+  m->n_cells_with_ghosts = 1;
+  m->n_i_faces = 0;
+  m->n_b_faces = 6;
+  m->n_vertices = 8;
+
+  m->n_g_cells = 1;
+  m->n_g_i_faces = 0;
+  m->n_g_b_faces = 6;
+  m->n_g_vertices = 8;
+
+  BFT_MALLOC(m->vtx_coord, 8*3, cs_real_t);
+  for (int i = 0; i < 8; i++) {
+    m->vtx_coord[i*3]     = i%2;
+    m->vtx_coord[i*3 + 1] = (i/2)%2;
+    m->vtx_coord[i*3 + 2] = i/4;
+  }
+
+  BFT_MALLOC(m->i_face_vtx_idx, 1, cs_lnum_t);
+  m->i_face_vtx_idx[0] = 0;
+  m->i_face_vtx_connect_size = 0;
+
+  BFT_MALLOC(m->b_face_cells, 6, cs_lnum_t);
+  BFT_MALLOC(m->b_face_vtx_idx, 7, cs_lnum_t);
+  BFT_MALLOC(m->b_face_vtx_lst, 24, cs_lnum_t);
+  m->b_face_vtx_connect_size = 24;
+
+  m->b_face_vtx_idx[0] = 0;
+  for (int f_id = 0; f_id < 6; f_id++) {
+    m->b_face_cells[f_id] = 0;
+    m->b_face_vtx_idx[f_id + 1] = (f_id + 1)*4;
+    for (int j = 0; j < 4; j++)
+      m->b_face_vtx_lst[f_id*4 + j] = face_vtx[f_id][j];
+  }
+
+  m->cell_numbering = cs_numbering_create_default(m->n_cells);
+  m->i_face_numbering = cs_numbering_create_default(m->n_i_faces);
+  m->b_face_numbering = cs_numbering_create_default(m->n_b_faces);
+  m->vtx_numbering = cs_numbering_create_default(m->n_vertices);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the expected gradient of a field.
+ *
+ * With zero implicit boundary coefficients, the gradient on the unit cube
+ * reduces to the difference of opposite faces' explicit coefficients.
+ *
+ * parameters:
+ *   f   <-- pointer to field
+ *   ref --> expected gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_expected_gradient(const cs_field_t  *f,
+                   cs_real_t          ref[3])
+{
+  const cs_real_t *coefa = f->bc_coeffs->a;
+
+  for (int i = 0; i < 3; i++)
+    ref[i] = coefa[i*2 + 1] - coefa[i*2];
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the field's gradient and compare it to a reference value.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   ref            <-- reference gradient
+ *   descr          <-- description of test step
+ *
+ * returns:
+ *   0 if the gradient matches the reference value, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_gradient(const cs_field_t  *f,
+                bool               recompute_cocg,
+                const cs_real_t    ref[3],
+                const char        *descr)
+{
+  cs_real_3_t grad[1];
+
+  cs_field_gradient_scalar(f, false, 1, recompute_cocg, grad);
+
+  double d = 0;
+  for (int i = 0; i < 3; i++)
+    d += fabs(grad[0][i] - ref[i]);
+
+  bft_printf("%-40s grad = [%g, %g, %g] (expected [%g, %g, %g])\n",
+             descr, grad[0][0], grad[0][1], grad[0][2],
+             ref[0], ref[1], ref[2]);
+
+  if (d > 1e-10) {
+    bft_printf("  --> gradient mismatch (%g)\n", d);
+    return 1;
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = 0;
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Mesh, locations and field keys */
+
+  cs_glob_mesh = cs_mesh_create();
+  _build_unit_cube_mesh(cs_glob_mesh);
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_create();
+  cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+
+  cs_mesh_location_initialize();
+  cs_mesh_location_build(cs_glob_mesh, -1);
+
+  cs_field_define_keys_base();
+  cs_parameters_define_field_keys();
+
+  cs_gradient_initialize();
+
+  /* Variable field, with Dirichlet conditions on all faces */
+
+  cs_field_t *f = cs_field_create("p",
+                                  CS_FIELD_INTENSIVE | CS_FIELD_VARIABLE,
+                                  CS_MESH_LOCATION_CELLS,
+                                  1,
+                                  false);
+
+  cs_field_allocate_values(f);
+  cs_field_allocate_bc_coeffs(f, false, false, false, false);
+
+  f->val[0] = 1.;
+  for (cs_lnum_t f_id = 0; f_id < 6; f_id++) {
+    f->bc_coeffs->a[f_id] = 1.;
+    f->bc_coeffs->b[f_id] = 0.;
+  }
+  cs_field_update_bc_state(f);
+
+  cs_field_gradient_cache_set_active(true);
+
+  cs_real_t ref[3], ref_prev[3];
+
+  _expected_gradient(f, ref);
+
+  retval += _check_gradient(f, true, ref, "initial");
+  retval += _check_gradient(f, false, ref, "repeated, without COCG update");
+  retval += _check_gradient(f, false, ref, "repeated");
+
+  /* Boundary conditions modified in place (arrays are unchanged);
+     as long as the modification is not marked, the cached gradient
+     is returned */
+
+  memcpy(ref_prev, ref, sizeof(ref));
+
+  f->bc_coeffs->a[1] = 3.;
+  f->bc_coeffs->a[4] = -2.;
+
+  retval += _check_gradient(f, false, ref_prev, "after unmarked BC update");
+
+  cs_field_update_bc_state(f);
+  _expected_gradient(f, ref);
+
+  retval += _check_gradient(f, false, ref, "after BC update");
+  retval += _check_gradient(f, false, ref, "repeated");
+
+  /* Modified values (and BC's to remain consistent) */
+
+  f->val[0] = 2.;
+  cs_field_update_state(f);
+
+  f->bc_coeffs->a[2] = 0.5;
+  cs_field_update_bc_state(f);
+  _expected_gradient(f, ref);
+
+  retval += _check_gradient(f, false, ref, "after value and BC update");
+
+  /* Same state, but with a different time step */
+
+  f->bc_coeffs->a[3] = 4.;
+  cs_time_step_increment(0.1);
+  _expected_gradient(f, ref);
+
+  retval += _check_gradient(f, false, ref, "next time step");
+
+  cs_field_gradient_cache_finalize();
+
+  /* Free structures */
+
+  cs_gradient_finalize();
+  cs_field_destroy_all();
+  cs_field_destroy_all_keys();
+  cs_mesh_location_finalize();
+  cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  if (retval != 0) {
+    bft_printf("\n%d gradient cache test step(s) failed\n", retval);
+    exit(EXIT_FAILURE);
+  }
+
+  exit(EXIT_SUCCESS);
+}
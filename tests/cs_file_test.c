@@ -97,6 +97,127 @@ _create_test_data(void)
 
 /*---------------------------------------------------------------------------*/
 
+static int
+_test_async(size_t     max_staged_size,
+            cs_gnum_t  block_start,
+            cs_gnum_t  block_end)
+{
+  cs_gnum_t i;
+  cs_file_t *f;
+  int n_errors = 0;
+
+  const char file_name[] = "output_data_async";
+
+  char header[80], footer[80], buf[80];
+  int ibuf[30];
+  double dbuf[30];
+
+#if defined(HAVE_MPI)
+  int mpi_flag;
+  MPI_Comm comm = MPI_COMM_NULL;
+  MPI_Initialized(&mpi_flag);
+  if (mpi_flag != 0)
+    comm = MPI_COMM_WORLD;
+#endif
+
+  memset(header, 0, 80);
+  memset(footer, 0, 80);
+  strcpy(header, "fvm async test file");
+  strcpy(footer, "fvm async test file end");
+
+  cs_file_set_async_buffer_size(max_staged_size);
+
+  /* Write file asynchronously */
+
+#if defined(HAVE_MPI)
+  f = cs_file_open(file_name,
+                   CS_FILE_MODE_WRITE,
+                   CS_FILE_STDIO_SERIAL,
+                   MPI_INFO_NULL,
+                   comm,
+                   comm);
+#else
+  f = cs_file_open(file_name,
+                   CS_FILE_MODE_WRITE,
+                   CS_FILE_STDIO_SERIAL);
+#endif
+
+  cs_file_set_big_endian(f);
+
+  if (cs_file_set_async(f) == false)
+    bft_printf("asynchronous mode not available, using synchronous writes\n");
+
+  cs_file_write_global(f, header, 1, 80);
+
+  for (i = block_start; i < block_end; i++)
+    ibuf[i-block_start] = i;
+  cs_file_write_block(f, ibuf, sizeof(int), 1, block_start, block_end);
+
+  for (i = block_start; i < block_end; i++)
+    dbuf[i-block_start] = 0.5*i;
+  cs_file_write_block_buffer(f, dbuf, sizeof(double), 1,
+                             block_start, block_end);
+
+  /* Overwrite source buffer: staged data must not depend on it */
+
+  for (i = block_start; i < block_end; i++)
+    ibuf[i-block_start] = -1;
+
+  cs_file_write_global(f, footer, 1, 80);
+
+  f = cs_file_free(f);
+
+  n_errors += cs_file_async_wait();
+
+  /* Read back and compare */
+
+#if defined(HAVE_MPI)
+  f = cs_file_open(file_name,
+                   CS_FILE_MODE_READ,
+                   CS_FILE_STDIO_SERIAL,
+                   MPI_INFO_NULL,
+                   comm,
+                   comm);
+#else
+  f = cs_file_open(file_name,
+                   CS_FILE_MODE_READ,
+                   CS_FILE_STDIO_SERIAL);
+#endif
+
+  cs_file_set_big_endian(f);
+
+  cs_file_read_global(f, buf, 1, 80);
+  if (memcmp(buf, header, 80) != 0)
+    n_errors++;
+
+  cs_file_read_block(f, ibuf, sizeof(int), 1, block_start, block_end);
+  for (i = block_start; i < block_end; i++) {
+    if (ibuf[i-block_start] != (int)i)
+      n_errors++;
+  }
+
+  cs_file_read_block(f, dbuf, sizeof(double), 1, block_start, block_end);
+  for (i = block_start; i < block_end; i++) {
+    double v = 0.5*i; /* values must be read back exactly */
+    if (memcmp(dbuf + (i-block_start), &v, sizeof(double)) != 0)
+      n_errors++;
+  }
+
+  cs_file_read_global(f, buf, 1, 80);
+  if (memcmp(buf, footer, 80) != 0)
+    n_errors++;
+
+  f = cs_file_free(f);
+
+  bft_printf("asynchronous write test (staging bound %llu bytes): "
+             "%d error(s)\n",
+             (unsigned long long)max_staged_size, n_errors);
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
 int
 main (int argc, char *argv[])
 {
@@ -114,12 +235,14 @@ main (int argc, char *argv[])
   cs_gnum_t block_start_2, block_end_2;
   cs_file_off_t off1 = -1, off2 = -1;
   cs_file_t *f = NULL;
+  int n_errors = 0;
 
 #if defined(HAVE_MPI_IO)
   const int n_pos = 2;
-  const int n_access = 5;
-  const cs_file_access_t access[5] = {CS_FILE_STDIO_SERIAL,
+  const int n_access = 6;
+  const cs_file_access_t access[6] = {CS_FILE_STDIO_SERIAL,
                                       CS_FILE_STDIO_PARALLEL,
+                                      CS_FILE_MMAP,
                                       CS_FILE_MPI_INDEPENDENT,
                                       CS_FILE_MPI_NON_COLLECTIVE,
                                       CS_FILE_MPI_COLLECTIVE};
@@ -127,8 +250,8 @@ main (int argc, char *argv[])
                                              CS_FILE_MPI_INDIVIDUAL_POINTERS};
 #else
   const int n_pos = 1;
-  const int n_access = 1;
-  const int access[1] = {CS_FILE_STDIO_SERIAL};
+  const int n_access = 2;
+  const int access[2] = {CS_FILE_STDIO_SERIAL, CS_FILE_MMAP};
   const cs_file_mpi_positioning_t pos[1] = {CS_FILE_MPI_EXPLICIT_OFFSETS};
 #endif
 
@@ -382,6 +505,12 @@ main (int argc, char *argv[])
     }
   }
 
+  /* Asynchronous write tests, with default staging bound,
+     and with a bound small enough to force synchronous writes */
+
+  n_errors += _test_async(256*1024*1024, block_start, block_end);
+  n_errors += _test_async(128, block_start, block_end);
+
   /* We are finished */
 
   bft_mem_end();
@@ -392,5 +521,8 @@ main (int argc, char *argv[])
 
 #endif
 
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
   exit (EXIT_SUCCESS);
 }
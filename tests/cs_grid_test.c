@@ -0,0 +1,839 @@
+/*============================================================================
+ * Unit test for multigrid coarsening in cs_grid.c and multigrid solves;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_grid.h"
+#include "cs_matrix.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_multigrid.h"
+#include "cs_multigrid_direct.h"
+#include "cs_multigrid_smoother.h"
+#include "cs_sles_it.h"
+#include "cs_sles_it_priv.h"
+#include "cs_sles_pc.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize MPI if necessary.
+ *
+ * Grid construction queries the size of the main communicator, so MPI is
+ * always initialized when available; the test itself runs on each rank
+ * independently.
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_init(void)
+{
+  int flag = 0;
+
+  MPI_Initialized(&flag);
+
+  if (!flag) {
+#if defined(MPI_VERSION) && (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+    int mpi_threads;
+    MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &mpi_threads);
+#else
+    MPI_Init(NULL, NULL);
+#endif
+  }
+
+  cs_glob_mpi_comm = MPI_COMM_SELF;
+  MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+  MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+}
+
+#endif /* HAVE_MPI */
+
+/*----------------------------------------------------------------------------
+ * Build the face -> cells connectivity and coefficients of a 2D Laplacian
+ * on a structured nx.ny grid, with homogeneous Neumann conditions (so that
+ * matrix row sums are zero) and anisotropic coefficients.
+ *
+ * parameters:
+ *   nx        <-- number of cells in x direction
+ *   ny        <-- number of cells in y direction
+ *   n_faces   --> number of interior faces
+ *   face_cell --> face -> cells connectivity
+ *   da        --> diagonal values
+ *   xa        --> extra-diagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_laplacian(cs_lnum_t     nx,
+                 cs_lnum_t     ny,
+                 cs_lnum_t    *n_faces,
+                 cs_lnum_2_t **face_cell,
+                 cs_real_t   **da,
+                 cs_real_t   **xa)
+{
+  const cs_lnum_t n_cells = nx*ny;
+
+  cs_lnum_t n = 0;
+  cs_lnum_2_t *_face_cell;
+  cs_real_t *_da, *_xa;
+
+  BFT_MALLOC(_face_cell, 2*n_cells, cs_lnum_2_t);
+  BFT_MALLOC(_xa, 2*n_cells, cs_real_t);
+  BFT_MALLOC(_da, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _da[i] = 0;
+
+  for (cs_lnum_t j = 0; j < ny; j++) {
+    for (cs_lnum_t i = 0; i < nx; i++) {
+      cs_lnum_t c_id = j*nx + i;
+      if (i < nx - 1) {
+        _face_cell[n][0] = c_id;
+        _face_cell[n][1] = c_id + 1;
+        _xa[n] = -1.;
+        n++;
+      }
+      if (j < ny - 1) {
+        _face_cell[n][0] = c_id;
+        _face_cell[n][1] = c_id + nx;
+        _xa[n] = -0.1;
+        n++;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n; f_id++) {
+    _da[_face_cell[f_id][0]] -= _xa[f_id];
+    _da[_face_cell[f_id][1]] -= _xa[f_id];
+  }
+
+  *n_faces = n;
+  *face_cell = _face_cell;
+  *da = _da;
+  *xa = _xa;
+}
+
+/*----------------------------------------------------------------------------
+ * Check the multicolor symmetric Gauss-Seidel smoother on an MSR matrix.
+ *
+ * Each row must belong to exactly one color, no two rows of a same color
+ * may be coupled by a matrix coefficient, and a single sweep must reduce
+ * the residual of a consistent system.
+ *
+ * parameters:
+ *   a <-- MSR matrix
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_mc_gauss_seidel(const cs_matrix_t  *a)
+{
+  int retval = 0;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+  cs_sles_it_t *c
+    = cs_multigrid_smoother_create(CS_SLES_MC_SYM_GAUSS_SEIDEL, -1, 1);
+
+  cs_multigrid_smoother_setup(c, "mc_gs", a, 0);
+
+  /* Coloring */
+
+  const int n_colors = c->setup_data->n_colors;
+  const cs_lnum_t *color_index = c->setup_data->color_index;
+  const cs_lnum_t *color_rows = c->setup_data->color_rows;
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+
+  cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+
+  int *row_color;
+  BFT_MALLOC(row_color, n_rows, int);
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    row_color[i] = -1;
+
+  cs_lnum_t n_multiple = 0, n_missing = 0, n_coupled = 0;
+
+  for (int cl = 0; cl < n_colors; cl++) {
+    for (cs_lnum_t k = color_index[cl]; k < color_index[cl+1]; k++) {
+      cs_lnum_t i = color_rows[k];
+      if (row_color[i] > -1)
+        n_multiple++;
+      row_color[i] = cl;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    if (row_color[i] < 0)
+      n_missing++;
+    for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+      if (col_id[j] < n_rows && row_color[col_id[j]] == row_color[i])
+        n_coupled++;
+    }
+  }
+
+  bft_printf("Multicolor Gauss-Seidel: %d colors\n", n_colors);
+
+  if (   color_index[n_colors] != n_rows
+      || n_multiple > 0 || n_missing > 0 || n_coupled > 0) {
+    bft_printf("  invalid coloring: %d rows listed, %d multiple, "
+               "%d missing, %d same color couplings\n",
+               (int)color_index[n_colors], (int)n_multiple,
+               (int)n_missing, (int)n_coupled);
+    retval += 1;
+  }
+
+  BFT_FREE(row_color);
+
+  /* Single sweep on a consistent system, from a zero initial guess */
+
+  cs_real_t *x_ref, *rhs, *vx, *r;
+  BFT_MALLOC(x_ref, n_cols, cs_real_t);
+  BFT_MALLOC(rhs, n_cols, cs_real_t);
+  BFT_MALLOC(vx, n_cols, cs_real_t);
+  BFT_MALLOC(r, n_cols, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    x_ref[i] = sin(0.37*i) + 0.5*cos(1.3*i);
+    vx[i] = 0.;
+  }
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, x_ref, rhs);
+
+  double r_norm_0 = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r_norm_0 += rhs[i]*rhs[i];
+  r_norm_0 = sqrt(r_norm_0);
+
+  int n_iter = 0;
+  double residue = 0;
+
+  cs_multigrid_smoother_solve(c, "mc_gs", a, 0, CS_HALO_ROTATION_COPY,
+                              1e-12, r_norm_0, &n_iter, &residue,
+                              rhs, vx, 0, NULL);
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, vx, r);
+
+  double r_norm_1 = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r_norm_1 += (rhs[i] - r[i])*(rhs[i] - r[i]);
+  r_norm_1 = sqrt(r_norm_1);
+
+  bft_printf("  residual after %d sweep(s): %g -> %g\n",
+             n_iter, r_norm_0, r_norm_1);
+
+  if (n_iter != 1 || !(r_norm_1 < r_norm_0)) {
+    bft_printf("  sweep does not reduce the residual\n");
+    retval += 1;
+  }
+
+  BFT_FREE(r);
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+  BFT_FREE(x_ref);
+
+  cs_sles_it_destroy((void **)&c);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the geometric quantities associated with the structured grid
+ * built by _build_laplacian, and map them with the face -> cells
+ * connectivity to the main mesh and mesh quantities structures, as
+ * multigrid setup uses them.
+ *
+ * parameters:
+ *   nx        <-- number of cells in x direction
+ *   ny        <-- number of cells in y direction
+ *   n_faces   <-- number of interior faces
+ *   face_cell <-- face -> cells connectivity
+ *   m         --> mesh structure
+ *   mq        --> mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_map_mesh(cs_lnum_t              nx,
+          cs_lnum_t              ny,
+          cs_lnum_t              n_faces,
+          cs_lnum_2_t           *face_cell,
+          cs_mesh_t             *m,
+          cs_mesh_quantities_t  *mq)
+{
+  const cs_lnum_t n_cells = nx*ny;
+
+  memset(m, 0, sizeof(cs_mesh_t));
+  memset(mq, 0, sizeof(cs_mesh_quantities_t));
+
+  m->n_cells = n_cells;
+  m->n_cells_with_ghosts = n_cells;
+  m->n_i_faces = n_faces;
+  m->i_face_cells = face_cell;
+
+  BFT_MALLOC(mq->cell_cen, n_cells*3, cs_real_t);
+  BFT_MALLOC(mq->cell_vol, n_cells, cs_real_t);
+  BFT_MALLOC(mq->i_face_normal, n_faces*3, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    mq->cell_cen[c_id*3]     = c_id%nx + 0.5;
+    mq->cell_cen[c_id*3 + 1] = c_id/nx + 0.5;
+    mq->cell_cen[c_id*3 + 2] = 0.5;
+    mq->cell_vol[c_id] = 1.;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    for (cs_lnum_t k = 0; k < 3; k++)
+      mq->i_face_normal[f_id*3 + k]
+        =   mq->cell_cen[face_cell[f_id][1]*3 + k]
+          - mq->cell_cen[face_cell[f_id][0]*3 + k];
+  }
+
+  cs_glob_mesh = m;
+  cs_glob_mesh_quantities = mq;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a system using a multigrid solver or preconditioner whose
+ * hierarchy is built from a fine matrix of a given type, and check
+ * convergence.
+ *
+ * SELL-C-sigma matrices may be selected as the default matrix type by
+ * tuning, so the hierarchy must also be built from such matrices.
+ *
+ * The main mesh structures must be mapped (see _map_mesh) first.
+ *
+ * parameters:
+ *   type            <-- fine matrix type
+ *   mg_type         <-- multigrid type
+ *   coarsening_type <-- coarsening type
+ *   p0p1_relax      <-- P0/P1 relaxation parameter
+ *   n_faces         <-- number of interior faces
+ *   face_cell       <-- face -> cells connectivity
+ *   da              <-- diagonal values
+ *   xa              <-- extra-diagonal values
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_multigrid(cs_matrix_type_t       type,
+                cs_multigrid_type_t    mg_type,
+                cs_grid_coarsening_t   coarsening_type,
+                double                 p0p1_relax,
+                cs_lnum_t              n_faces,
+                const cs_lnum_2_t     *face_cell,
+                const cs_real_t       *da,
+                const cs_real_t       *xa)
+{
+  int retval = 0;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t db_size[4] = {1, 1, 1, 1};
+  const cs_lnum_t eb_size[4] = {1, 1, 1, 1};
+  const double precision = 1e-10;
+
+  cs_matrix_structure_t *ms = cs_matrix_structure_create(type,
+                                                         true,
+                                                         n_cells,
+                                                         n_cells,
+                                                         n_faces,
+                                                         face_cell,
+                                                         NULL,
+                                                         NULL);
+
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, db_size, eb_size,
+                             n_faces, face_cell, da, xa);
+
+  /* K-cycle multigrid is used as a preconditioner only */
+
+  cs_multigrid_t *mg = NULL;
+  cs_sles_it_t *c = NULL;
+
+  if (mg_type == CS_MULTIGRID_V_CYCLE)
+    mg = cs_multigrid_create(mg_type);
+  else {
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(mg_type);
+    mg = cs_sles_pc_get_context(pc);
+    c = cs_sles_it_create(CS_SLES_FCG, -1, 100, false);
+    cs_sles_it_transfer_pc(c, &pc);
+  }
+
+  cs_multigrid_set_coarsening_options(mg,
+                                      3,      /* aggregation_limit */
+                                      coarsening_type,
+                                      10,     /* n_max_levels */
+                                      30,     /* min_g_rows */
+                                      p0p1_relax,
+                                      0);     /* postprocess */
+
+  cs_real_t *rhs, *vx, *r;
+  BFT_MALLOC(rhs, n_cells, cs_real_t);
+  BFT_MALLOC(vx, n_cells, cs_real_t);
+  BFT_MALLOC(r, n_cells, cs_real_t);
+
+  double r_norm = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    rhs[i] = sin(0.1*i) + 1.;
+    vx[i] = 0.;
+    r_norm += rhs[i]*rhs[i];
+  }
+  r_norm = sqrt(r_norm);
+
+  int n_iter = 0;
+  double residue = 0;
+  cs_sles_convergence_state_t cvg;
+
+  if (c == NULL) {
+    cs_multigrid_setup(mg, "test", a, 0);
+    cvg = cs_multigrid_solve(mg, "test", a, 0, CS_HALO_ROTATION_COPY,
+                             precision, r_norm, &n_iter, &residue,
+                             rhs, vx, 0, NULL);
+  }
+  else {
+    cs_sles_it_setup(c, "test", a, 0);
+    cvg = cs_sles_it_solve(c, "test", a, 0, CS_HALO_ROTATION_COPY,
+                           precision, r_norm, &n_iter, &residue,
+                           rhs, vx, 0, NULL);
+  }
+
+  /* Check true residual */
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, vx, r);
+
+  double t_res = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    t_res += (rhs[i] - r[i])*(rhs[i] - r[i]);
+  t_res = sqrt(t_res) / r_norm;
+
+  bft_printf("%s multigrid, %s coarsening (relaxation %g), %s matrix:\n"
+             "  %d iterations, relative residual %g\n",
+             (mg_type == CS_MULTIGRID_V_CYCLE) ?
+               "V-cycle" : "FCG with K-cycle",
+             cs_grid_coarsening_type_name[coarsening_type], p0p1_relax,
+             cs_matrix_type_name[type], n_iter, t_res);
+
+  if (cvg != CS_SLES_CONVERGED || t_res > 10*precision) {
+    bft_printf("  multigrid solve failed\n");
+    retval += 1;
+  }
+
+  BFT_FREE(r);
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+
+  if (c == NULL)
+    cs_multigrid_destroy((void **)&mg);
+  else
+    cs_sles_it_destroy((void **)&c);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Coarsen a grid using a given coarsening type and check the coarse level.
+ *
+ * The number of rows must decrease, constants must be prolonged exactly,
+ * and the coarse (Galerkin) matrix must keep zero row sums.
+ *
+ * parameters:
+ *   f               <-- fine grid
+ *   coarsening_type <-- coarsening type
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_coarsening(const cs_grid_t       *f,
+                 cs_grid_coarsening_t   coarsening_type)
+{
+  int retval = 0;
+
+  cs_grid_t *c = cs_grid_coarsen(f,
+                                 coarsening_type,
+                                 4,      /* aggregation_limit */
+                                 0,      /* verbosity */
+                                 1,      /* merge_stride */
+                                 300,    /* merge_rows_mean_threshold */
+                                 500,    /* merge_rows_glob_threshold */
+                                 0.);    /* relaxation_parameter */
+
+  const cs_lnum_t f_n_rows = cs_grid_get_n_rows(f);
+  const cs_lnum_t c_n_rows = cs_grid_get_n_rows(c);
+
+  bft_printf("%s coarsening: %d -> %d rows\n",
+             cs_grid_coarsening_type_name[coarsening_type],
+             (int)f_n_rows, (int)c_n_rows);
+
+  if (c_n_rows < 1 || c_n_rows >= f_n_rows) {
+    bft_printf("  insufficient coarsening\n");
+    retval += 1;
+  }
+
+  /* Prolongation of constants */
+
+  cs_real_t *c_var, *f_var;
+  BFT_MALLOC(c_var, cs_grid_get_n_cols_ext(c), cs_real_t);
+  BFT_MALLOC(f_var, cs_grid_get_n_cols_ext(f), cs_real_t);
+
+  for (cs_lnum_t i = 0; i < cs_grid_get_n_cols_ext(c); i++)
+    c_var[i] = 1.;
+
+  cs_grid_prolong_row_var(c, f, c_var, f_var);
+
+  cs_real_t p_err = 0;
+  for (cs_lnum_t i = 0; i < f_n_rows; i++)
+    p_err = CS_MAX(p_err, CS_ABS(f_var[i] - 1.));
+
+  if (p_err > 1e-12) {
+    bft_printf("  constant prolongation error: %g\n", p_err);
+    retval += 1;
+  }
+
+  BFT_FREE(f_var);
+  BFT_FREE(c_var);
+
+  /* Coarse matrix row sums */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+
+  cs_matrix_get_msr_arrays(cs_grid_get_matrix(c),
+                           &row_index,
+                           &col_id,
+                           &d_val,
+                           &x_val);
+
+  cs_real_t s_err = 0;
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
+    cs_real_t s = d_val[i];
+    for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++)
+      s += x_val[j];
+    s_err = CS_MAX(s_err, CS_ABS(s)/d_val[i]);
+  }
+
+  if (s_err > 1e-12) {
+    bft_printf("  coarse matrix relative row sum: %g\n", s_err);
+    retval += 1;
+  }
+
+  cs_grid_destroy(&c);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Check the coarsest level direct solver against an iterative solve.
+ *
+ * A coarse level is built from the given fine matrix coefficients, and
+ * its system is solved both with the direct (banded LU) solver and with
+ * a tightly converged preconditioned conjugate gradient.
+ *
+ * parameters:
+ *   n_faces   <-- number of faces
+ *   face_cell <-- face -> cells connectivity
+ *   da        <-- diagonal values (non-singular system)
+ *   xa        <-- extradiagonal values
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_coarse_direct(cs_lnum_t           n_faces,
+                    const cs_lnum_2_t  *face_cell,
+                    const cs_real_t    *da,
+                    const cs_real_t    *xa)
+{
+  int retval = 0;
+
+  const double precision = 1e-13;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t db_size[4] = {1, 1, 1, 1};
+  const cs_lnum_t eb_size[4] = {1, 1, 1, 1};
+
+  cs_matrix_structure_t *ms = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                                         true,
+                                                         n_cells,
+                                                         n_cells,
+                                                         n_faces,
+                                                         face_cell,
+                                                         NULL,
+                                                         NULL);
+
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, db_size, eb_size,
+                             n_faces, face_cell, da, xa);
+
+  cs_grid_t *f = cs_grid_create_from_parent(a, 1);
+
+  cs_grid_t *c = cs_grid_coarsen(f,
+                                 CS_GRID_COARSENING_SPD_SA,
+                                 4,      /* aggregation_limit */
+                                 0,      /* verbosity */
+                                 1,      /* merge_stride */
+                                 300,    /* merge_rows_mean_threshold */
+                                 500,    /* merge_rows_glob_threshold */
+                                 0.);    /* relaxation_parameter */
+
+  const cs_matrix_t *c_a = cs_grid_get_matrix(c);
+  const cs_lnum_t c_n_rows = cs_grid_get_n_rows(c);
+  const cs_lnum_t c_n_cols = cs_grid_get_n_cols_ext(c);
+
+  cs_real_t *rhs, *x_d, *x_it, *r;
+  BFT_MALLOC(rhs, c_n_cols, cs_real_t);
+  BFT_MALLOC(x_d, c_n_cols, cs_real_t);
+  BFT_MALLOC(x_it, c_n_cols, cs_real_t);
+  BFT_MALLOC(r, c_n_cols, cs_real_t);
+
+  double r_norm = 0;
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
+    rhs[i] = sin(0.2*i) + 0.5;
+    x_d[i] = 0.;
+    x_it[i] = 0.;
+    r_norm += rhs[i]*rhs[i];
+  }
+  r_norm = sqrt(r_norm);
+
+  int n_iter = 0;
+  double residue = 0;
+
+  /* Direct solve */
+
+  cs_multigrid_direct_t *d = cs_multigrid_direct_create();
+
+  cs_multigrid_direct_setup(d, "coarse", c_a, 0);
+  cs_sles_convergence_state_t cvg_d
+    = cs_multigrid_direct_solve(d, "coarse", c_a, 0, CS_HALO_ROTATION_COPY,
+                                precision, r_norm, &n_iter, &residue,
+                                rhs, x_d, 0, NULL);
+
+  cs_multigrid_direct_destroy((void **)&d);
+
+  /* Iterative reference solve */
+
+  cs_sles_it_t *it = cs_sles_it_create(CS_SLES_PCG, 0, 10000, false);
+
+  cs_sles_it_setup(it, "coarse", c_a, 0);
+  cs_sles_convergence_state_t cvg_it
+    = cs_sles_it_solve(it, "coarse", c_a, 0, CS_HALO_ROTATION_COPY,
+                       precision, r_norm, &n_iter, &residue,
+                       rhs, x_it, 0, NULL);
+
+  cs_sles_it_destroy((void **)&it);
+
+  /* Compare solutions and check direct solver residual */
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, c_a, x_d, r);
+
+  double t_res = 0, d_max = 0, x_max = 0;
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
+    t_res += (rhs[i] - r[i])*(rhs[i] - r[i]);
+    d_max = CS_MAX(d_max, CS_ABS(x_d[i] - x_it[i]));
+    x_max = CS_MAX(x_max, CS_ABS(x_it[i]));
+  }
+  t_res = sqrt(t_res) / r_norm;
+
+  bft_printf("Coarse direct solver, %d rows:\n"
+             "  relative residual %g, difference with PCG (%d iterations) %g\n",
+             (int)c_n_rows, t_res, n_iter, d_max/x_max);
+
+  if (   cvg_d != CS_SLES_CONVERGED || cvg_it != CS_SLES_CONVERGED
+      || t_res > 10*precision || d_max > 1e-10*x_max) {
+    bft_printf("  coarse direct solve failed\n");
+    retval += 1;
+  }
+
+  BFT_FREE(r);
+  BFT_FREE(x_it);
+  BFT_FREE(x_d);
+  BFT_FREE(rhs);
+
+  cs_grid_destroy(&c);
+  cs_grid_destroy(&f);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = 0;
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_MPI)
+  _mpi_init();
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const cs_lnum_t nx = 24, ny = 17;
+  const cs_lnum_t n_cells = nx*ny;
+  const cs_lnum_t db_size[4] = {1, 1, 1, 1};
+  const cs_lnum_t eb_size[4] = {1, 1, 1, 1};
+
+  cs_lnum_t n_faces = 0;
+  cs_lnum_2_t *face_cell = NULL;
+  cs_real_t *da = NULL, *xa = NULL;
+
+  _build_laplacian(nx, ny, &n_faces, &face_cell, &da, &xa);
+
+  cs_matrix_structure_t *ms = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                                         true,
+                                                         n_cells,
+                                                         n_cells,
+                                                         n_faces,
+                                                         (const cs_lnum_2_t *)
+                                                           face_cell,
+                                                         NULL,
+                                                         NULL);
+
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, db_size, eb_size,
+                             n_faces, (const cs_lnum_2_t *)face_cell, da, xa);
+
+  cs_grid_t *f = cs_grid_create_from_parent(a, 1);
+
+  retval += _test_coarsening(f, CS_GRID_COARSENING_SPD_SA);
+  retval += _test_coarsening(f, CS_GRID_COARSENING_SPD_RS);
+
+  retval += _test_mc_gauss_seidel(a);
+
+  /* Multigrid solves with MSR and SELL-C-sigma fine matrices,
+     on a shifted (non-singular) matrix */
+
+  cs_mesh_t m;
+  cs_mesh_quantities_t mq;
+
+  _map_mesh(nx, ny, n_faces, face_cell, &m, &mq);
+
+  cs_real_t *da_s;
+  BFT_MALLOC(da_s, n_cells, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    da_s[i] = da[i] + 0.01;
+
+  retval += _test_coarse_direct(n_faces, (const cs_lnum_2_t *)face_cell,
+                                da_s, xa);
+
+  const cs_matrix_type_t mg_m_type[] = {CS_MATRIX_MSR, CS_MATRIX_SELL};
+
+  for (int t_id = 0; t_id < 2; t_id++) {
+    retval += _test_multigrid(mg_m_type[t_id],
+                              CS_MULTIGRID_V_CYCLE,
+                              CS_GRID_COARSENING_DEFAULT, 0.95,
+                              n_faces, (const cs_lnum_2_t *)face_cell,
+                              da_s, xa);
+    retval += _test_multigrid(mg_m_type[t_id],
+                              CS_MULTIGRID_V_CYCLE,
+                              CS_GRID_COARSENING_DEFAULT, 0.,
+                              n_faces, (const cs_lnum_2_t *)face_cell,
+                              da_s, xa);
+    retval += _test_multigrid(mg_m_type[t_id],
+                              CS_MULTIGRID_V_CYCLE,
+                              CS_GRID_COARSENING_SPD_MX, 0.,
+                              n_faces, (const cs_lnum_2_t *)face_cell,
+                              da_s, xa);
+    retval += _test_multigrid(mg_m_type[t_id],
+                              CS_MULTIGRID_V_CYCLE,
+                              CS_GRID_COARSENING_SPD_SA, 0.,
+                              n_faces, (const cs_lnum_2_t *)face_cell,
+                              da_s, xa);
+    retval += _test_multigrid(mg_m_type[t_id],
+                              CS_MULTIGRID_K_CYCLE,
+                              CS_GRID_COARSENING_SPD_PW, 0.,
+                              n_faces, (const cs_lnum_2_t *)face_cell,
+                              da_s, xa);
+  }
+
+  cs_glob_mesh = NULL;
+  cs_glob_mesh_quantities = NULL;
+
+  BFT_FREE(da_s);
+  BFT_FREE(mq.i_face_normal);
+  BFT_FREE(mq.cell_vol);
+  BFT_FREE(mq.cell_cen);
+
+  /* Free structures */
+
+  cs_grid_destroy(&f);
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(face_cell);
+
+  cs_grid_finalize();
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif /* HAVE_MPI */
+
+  if (retval != 0) {
+    bft_printf("\n%d coarsening or solver check(s) failed\n", retval);
+    exit(EXIT_FAILURE);
+  }
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
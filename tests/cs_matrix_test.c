@@ -520,11 +520,238 @@ _free_base_data(void)
   BFT_FREE(_edges);
 }
 
+/*----------------------------------------------------------------------------
+ * Compare the result of an SpMV product with a reference result.
+ *
+ * parameters:
+ *   descr <-- description of compared variant
+ *   n     <-- number of values
+ *   y_ref <-- reference values
+ *   y     <-- compared values
+ *   r_tol <-- tolerance, relative to the largest reference value
+ *
+ * returns:
+ *   0 if values match to within tolerance, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_spmv(const char       *descr,
+              cs_lnum_t         n,
+              const cs_real_t  *y_ref,
+              const cs_real_t  *y,
+              double            r_tol)
+{
+  double d_max = 0, y_max = 0;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    double d = fabs(y[i] - y_ref[i]);
+    if (d > d_max)
+      d_max = d;
+    if (fabs(y_ref[i]) > y_max)
+      y_max = fabs(y_ref[i]);
+  }
+
+  if (d_max > r_tol*(1. + y_max)) {
+    bft_printf("%s SpMV: max. difference with reference: %g --> mismatch\n",
+               descr, d_max);
+    return 1;
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Define the values of a dense 3x3 block for the BSR test.
+ *
+ * parameters:
+ *   g_row_id <-- global block row id
+ *   g_col_id <-- global block column id
+ *   val      --> block values (row-major)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bsr_block_values(cs_gnum_t  g_row_id,
+                  cs_gnum_t  g_col_id,
+                  cs_real_t  val[9])
+{
+  if (g_row_id == g_col_id) {
+    for (cs_lnum_t k = 0; k < 9; k++)
+      val[k] = cos(g_row_id + 0.1*k) + 2.*(k%4 == 0);
+  }
+  else {
+    for (cs_lnum_t k = 0; k < 9; k++)
+      val[k] = sin(g_row_id + 0.1) * cos(g_col_id + 0.2*k);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Test BSR matrix assembly and SpMV with dense 3x3 blocks, comparing
+ * fixed block size and generic kernels, and the product of a scalar
+ * MSR matrix holding the same coefficients (each block row and column
+ * being expanded to 3 consecutive global ids).
+ *
+ * parameters:
+ *   ma <-- pointer to matrix assembler
+ *
+ * returns:
+ *   number of mismatches
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_bsr(cs_matrix_assembler_t  *ma)
+{
+  const cs_lnum_t b_size[4] = {3, 3, 3, 9};
+
+  /* Block couplings: diagonal (1 of every 2 ids) and edges */
+
+  cs_lnum_t n_b = 0;
+  cs_gnum_t *b_ids;
+  BFT_MALLOC(b_ids, (_n_vtx + _n_edges)*2, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < _n_vtx; i++) {
+    if (_g_vtx_id[i] % 2)
+      continue;
+    b_ids[n_b*2] = _g_vtx_id[i];
+    b_ids[n_b*2 + 1] = _g_vtx_id[i];
+    n_b++;
+  }
+  for (cs_lnum_t i = 0; i < _n_edges; i++) {
+    b_ids[n_b*2] = _g_vtx_id[_edges[i][0]];
+    b_ids[n_b*2 + 1] = _g_vtx_id[_edges[i][1]];
+    n_b++;
+  }
+
+  /* Scalar assembler for the expanded system */
+
+  const cs_gnum_t s_range[2] = {_vtx_range[0]*3, _vtx_range[1]*3};
+
+  cs_matrix_assembler_t  *ma_s = cs_matrix_assembler_create(s_range, true);
+
+  cs_matrix_assembler_set_options(ma_s, 0);
+
+  cs_gnum_t s_row_id[9], s_col_id[9];
+
+  for (cs_lnum_t b_id = 0; b_id < n_b; b_id++) {
+    for (cs_lnum_t k = 0; k < 9; k++) {
+      s_row_id[k] = b_ids[b_id*2]*3 + k/3;
+      s_col_id[k] = b_ids[b_id*2 + 1]*3 + k%3;
+    }
+    cs_matrix_assembler_add_g_ids(ma_s, 9, s_row_id, s_col_id);
+  }
+
+  cs_matrix_assembler_compute(ma_s);
+
+  /* Create matrices */
+
+  cs_matrix_structure_t  *ms
+    = cs_matrix_structure_create_from_assembler(CS_MATRIX_BSR, ma);
+  cs_matrix_structure_t  *ms_s
+    = cs_matrix_structure_create_from_assembler(CS_MATRIX_MSR, ma_s);
+
+  cs_matrix_t  *m = cs_matrix_create(ms);
+  cs_matrix_t  *m_s = cs_matrix_create(ms_s);
+
+  cs_matrix_assembler_values_t *mav
+    = cs_matrix_assembler_values_init(m, b_size, b_size);
+  cs_matrix_assembler_values_t *mav_s
+    = cs_matrix_assembler_values_init(m_s, NULL, NULL);
+
+  cs_gnum_t g_row_id[2], g_col_id[2];
+  cs_real_t val[18];
+  cs_lnum_t j = 0;
+
+  for (cs_lnum_t b_id = 0; b_id < n_b; b_id++) {
+    g_row_id[j] = b_ids[b_id*2];
+    g_col_id[j] = b_ids[b_id*2 + 1];
+    _bsr_block_values(g_row_id[j], g_col_id[j], val + j*9);
+
+    for (cs_lnum_t k = 0; k < 9; k++) {
+      s_row_id[k] = g_row_id[j]*3 + k/3;
+      s_col_id[k] = g_col_id[j]*3 + k%3;
+    }
+    cs_matrix_assembler_values_add_g(mav_s, 9, s_row_id, s_col_id,
+                                     val + j*9);
+
+    j++;
+    if (j == 2) {
+      cs_matrix_assembler_values_add_g(mav, j, g_row_id, g_col_id, val);
+      j = 0;
+    }
+  }
+  cs_matrix_assembler_values_add_g(mav, j, g_row_id, g_col_id, val);
+
+  cs_matrix_assembler_values_finalize(&mav);
+  cs_matrix_assembler_values_finalize(&mav_s);
+
+  BFT_FREE(b_ids);
+
+  /* Compare fixed block size, generic, and scalar MSR SpMV */
+
+  cs_lnum_t n_rows = cs_matrix_get_n_rows(m);
+  cs_lnum_t n_cols = cs_matrix_get_n_columns(m);
+  cs_lnum_t n_cols_s = cs_matrix_get_n_columns(m_s);
+
+  cs_real_t *x, *x_s, *y_0, *y_1, *y_2;
+  BFT_MALLOC(x, n_cols*3, cs_real_t);
+  BFT_MALLOC(x_s, n_cols_s, cs_real_t);
+  BFT_MALLOC(y_0, n_cols*3, cs_real_t);
+  BFT_MALLOC(y_1, n_cols*3, cs_real_t);
+  BFT_MALLOC(y_2, n_cols_s, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_rows*3; i++) {
+    x[i] = (i+1)*0.5;
+    x_s[i] = x[i];
+  }
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y_0);
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_s, x_s, y_2);
+
+  int retval = 0;
+
+  if (cs_matrix_get_n_rows(m_s) != n_rows*3) {
+    bft_printf("BSR 3x3 and scalar MSR row counts differ: %d, %d\n",
+               (int)(n_rows*3), (int)cs_matrix_get_n_rows(m_s));
+    retval += 1;
+  }
+  else
+    retval += _compare_spmv("BSR 3x3 vs scalar MSR", n_rows*3, y_2, y_0,
+                            1e-12);
+
+  cs_matrix_variant_t *mv = cs_matrix_variant_create(m);
+  cs_matrix_variant_set_func(mv, NULL, cs_matrix_get_fill_type(false,
+                                                               b_size,
+                                                               b_size),
+                             0, "generic");
+  cs_matrix_variant_apply(m, mv);
+  cs_matrix_variant_destroy(&mv);
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y_1);
+
+  retval += _compare_spmv("BSR 3x3 generic", n_rows*3, y_0, y_1, 1e-12);
+
+  BFT_FREE(x);
+  BFT_FREE(x_s);
+  BFT_FREE(y_0);
+  BFT_FREE(y_1);
+  BFT_FREE(y_2);
+
+  cs_matrix_release_coefficients(m);
+  cs_matrix_release_coefficients(m_s);
+  cs_matrix_destroy(&m);
+  cs_matrix_destroy(&m_s);
+  cs_matrix_structure_destroy(&ms);
+  cs_matrix_structure_destroy(&ms_s);
+  cs_matrix_assembler_destroy(&ma_s);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 
 int
 main (int argc, char *argv[])
 {
+  int retval = 0;
+
   CS_UNUSED(argc);
   CS_UNUSED(argv);
 
@@ -625,27 +852,35 @@ main (int argc, char *argv[])
 #endif
 
     /* Create associated structures and matrices
-       (2 matrices are created simultaneously, to exercice
-       the const/shareable aspect of the assembler) */
+       (3 matrices are created simultaneously, to exercice
+       the const/shareable aspect of the assembler; small slices
+       are used for the SELL matrix so as to exercise padding) */
+
+    cs_matrix_set_sell_options(4, 8);
 
     cs_matrix_structure_t  *ms_0
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_CSR, ma);
     cs_matrix_structure_t  *ms_1
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_MSR, ma);
+    cs_matrix_structure_t  *ms_2
+      = cs_matrix_structure_create_from_assembler(CS_MATRIX_SELL, ma);
 
     cs_matrix_t  *m_0 = cs_matrix_create(ms_0);
     cs_matrix_t  *m_1 = cs_matrix_create(ms_1);
+    cs_matrix_t  *m_2 = cs_matrix_create(ms_2);
 
     /* Now prepare to add values */
 
-    for (int mav_id = 0; mav_id < 2; mav_id++) {
+    for (int mav_id = 0; mav_id < 3; mav_id++) {
 
       cs_matrix_assembler_values_t *mav = NULL;
 
       if (mav_id == 0)
         mav = cs_matrix_assembler_values_init(m_0, NULL, NULL);
-      else
+      else if (mav_id == 1)
         mav = cs_matrix_assembler_values_init(m_1, NULL, NULL);
+      else
+        mav = cs_matrix_assembler_values_init(m_2, NULL, NULL);
 
       /* Same ids required as for assembler (at least, no additional ids),
          so loop in a similar manner for safety, but with different
@@ -703,32 +938,69 @@ main (int argc, char *argv[])
     cs_lnum_t n_rows = cs_matrix_get_n_rows(m_0);
     cs_lnum_t n_cols = cs_matrix_get_n_columns(m_0);
 
-    cs_real_t *x, *y_0, *y_1;
+    cs_real_t *x, *y_0, *y_1, *y_2, *y_3;
     BFT_MALLOC(x, n_cols, cs_real_t);
     BFT_MALLOC(y_0, n_cols, cs_real_t);
     BFT_MALLOC(y_1, n_cols, cs_real_t);
+    BFT_MALLOC(y_2, n_cols, cs_real_t);
+    BFT_MALLOC(y_3, n_cols, cs_real_t);
     for (cs_lnum_t i = 0; i < n_rows; i++)
       x[i] = (i+1)*0.5;
 
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_0, x, y_0);
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_1);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_2, x, y_2);
+
+    /* MSR with single precision extra-diagonal values */
+
+    cs_matrix_set_reduced_precision(m_1, true);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_3);
 
     bft_printf("\nSpMV pass %d\n", id_ie);
     for (cs_lnum_t i = 0; i < n_rows; i++)
-      bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+      bft_printf("%d: %f %f %f %f\n", i, y_0[i], y_1[i], y_2[i], y_3[i]);
+
+    retval += _compare_spmv("MSR", n_rows, y_0, y_1, 1e-12);
+    retval += _compare_spmv("SELL", n_rows, y_0, y_2, 1e-12);
+
+    /* Extra-diagonal values rounded to single precision (relative error
+       up to 6e-8 per term), so a looser tolerance is used */
+
+    retval += _compare_spmv("MSR reduced precision", n_rows, y_0, y_3, 1e-6);
+
+    /* SELL matrices converted from CSR and MSR matrices
+       (as used for tuning) */
+
+    for (int src_id = 0; src_id < 2; src_id++) {
+      cs_matrix_t  *m_s
+        = cs_matrix_create_sell_by_copy((src_id == 0) ? m_0 : m_1);
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_s, x, y_2);
+      retval += _compare_spmv((src_id == 0) ? "SELL from CSR" : "SELL from MSR",
+                              n_rows, y_0, y_2, 1e-12);
+      cs_matrix_destroy(&m_s);
+    }
 
     BFT_FREE(x);
     BFT_FREE(y_0);
     BFT_FREE(y_1);
+    BFT_FREE(y_2);
+    BFT_FREE(y_3);
 
     cs_matrix_release_coefficients(m_0);
     cs_matrix_release_coefficients(m_1);
+    cs_matrix_release_coefficients(m_2);
 
     cs_matrix_destroy(&m_0);
     cs_matrix_destroy(&m_1);
+    cs_matrix_destroy(&m_2);
 
     cs_matrix_structure_destroy(&ms_0);
     cs_matrix_structure_destroy(&ms_1);
+    cs_matrix_structure_destroy(&ms_2);
+
+    /* Test BSR storage with dense extra-diagonal blocks */
+
+    retval += _test_bsr(ma);
 
     cs_matrix_assembler_destroy(&ma);
   }
@@ -838,5 +1110,10 @@ main (int argc, char *argv[])
   }
 #endif /* HAVE_MPI */
 
+  if (retval != 0) {
+    fprintf(stderr, "%d SpMV comparison(s) failed\n", retval);
+    exit(EXIT_FAILURE);
+  }
+
   exit (EXIT_SUCCESS);
 }
@@ -0,0 +1,505 @@
+/*============================================================================
+ * Unit test for rank order output in fvm_to_ensight.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+
+#include "fvm_nodal.h"
+#include "fvm_nodal_append.h"
+#include "fvm_to_ensight.h"
+
+/*----------------------------------------------------------------------------*/
+
+/* Number of elements in test mesh */
+
+static const cs_gnum_t _n_g_elts = 997;
+
+/*----------------------------------------------------------------------------
+ * Check if an element of the test mesh is present on a given rank.
+ *
+ * Elements are distributed in an interleaved manner, and when shared
+ * elements are requested, every 5th element is also present on the
+ * next rank, as interior faces on partition boundaries would be.
+ *
+ * parameters:
+ *   g_elt_num <-- element global number
+ *   rank      <-- rank id
+ *   n_ranks   <-- number of ranks
+ *   shared    <-- are some elements present on several ranks ?
+ *
+ * returns:
+ *   true if element is present on the given rank, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_local(cs_gnum_t  g_elt_num,
+          int        rank,
+          int        n_ranks,
+          bool       shared)
+{
+  int owner = (g_elt_num*7 + g_elt_num/13) % n_ranks;
+
+  if (owner == rank)
+    return true;
+  else if (shared && g_elt_num%5 == 0 && (owner+1)%n_ranks == rank)
+    return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Build local part of a strip of quadrangles and pentagons.
+ *
+ * Element i (1 to n) spans the [i-1, i] x [0, 1] square, with an additional
+ * apex vertex at (i-0.5, 1.5) for odd element numbers.
+ *
+ * parameters:
+ *   rank      <-- rank id
+ *   n_ranks   <-- number of ranks
+ *   shared    <-- are some elements present on several ranks ?
+ *   g_elt_num --> global element numbers (allocated here)
+ *
+ * returns:
+ *   pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_build_strip(int          rank,
+             int          n_ranks,
+             bool         shared,
+             cs_gnum_t  **g_elt_num)
+{
+  const cs_gnum_t n = _n_g_elts;
+  const cs_lnum_t n_g_vtx = 2*(n+1) + (n+1)/2;
+
+  cs_lnum_t n_vtx = 0, n_elts = 0, n_quads = 0, n_polys = 0;
+  cs_lnum_t *vtx_id = NULL;
+  cs_gnum_t *g_vtx_num = NULL;
+  cs_coord_t *vtx_coords = NULL;
+
+  BFT_MALLOC(vtx_id, n_g_vtx, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_g_vtx; i++)
+    vtx_id[i] = -1;
+
+  for (cs_gnum_t g = 1; g <= n; g++) {
+    if (_is_local(g, rank, n_ranks, shared)) {
+      n_elts++;
+      if (g%2)
+        n_polys++;
+      else
+        n_quads++;
+    }
+  }
+
+  cs_lnum_t *quad_vtx_num, *quad_parent_num;
+  cs_lnum_t *poly_vtx_idx, *poly_vtx_num, *poly_parent_num;
+
+  BFT_MALLOC(quad_vtx_num, n_quads*4, cs_lnum_t);
+  BFT_MALLOC(quad_parent_num, n_quads, cs_lnum_t);
+  BFT_MALLOC(poly_vtx_idx, n_polys + 1, cs_lnum_t);
+  BFT_MALLOC(poly_vtx_num, n_polys*5, cs_lnum_t);
+  BFT_MALLOC(poly_parent_num, n_polys, cs_lnum_t);
+
+  BFT_MALLOC(g_vtx_num, n_g_vtx, cs_gnum_t);
+  BFT_MALLOC(vtx_coords, n_g_vtx*3, cs_coord_t);
+  BFT_MALLOC(*g_elt_num, n_elts, cs_gnum_t);
+
+  n_elts = 0, n_quads = 0, n_polys = 0;
+  poly_vtx_idx[0] = 0;
+
+  for (cs_gnum_t g = 1; g <= n; g++) {
+
+    if (_is_local(g, rank, n_ranks, shared) == false)
+      continue;
+
+    /* Global vertex numbers: bottom row, top row, then apexes */
+
+    const int n_e_vtx = (g%2) ? 5 : 4;
+    cs_gnum_t e_vtx[5] = {g, g+1, n+2+g, n+1+g, 0};
+
+    if (n_e_vtx == 5) {
+      e_vtx[4] = e_vtx[3];
+      e_vtx[3] = 2*(n+1) + (g+1)/2;
+    }
+
+    cs_lnum_t e_vtx_num[5];
+
+    for (int j = 0; j < n_e_vtx; j++) {
+      cs_gnum_t v_g = e_vtx[j];
+      if (vtx_id[v_g - 1] < 0) {
+        vtx_id[v_g - 1] = n_vtx;
+        g_vtx_num[n_vtx] = v_g;
+        if (v_g <= n+1) {
+          vtx_coords[n_vtx*3]     = v_g - 1;
+          vtx_coords[n_vtx*3 + 1] = 0.;
+        }
+        else if (v_g <= 2*(n+1)) {
+          vtx_coords[n_vtx*3]     = v_g - (n+2);
+          vtx_coords[n_vtx*3 + 1] = 1.;
+        }
+        else {
+          vtx_coords[n_vtx*3]     = 2.*(v_g - 2*(n+1)) - 1.5;
+          vtx_coords[n_vtx*3 + 1] = 1.5;
+        }
+        vtx_coords[n_vtx*3 + 2] = 0.;
+        n_vtx++;
+      }
+      e_vtx_num[j] = vtx_id[v_g - 1] + 1;
+    }
+
+    (*g_elt_num)[n_elts] = g;
+    n_elts++;
+
+    if (n_e_vtx == 4) {
+      for (int j = 0; j < 4; j++)
+        quad_vtx_num[n_quads*4 + j] = e_vtx_num[j];
+      quad_parent_num[n_quads] = n_elts;
+      n_quads++;
+    }
+    else {
+      for (int j = 0; j < 5; j++)
+        poly_vtx_num[poly_vtx_idx[n_polys] + j] = e_vtx_num[j];
+      poly_vtx_idx[n_polys+1] = poly_vtx_idx[n_polys] + 5;
+      poly_parent_num[n_polys] = n_elts;
+      n_polys++;
+    }
+
+  }
+
+  BFT_FREE(vtx_id);
+
+  fvm_nodal_t *mesh = fvm_nodal_create("strip", 3);
+
+  fvm_nodal_append_by_transfer(mesh, n_quads, FVM_FACE_QUAD,
+                               NULL, NULL, NULL,
+                               quad_vtx_num, quad_parent_num);
+  fvm_nodal_append_by_transfer(mesh, n_polys, FVM_FACE_POLY,
+                               NULL, NULL,
+                               poly_vtx_idx, poly_vtx_num, poly_parent_num);
+
+  fvm_nodal_define_vertex_list(mesh, n_vtx, NULL);
+
+  BFT_REALLOC(vtx_coords, n_vtx*3, cs_coord_t);
+  fvm_nodal_transfer_vertices(mesh, vtx_coords);
+
+  fvm_nodal_init_io_num(mesh, *g_elt_num, 2);
+  fvm_nodal_init_io_num(mesh, g_vtx_num, 0);
+
+  BFT_FREE(g_vtx_num);
+
+  return mesh;
+}
+
+/*----------------------------------------------------------------------------
+ * Read data from a file, exiting on failure.
+ *----------------------------------------------------------------------------*/
+
+static void
+_read(FILE    *f,
+      void    *buf,
+      size_t   size)
+{
+  if (fread(buf, 1, size, f) != size)
+    bft_error(__FILE__, __LINE__, 0, "Unexpected end of file.");
+}
+
+/*----------------------------------------------------------------------------
+ * Read an EnSight string, optionally checking its start.
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_string(FILE        *f,
+             char         s[81],
+             const char  *expected)
+{
+  _read(f, s, 80);
+  s[80] = '\0';
+
+  if (expected != NULL && strncmp(s, expected, strlen(expected)) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Expected \"%s\" in EnSight file, read \"%s\".", expected, s);
+}
+
+/*----------------------------------------------------------------------------
+ * Read back EnSight geometry and element global number field, and check
+ * that each element's field value matches its location.
+ *
+ * parameters:
+ *   name        <-- case name
+ *   tesselation <-- were polygons tesselated ?
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_output(const char  *name,
+              bool         tesselation)
+{
+  int n_errors = 0;
+  char s[81], file_name[128];
+
+  snprintf(file_name, 127, "%s.geo", name);
+  FILE *fg = fopen(file_name, "rb");
+  snprintf(file_name, 127, "%s.gnum.00001", name);
+  FILE *fv = fopen(file_name, "rb");
+
+  if (fg == NULL || fv == NULL)
+    bft_error(__FILE__, __LINE__, 0, "Error opening EnSight files.");
+
+  /* Headers and vertex coordinates */
+
+  int32_t part_num, n_vtx;
+
+  _read_string(fg, s, "C Binary");
+  _read_string(fg, s, NULL);
+  _read_string(fg, s, NULL);
+  _read_string(fg, s, "node id");
+  _read_string(fg, s, "element id");
+  _read_string(fg, s, "part");
+  _read(fg, &part_num, 4);
+  _read_string(fg, s, NULL);
+  _read_string(fg, s, "coordinates");
+  _read(fg, &n_vtx, 4);
+
+  float *x;
+  BFT_MALLOC(x, n_vtx, float);
+  _read(fg, x, n_vtx*sizeof(float));
+  fseek(fg, n_vtx*2*sizeof(float), SEEK_CUR);
+
+  _read_string(fv, s, NULL);
+  _read_string(fv, s, "part");
+  _read(fv, &part_num, 4);
+
+  /* Element sections */
+
+  cs_gnum_t n_g_elts = 0;
+
+  while (fread(s, 1, 80, fg) == 80) {
+
+    int32_t n_elts, stride = 0;
+    s[80] = '\0';
+
+    if (strncmp(s, "tria3", 5) == 0)
+      stride = 3;
+    else if (strncmp(s, "quad4", 5) == 0)
+      stride = 4;
+    else if (strncmp(s, "nsided", 6) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                "Unexpected EnSight element type \"%s\".", s);
+
+    _read(fg, &n_elts, 4);
+    _read_string(fv, s, s);
+
+    int32_t *n_elt_vtx, elt_vtx[5];
+    float *val;
+    BFT_MALLOC(n_elt_vtx, n_elts, int32_t);
+    BFT_MALLOC(val, n_elts, float);
+
+    if (stride == 0)
+      _read(fg, n_elt_vtx, n_elts*4);
+    else {
+      for (int32_t i = 0; i < n_elts; i++)
+        n_elt_vtx[i] = stride;
+    }
+    _read(fv, val, n_elts*sizeof(float));
+
+    for (int32_t i = 0; i < n_elts; i++) {
+      double x_mean = 0.;
+      if (n_elt_vtx[i] > 5)
+        bft_error(__FILE__, __LINE__, 0,
+                  "Unexpected number of element vertices: %d.",
+                  (int)(n_elt_vtx[i]));
+      _read(fg, elt_vtx, n_elt_vtx[i]*4);
+      for (int32_t j = 0; j < n_elt_vtx[i]; j++)
+        x_mean += x[elt_vtx[j] - 1];
+      x_mean /= n_elt_vtx[i];
+      if (fabs(val[i] - (floor(x_mean) + 1)) > 0.1)
+        n_errors++;
+    }
+
+    n_g_elts += n_elts;
+
+    BFT_FREE(val);
+    BFT_FREE(n_elt_vtx);
+  }
+
+  /* Pentagons are split into 3 triangles when tesselated */
+
+  cs_gnum_t n_g_elts_ref = _n_g_elts;
+  if (tesselation)
+    n_g_elts_ref += ((_n_g_elts+1)/2)*2;
+
+  if (n_g_elts != n_g_elts_ref)
+    n_errors++;
+
+  bft_printf("%-30s %llu elements, %d errors\n",
+             name, (unsigned long long)n_g_elts, n_errors);
+
+  BFT_FREE(x);
+
+  fclose(fv);
+  fclose(fg);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int n_errors = 0;
+
+#if defined(HAVE_MPI)
+
+  cs_base_mpi_init(&argc, &argv);
+
+  MPI_Comm comm = cs_glob_mpi_comm;
+
+#else
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#endif
+
+  const int rank = CS_MAX(cs_glob_rank_id, 0);
+  const int n_ranks = cs_glob_n_ranks;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const char *options[2] = {"binary rank_order",
+                            "binary rank_order divide_polygons"};
+
+  for (int test_id = 0; test_id < 4; test_id++) {
+
+    char name[32];
+    cs_gnum_t *g_elt_num = NULL;
+
+    const bool shared = (test_id / 2) ? true : false;
+    const bool tesselation = (test_id % 2) ? true : false;
+
+    snprintf(name, 31, "rank_order_%d", test_id);
+
+    fvm_nodal_t *mesh = _build_strip(rank, n_ranks, shared, &g_elt_num);
+    if (tesselation)
+      fvm_nodal_tesselate(mesh, FVM_FACE_POLY, NULL);
+
+#if defined(HAVE_MPI)
+    void *w = fvm_to_ensight_init_writer(name,
+                                         NULL,
+                                         options[test_id % 2],
+                                         FVM_WRITER_FIXED_MESH,
+                                         comm);
+#else
+    void *w = fvm_to_ensight_init_writer(name,
+                                         NULL,
+                                         options[test_id % 2],
+                                         FVM_WRITER_FIXED_MESH);
+#endif
+
+    fvm_to_ensight_export_nodal(w, mesh);
+
+    /* Output global element numbers as field values */
+
+    cs_lnum_t n_elts = fvm_nodal_get_n_entities(mesh, 2);
+    const cs_lnum_t parent_num_shift[1] = {0};
+
+    float *val;
+    BFT_MALLOC(val, n_elts, float);
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      val[i] = g_elt_num[i];
+
+    const void *field_values[1] = {val};
+
+    fvm_to_ensight_set_mesh_time(w, 1, 0.1);
+    fvm_to_ensight_export_field(w,
+                                mesh,
+                                "gnum",
+                                FVM_WRITER_PER_ELEMENT,
+                                1,
+                                CS_INTERLACE,
+                                1,
+                                parent_num_shift,
+                                CS_FLOAT,
+                                1,
+                                0.1,
+                                field_values);
+
+    w = fvm_to_ensight_finalize_writer(w);
+
+    BFT_FREE(val);
+    BFT_FREE(g_elt_num);
+
+    mesh = fvm_nodal_destroy(mesh);
+
+    /* Read back output */
+
+#if defined(HAVE_MPI)
+    if (comm != MPI_COMM_NULL)
+      MPI_Barrier(comm);
+#endif
+
+    if (rank == 0)
+      n_errors += _check_output(name, tesselation);
+
+  }
+
+#if defined(HAVE_MPI)
+  if (comm != MPI_COMM_NULL) {
+    int n_errors_tot = 0;
+    MPI_Allreduce(&n_errors, &n_errors_tot, 1, MPI_INT, MPI_SUM, comm);
+    n_errors = n_errors_tot;
+  }
+#endif
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
+  exit(EXIT_SUCCESS);
+}
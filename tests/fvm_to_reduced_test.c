@@ -0,0 +1,408 @@
+/*============================================================================
+ * Unit test for quantized output in fvm_to_reduced.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+
+#include "fvm_nodal.h"
+#include "fvm_nodal_append.h"
+#include "fvm_nodal_extract.h"
+#include "fvm_to_reduced.h"
+
+/*----------------------------------------------------------------------------*/
+
+/* Number of elements in test mesh */
+
+static const cs_gnum_t _n_g_elts = 997;
+
+/*----------------------------------------------------------------------------
+ * Build local part of a strip of quadrangles.
+ *
+ * Element i (1 to n) spans the [i-1, i] x [0, 1] square; elements are
+ * distributed in contiguous ranges, so vertices on range boundaries are
+ * present on several ranks.
+ *
+ * parameters:
+ *   rank    <-- rank id
+ *   n_ranks <-- number of ranks
+ *
+ * returns:
+ *   pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_build_strip(int  rank,
+             int  n_ranks)
+{
+  const cs_gnum_t n = _n_g_elts;
+  const cs_gnum_t g_s = (n*rank)/n_ranks + 1;
+  const cs_gnum_t g_e = (n*(rank+1))/n_ranks + 1;
+
+  const cs_lnum_t n_elts = g_e - g_s;
+  const cs_lnum_t n_vtx = (n_elts > 0) ? 2*(n_elts + 1) : 0;
+
+  cs_lnum_t *vtx_num, *parent_num;
+  cs_gnum_t *g_elt_num, *g_vtx_num;
+  cs_coord_t *vtx_coords;
+
+  BFT_MALLOC(vtx_num, n_elts*4, cs_lnum_t);
+  BFT_MALLOC(parent_num, n_elts, cs_lnum_t);
+  BFT_MALLOC(g_elt_num, n_elts, cs_gnum_t);
+  BFT_MALLOC(g_vtx_num, n_vtx, cs_gnum_t);
+  BFT_MALLOC(vtx_coords, n_vtx*3, cs_coord_t);
+
+  /* Local vertices: bottom row, then top row */
+
+  for (cs_lnum_t i = 0; i < n_vtx/2; i++) {
+    g_vtx_num[i] = g_s + i;
+    g_vtx_num[n_vtx/2 + i] = n + 1 + g_s + i;
+    for (int j = 0; j < 2; j++) {
+      cs_lnum_t k = j*(n_vtx/2) + i;
+      vtx_coords[k*3]     = g_s + i - 1;
+      vtx_coords[k*3 + 1] = j;
+      vtx_coords[k*3 + 2] = 0.;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    vtx_num[i*4]     = i + 1;
+    vtx_num[i*4 + 1] = i + 2;
+    vtx_num[i*4 + 2] = n_vtx/2 + i + 2;
+    vtx_num[i*4 + 3] = n_vtx/2 + i + 1;
+    parent_num[i] = i + 1;
+    g_elt_num[i] = g_s + i;
+  }
+
+  fvm_nodal_t *mesh = fvm_nodal_create("strip", 3);
+
+  fvm_nodal_append_by_transfer(mesh, n_elts, FVM_FACE_QUAD,
+                               NULL, NULL, NULL,
+                               vtx_num, parent_num);
+
+  fvm_nodal_define_vertex_list(mesh, n_vtx, NULL);
+  fvm_nodal_transfer_vertices(mesh, vtx_coords);
+
+  fvm_nodal_init_io_num(mesh, g_elt_num, 2);
+  fvm_nodal_init_io_num(mesh, g_vtx_num, 0);
+
+  BFT_FREE(g_vtx_num);
+  BFT_FREE(g_elt_num);
+
+  return mesh;
+}
+
+/*----------------------------------------------------------------------------
+ * Read big-endian data from a file, exiting on failure.
+ *----------------------------------------------------------------------------*/
+
+static void
+_read(FILE    *f,
+      void    *buf,
+      size_t   size,
+      size_t   ni)
+{
+  if (fread(buf, size, ni, f) != ni)
+    bft_error(__FILE__, __LINE__, 0, "Unexpected end of file.");
+
+  const unsigned int one = 1;
+  if (*((const unsigned char *)&one) == 1 && size > 1) {
+    unsigned char *p = buf;
+    for (size_t i = 0; i < ni; i++) {
+      for (size_t j = 0; j < size/2; j++) {
+        unsigned char t = p[i*size + j];
+        p[i*size + j] = p[i*size + size - 1 - j];
+        p[i*size + size - 1 - j] = t;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read a string, checking its start.
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_string(FILE        *f,
+             const char  *expected)
+{
+  char s[81];
+
+  _read(f, s, 1, 80);
+  s[80] = '\0';
+
+  if (strncmp(s, expected, strlen(expected)) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Expected \"%s\" in reduced-order file, read \"%s\".",
+              expected, s);
+}
+
+/*----------------------------------------------------------------------------
+ * Read back sample coordinates and quantized vertex field, and check
+ * that decoded values (v = offset + q*scale) are within half a
+ * quantization step of the exact values.
+ *
+ * parameters:
+ *   name <-- writer name
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_output(const char  *name)
+{
+  int n_errors = 0;
+  char file_name[128];
+
+  snprintf(file_name, 127, "%s.coords", name);
+  FILE *fc = fopen(file_name, "rb");
+  snprintf(file_name, 127, "%s.f.00001", name);
+  FILE *fv = fopen(file_name, "rb");
+
+  if (fc == NULL || fv == NULL)
+    bft_error(__FILE__, __LINE__, 0, "Error opening reduced-order files.");
+
+  /* Vertex sample coordinates */
+
+  int64_t c_header[2];
+
+  _read_string(fc, "Code_Saturne reduced-order sample coordinates");
+  _read_string(fc, "vertices");
+  _read(fc, c_header, sizeof(int64_t), 2);
+
+  const int64_t n_samples = c_header[0];
+
+  float *coords;
+  BFT_MALLOC(coords, n_samples*3, float);
+  _read(fc, coords, sizeof(float), n_samples*3);
+
+  /* Field values */
+
+  int64_t header[6];
+  double t;
+
+  _read_string(fv, "Code_Saturne reduced-order field");
+  _read_string(fv, "f");
+  _read_string(fv, "vertices");
+  _read(fv, header, sizeof(int64_t), 6);
+  _read(fv, &t, sizeof(double), 1);
+
+  const int dim = header[2];
+  const int n_bits = header[3];
+  const int64_t q_block_size = header[4];
+  const int64_t n_q_blocks = (n_samples + q_block_size - 1) / q_block_size;
+
+  if (header[1] != n_samples || dim != 2)
+    bft_error(__FILE__, __LINE__, 0, "Unexpected field header.");
+
+  float *q_params;
+  uint16_t *q;
+  BFT_MALLOC(q_params, n_q_blocks*dim*2, float);
+  BFT_MALLOC(q, n_samples*dim, uint16_t);
+
+  _read(fv, q_params, sizeof(float), n_q_blocks*dim*2);
+
+  if (n_bits == 8) {
+    uint8_t *q8;
+    BFT_MALLOC(q8, n_samples*dim, uint8_t);
+    _read(fv, q8, 1, n_samples*dim);
+    for (int64_t i = 0; i < n_samples*dim; i++)
+      q[i] = q8[i];
+    BFT_FREE(q8);
+  }
+  else
+    _read(fv, q, sizeof(uint16_t), n_samples*dim);
+
+  double max_err = 0;
+
+  for (int64_t i = 0; i < n_samples; i++) {
+    const int64_t b_id = i / q_block_size;
+    const float x = coords[i*3];
+    const float ref[2] = {x, x*x};
+    for (int k = 0; k < dim; k++) {
+      const double offset = q_params[(b_id*dim + k)*2];
+      const double scale = q_params[(b_id*dim + k)*2 + 1];
+      const double v = offset + q[i*dim + k]*scale;
+      const double err = fabs(v - ref[k]);
+      if (err > 0.5*scale*(1 + 1e-5) + 1e-6*fabs(ref[k]))
+        n_errors++;
+      if (scale > 0)
+        max_err = CS_MAX(max_err, err/scale);
+    }
+  }
+
+  bft_printf("%-30s %llu samples, max error %5.3f steps, %d errors\n",
+             name, (unsigned long long)n_samples, max_err, n_errors);
+
+  BFT_FREE(q);
+  BFT_FREE(q_params);
+  BFT_FREE(coords);
+
+  fclose(fv);
+  fclose(fc);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int n_errors = 0;
+
+#if defined(HAVE_MPI)
+
+  cs_base_mpi_init(&argc, &argv);
+
+  MPI_Comm comm = cs_glob_mpi_comm;
+
+#else
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#endif
+
+  const int rank = CS_MAX(cs_glob_rank_id, 0);
+  const int n_ranks = cs_glob_n_ranks;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const char *options[3] = {"bits=8 block_size=64",
+                            "bits=16 block_size=100",
+                            "bits=16 block_size=32 decimate=3"};
+
+  for (int test_id = 0; test_id < 3; test_id++) {
+
+    char name[32];
+
+    snprintf(name, 31, "reduced_%d", test_id);
+
+    fvm_nodal_t *mesh = _build_strip(rank, n_ranks);
+
+#if defined(HAVE_MPI)
+    void *w = fvm_to_reduced_init_writer(name,
+                                         "",
+                                         options[test_id],
+                                         FVM_WRITER_FIXED_MESH,
+                                         comm);
+#else
+    void *w = fvm_to_reduced_init_writer(name,
+                                         "",
+                                         options[test_id],
+                                         FVM_WRITER_FIXED_MESH);
+#endif
+
+    fvm_to_reduced_export_nodal(w, mesh);
+
+    /* Output (x, x^2) as vertex field values */
+
+    const cs_lnum_t n_vtx = fvm_nodal_get_n_entities(mesh, 0);
+    const cs_lnum_t parent_num_shift[1] = {0};
+
+    cs_coord_t *vtx_coords;
+    BFT_MALLOC(vtx_coords, n_vtx*3, cs_coord_t);
+    fvm_nodal_get_vertex_coords(mesh, CS_INTERLACE, vtx_coords);
+
+    double *val;
+    BFT_MALLOC(val, n_vtx*2, double);
+    for (cs_lnum_t i = 0; i < n_vtx; i++) {
+      val[i*2] = vtx_coords[i*3];
+      val[i*2 + 1] = vtx_coords[i*3]*vtx_coords[i*3];
+    }
+
+    BFT_FREE(vtx_coords);
+
+    const void *field_values[1] = {val};
+
+    fvm_to_reduced_set_mesh_time(w, 1, 0.1);
+    fvm_to_reduced_export_field(w,
+                                mesh,
+                                "f",
+                                FVM_WRITER_PER_NODE,
+                                2,
+                                CS_INTERLACE,
+                                0,
+                                parent_num_shift,
+                                CS_DOUBLE,
+                                1,
+                                0.1,
+                                field_values);
+
+    w = fvm_to_reduced_finalize_writer(w);
+
+    BFT_FREE(val);
+
+    mesh = fvm_nodal_destroy(mesh);
+
+    /* Read back output */
+
+#if defined(HAVE_MPI)
+    if (comm != MPI_COMM_NULL)
+      MPI_Barrier(comm);
+#endif
+
+    if (rank == 0)
+      n_errors += _check_output(name);
+
+  }
+
+#if defined(HAVE_MPI)
+  if (comm != MPI_COMM_NULL) {
+    int n_errors_tot = 0;
+    MPI_Allreduce(&n_errors, &n_errors_tot, 1, MPI_INT, MPI_SUM, comm);
+    n_errors = n_errors_tot;
+  }
+#endif
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
+  exit(EXIT_SUCCESS);
+}